@@ -1,5 +1,6 @@
 #pragma once
 
+#include "analyzer/analyzerdecimator.h"
 #include "util/assert.h"
 #include "util/types.h"
 
@@ -17,12 +18,27 @@ class Analyzer {
   public:
     virtual ~Analyzer() = default;
 
-    // This method is supposed to:
-    //  1. Check if the track needs to be analyzed, otherwise return false.
-    //  2. Perform the initialization and return true on success.
-    //  3. If the initialization failed log the internal error and return false.
+    // Check if the track needs to be analyzed by comparing the stored
+    // results and their versions with the current settings. This must
+    // not access the audio data. The AnalyzerThread only opens and
+    // decodes the audio source if at least one analyzer returns true
+    // and skips initialize() for all other analyzers.
+    virtual bool shouldAnalyze(TrackPointer tio) const = 0;
+
+    // This method is only invoked after shouldAnalyze() returned true
+    // for the same track and must not repeat that check. It is supposed to:
+    //  1. Perform the initialization and return true on success.
+    //  2. If the initialization failed log the internal error and return false.
     virtual bool initialize(TrackPointer tio, int sampleRate, int totalSamples) = 0;
 
+    // Analyzers that only need the bandwidth of a mono downmix return the
+    // minimum sample rate they need. processSamples() then receives the
+    // downmix decimated by mixxx::AnalyzerDecimator::decimationFactor(). The
+    // arguments of initialize() always refer to the original signal.
+    virtual int minSampleRate() const {
+        return 0;
+    }
+
     /////////////////////////////////////////////////////////////////////////
     // All following methods will only be invoked after initialize()
     // returned true!
@@ -51,6 +67,7 @@ class AnalyzerWithState final {
   public:
     explicit AnalyzerWithState(AnalyzerPtr analyzer)
             : m_analyzer(std::move(analyzer)),
+              m_decimationFactor(1),
               m_active(false) {
         DEBUG_ASSERT(m_analyzer);
     }
@@ -66,8 +83,21 @@ class AnalyzerWithState final {
         return m_active;
     }
 
+    // The decimation factor of the samples that are passed to
+    // processSamples(), valid after initialize()
+    int decimationFactor() const {
+        return m_decimationFactor;
+    }
+
+    bool shouldAnalyze(TrackPointer tio) const {
+        DEBUG_ASSERT(!m_active);
+        return m_analyzer->shouldAnalyze(tio);
+    }
+
     bool initialize(TrackPointer tio, int sampleRate, int totalSamples) {
         DEBUG_ASSERT(!m_active);
+        m_decimationFactor = mixxx::AnalyzerDecimator::decimationFactor(
+                sampleRate, m_analyzer->minSampleRate());
         return m_active = m_analyzer->initialize(tio, sampleRate, totalSamples);
     }
 
@@ -99,5 +129,6 @@ class AnalyzerWithState final {
 
   private:
     AnalyzerPtr m_analyzer;
+    int m_decimationFactor;
     bool m_active;
 };
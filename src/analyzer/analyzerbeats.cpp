@@ -40,6 +40,7 @@ AnalyzerBeats::AnalyzerBeats(UserSettingsPointer pConfig, bool enforceBpmDetecti
           m_bPreferencesFastAnalysis(false),
           m_iSampleRate(0),
           m_iTotalSamples(0),
+          m_iDecimationFactor(1),
           m_iMaxSamplesToProcess(0),
           m_iCurrentSample(0),
           m_iMinBpm(0),
@@ -47,23 +48,11 @@ AnalyzerBeats::AnalyzerBeats(UserSettingsPointer pConfig, bool enforceBpmDetecti
 }
 
 bool AnalyzerBeats::initialize(TrackPointer tio, int sampleRate, int totalSamples) {
+    Q_UNUSED(tio);
     if (totalSamples == 0) {
         return false;
     }
 
-    bool bPreferencesBeatDetectionEnabled =
-            m_enforceBpmDetection || m_bpmSettings.getBpmDetectionEnabled();
-    if (!bPreferencesBeatDetectionEnabled) {
-        qDebug() << "Beat calculation is deactivated";
-        return false;
-    }
-
-    bool bpmLock = tio->isBpmLocked();
-    if (bpmLock) {
-        qDebug() << "Track is BpmLocked: Beat calculation will not start";
-        return false;
-    }
-
     m_iMinBpm = m_bpmSettings.getBpmRangeStart();
     m_iMaxBpm = m_bpmSettings.getBpmRangeEnd();
 
@@ -95,50 +84,54 @@ bool AnalyzerBeats::initialize(TrackPointer tio, int sampleRate, int totalSample
 
     m_iSampleRate = sampleRate;
     m_iTotalSamples = totalSamples;
+    // The plugin receives the decimated signal, see minSampleRate()
+    m_iDecimationFactor = mixxx::AnalyzerDecimator::decimationFactor(
+            sampleRate, minSampleRate());
+    const int decimatedSampleRate = sampleRate / m_iDecimationFactor;
     // In fast analysis mode, skip processing after
     // kFastAnalysisSecondsToAnalyze seconds are analyzed.
     if (m_bPreferencesFastAnalysis) {
         m_iMaxSamplesToProcess =
-                mixxx::kFastAnalysisSecondsToAnalyze * m_iSampleRate * mixxx::kAnalysisChannels;
+                mixxx::kFastAnalysisSecondsToAnalyze * decimatedSampleRate *
+                mixxx::kAnalysisChannels;
     } else {
         m_iMaxSamplesToProcess = m_iTotalSamples;
     }
     m_iCurrentSample = 0;
 
-    // if we can load a stored track don't reanalyze it
-    bool bShouldAnalyze = shouldAnalyze(tio);
-
-
     DEBUG_ASSERT(!m_pPlugin);
-    if (bShouldAnalyze) {
-        if (m_pluginId == mixxx::AnalyzerQueenMaryBeats::pluginInfo().id) {
-            m_pPlugin = std::make_unique<mixxx::AnalyzerQueenMaryBeats>();
-        } else if (m_pluginId == mixxx::AnalyzerSoundTouchBeats::pluginInfo().id) {
-            m_pPlugin = std::make_unique<mixxx::AnalyzerSoundTouchBeats>();
-        } else {
-            // This must not happen, because we have already verified above
-            // that the PlugInId is valid
-            DEBUG_ASSERT(false);
-        }
+    if (m_pluginId == mixxx::AnalyzerQueenMaryBeats::pluginInfo().id) {
+        m_pPlugin = std::make_unique<mixxx::AnalyzerQueenMaryBeats>();
+    } else if (m_pluginId == mixxx::AnalyzerSoundTouchBeats::pluginInfo().id) {
+        m_pPlugin = std::make_unique<mixxx::AnalyzerSoundTouchBeats>();
+    } else {
+        // This must not happen, because we have already verified above
+        // that the PlugInId is valid
+        DEBUG_ASSERT(false);
+        return false;
+    }
 
-        if (m_pPlugin) {
-            if (m_pPlugin->initialize(sampleRate)) {
-                qDebug() << "Beat calculation started with plugin" << m_pluginId;
-            } else {
-                qDebug() << "Beat calculation will not start.";
-                m_pPlugin.reset();
-                bShouldAnalyze = false;
-            }
-        } else {
-            bShouldAnalyze = false;
-        }
+    if (!m_pPlugin->initialize(decimatedSampleRate)) {
+        qDebug() << "Beat calculation will not start.";
+        m_pPlugin.reset();
+        return false;
     }
-    return bShouldAnalyze;
+    qDebug() << "Beat calculation started with plugin" << m_pluginId
+             << "at sample rate" << decimatedSampleRate;
+    return true;
+}
+
+int AnalyzerBeats::minSampleRate() const {
+    return mixxx::kAnalysisBandLimitedSampleRate;
 }
 
 bool AnalyzerBeats::shouldAnalyze(TrackPointer tio) const {
-    int iMinBpm = m_bpmSettings.getBpmRangeStart();
-    int iMaxBpm = m_bpmSettings.getBpmRangeEnd();
+    bool bPreferencesBeatDetectionEnabled =
+            m_enforceBpmDetection || m_bpmSettings.getBpmDetectionEnabled();
+    if (!bPreferencesBeatDetectionEnabled) {
+        qDebug() << "Beat calculation is deactivated";
+        return false;
+    }
 
     bool bpmLock = tio->isBpmLocked();
     if (bpmLock) {
@@ -172,21 +165,24 @@ bool AnalyzerBeats::shouldAnalyze(TrackPointer tio) const {
     }
 
     // Version check
+    // Only the current settings are relevant, because this is invoked
+    // before initialize().
+    const bool bPreferencesFixedTempo = m_bpmSettings.getFixedTempoAssumption();
     QString version = pBeats->getVersion();
     QString subVersion = pBeats->getSubVersion();
     QHash<QString, QString> extraVersionInfo = getExtraVersionInfo(
             pluginID,
-            m_bPreferencesFastAnalysis);
+            m_bpmSettings.getFastAnalysis());
     QString newVersion = BeatFactory::getPreferredVersion(
-            m_bPreferencesOffsetCorrection);
+            bPreferencesFixedTempo);
     QString newSubVersion = BeatFactory::getPreferredSubVersion(
-            m_bPreferencesFixedTempo,
-            m_bPreferencesOffsetCorrection,
-            iMinBpm,
-            iMaxBpm,
+            bPreferencesFixedTempo,
+            m_bpmSettings.getFixedTempoOffsetCorrection(),
+            m_bpmSettings.getBpmRangeStart(),
+            m_bpmSettings.getBpmRangeEnd(),
             extraVersionInfo);
     if (subVersion == mixxx::rekordboxconstants::beatsSubversion) {
-        return m_bPreferencesReanalyzeImported;
+        return m_bpmSettings.getReanalyzeImported();
     }
     if (version == newVersion && subVersion == newSubVersion) {
         // If the version and settings have not changed then if the world is
@@ -194,7 +190,7 @@ bool AnalyzerBeats::shouldAnalyze(TrackPointer tio) const {
         return false;
     }
     // Beat grid exists but version and settings differ
-    if (!m_bPreferencesReanalyzeOldBpm) {
+    if (!m_bpmSettings.getReanalyzeWhenSettingsChange()) {
         qDebug() << "Beat calculation skips analyzing because the track has"
                 << "a BPM computed by a previous Mixxx version and user"
                 << "preferences indicate we should not change it.";
@@ -234,6 +230,13 @@ void AnalyzerBeats::storeResults(TrackPointer tio) {
     mixxx::BeatsPointer pBeats;
     if (m_pPlugin->supportsBeatTracking()) {
         QVector<double> beats = m_pPlugin->getBeats();
+        // Map the frame positions of the decimated signal back
+        // onto the original signal
+        if (m_iDecimationFactor > 1) {
+            for (auto& beat : beats) {
+                beat *= m_iDecimationFactor;
+            }
+        }
         QHash<QString, QString> extraVersionInfo = getExtraVersionInfo(
                 m_pluginId, m_bPreferencesFastAnalysis);
         pBeats = BeatFactory::makePreferredBeats(
@@ -287,7 +290,7 @@ void AnalyzerBeats::storeResults(TrackPointer tio) {
     double currentFirstBeat = pCurrentBeats->findNextBeat(0);
     double newFirstBeat = pBeats->findNextBeat(0);
     if (currentFirstBeat == 0.0 && newFirstBeat > 0) {
-        pCurrentBeats->translate(newFirstBeat);
+        tio->setBeats(pCurrentBeats->translate(newFirstBeat));
     }
 }
 
@@ -26,13 +26,14 @@ class AnalyzerBeats : public Analyzer {
     static QList<mixxx::AnalyzerPluginInfo> availablePlugins();
     static mixxx::AnalyzerPluginInfo defaultPlugin();
 
+    bool shouldAnalyze(TrackPointer tio) const override;
     bool initialize(TrackPointer tio, int sampleRate, int totalSamples) override;
+    int minSampleRate() const override;
     bool processSamples(const CSAMPLE *pIn, const int iLen) override;
     void storeResults(TrackPointer tio) override;
     void cleanup() override;
 
   private:
-    bool shouldAnalyze(TrackPointer tio) const;
     static QHash<QString, QString> getExtraVersionInfo(
             const QString& pluginId, bool bPreferencesFastAnalysis);
 
@@ -48,6 +49,7 @@ class AnalyzerBeats : public Analyzer {
 
     int m_iSampleRate;
     int m_iTotalSamples;
+    int m_iDecimationFactor;
     int m_iMaxSamplesToProcess;
     int m_iCurrentSample;
     int m_iMinBpm, m_iMaxBpm;
@@ -0,0 +1,142 @@
+#include "analyzer/analyzerdecimator.h"
+
+#include <algorithm>
+
+#include "util/assert.h"
+#include "util/math.h"
+
+namespace mixxx {
+
+namespace {
+
+// The cutoff frequency relative to the Nyquist frequency of the decimated
+// signal. Aliasing is restricted to the upper end of the spectrum that is
+// irrelevant for beat and key detection.
+constexpr double kRelativeCutoffFrequency = 0.9;
+
+// Blackman window with ~75 dB stopband attenuation
+double blackmanWindow(SINT index, SINT length) {
+    const double phase = 2 * M_PI * index / (length - 1);
+    return 0.42 - 0.5 * cos(phase) + 0.08 * cos(2 * phase);
+}
+
+double sinc(double x) {
+    if (x == 0.0) {
+        return 1.0;
+    }
+    return sin(M_PI * x) / (M_PI * x);
+}
+
+} // anonymous namespace
+
+// static
+int AnalyzerDecimator::decimationFactor(int sampleRate, int minSampleRate) {
+    if (minSampleRate <= 0 || sampleRate < 2 * minSampleRate) {
+        return 1;
+    }
+    return sampleRate / minSampleRate;
+}
+
+AnalyzerDecimator::AnalyzerDecimator(int factor)
+        : m_factor(factor),
+          m_phaseCoefficients(factor),
+          // The symmetric filter has an odd length and the last of the
+          // kTapsPerPhase * factor coefficients is always zero.
+          m_delayFrames(kTapsPerPhase * factor / 2 - 1) {
+    DEBUG_ASSERT(m_factor >= 1);
+    const SINT filterLength = 2 * m_delayFrames + 1;
+    const double cutoff = kRelativeCutoffFrequency * 0.5 / m_factor;
+    std::vector<double> coefficients(kTapsPerPhase * m_factor, 0.0);
+    double sum = 0.0;
+    for (SINT i = 0; i < filterLength; ++i) {
+        coefficients[i] = sinc(2 * cutoff * (i - m_delayFrames)) *
+                blackmanWindow(i, filterLength);
+        sum += coefficients[i];
+    }
+    // Normalize for unity gain at DC
+    for (int phase = 0; phase < m_factor; ++phase) {
+        m_phaseCoefficients[phase].resize(kTapsPerPhase);
+        for (int tap = 0; tap < kTapsPerPhase; ++tap) {
+            m_phaseCoefficients[phase][tap] = static_cast<CSAMPLE>(
+                    coefficients[tap * m_factor + phase] / sum);
+        }
+    }
+    reset();
+}
+
+void AnalyzerDecimator::reset() {
+    // Prepend silence to compensate the filter delay
+    m_inputFrames.assign(m_delayFrames, CSAMPLE_ZERO);
+}
+
+SampleBuffer::ReadableSlice AnalyzerDecimator::process(
+        const CSAMPLE* pIn,
+        SINT numSamples) {
+    DEBUG_ASSERT(numSamples % kAnalysisChannels == 0);
+    const SINT numFrames = numSamples / kAnalysisChannels;
+    const SINT offset = m_inputFrames.size();
+    m_inputFrames.resize(offset + numFrames);
+    CSAMPLE* pInputFrames = m_inputFrames.data() + offset;
+    for (SINT i = 0; i < numFrames; ++i) {
+        CSAMPLE sum = CSAMPLE_ZERO;
+        for (int channel = 0; channel < kAnalysisChannels; ++channel) {
+            sum += pIn[i * kAnalysisChannels + channel];
+        }
+        pInputFrames[i] = sum / kAnalysisChannels;
+    }
+    return decimateBufferedFrames();
+}
+
+SampleBuffer::ReadableSlice AnalyzerDecimator::finish() {
+    // Append silence until all buffered input frames have passed
+    // the center of the filter
+    m_inputFrames.resize(m_inputFrames.size() + m_delayFrames + 1, CSAMPLE_ZERO);
+    return decimateBufferedFrames();
+}
+
+SampleBuffer::ReadableSlice AnalyzerDecimator::decimateBufferedFrames() {
+    const SINT filterLength = kTapsPerPhase * m_factor;
+    const auto numBufferedFrames = static_cast<SINT>(m_inputFrames.size());
+    if (numBufferedFrames < filterLength) {
+        return SampleBuffer::ReadableSlice();
+    }
+    const SINT numOutputFrames = (numBufferedFrames - filterLength) / m_factor + 1;
+    const SINT numPhaseFrames = numOutputFrames + kTapsPerPhase - 1;
+    m_phaseFrames.resize(numPhaseFrames);
+    m_outputFrames.assign(numOutputFrames, CSAMPLE_ZERO);
+    m_outputSamples.resize(numOutputFrames * kAnalysisChannels);
+
+    CSAMPLE* pOutput = m_outputFrames.data();
+    for (int phase = 0; phase < m_factor; ++phase) {
+        // Split the input frames of this phase into a contiguous buffer
+        const CSAMPLE* pInput = m_inputFrames.data() + phase;
+        CSAMPLE* pPhase = m_phaseFrames.data();
+        for (SINT i = 0; i < numPhaseFrames; ++i) {
+            pPhase[i] = pInput[i * m_factor];
+        }
+        const auto& coefficients = m_phaseCoefficients[phase];
+        for (int tap = 0; tap < kTapsPerPhase; ++tap) {
+            const CSAMPLE coefficient = coefficients[tap];
+            const CSAMPLE* pTap = pPhase + tap;
+            // note: LOOP VECTORIZED.
+            for (SINT i = 0; i < numOutputFrames; ++i) {
+                pOutput[i] += coefficient * pTap[i];
+            }
+        }
+    }
+    for (SINT i = 0; i < numOutputFrames; ++i) {
+        for (int channel = 0; channel < kAnalysisChannels; ++channel) {
+            m_outputSamples[i * kAnalysisChannels + channel] = pOutput[i];
+        }
+    }
+    // Keep the input frames that are still needed for the next output frames
+    m_inputFrames.erase(
+            m_inputFrames.begin(),
+            m_inputFrames.begin() + numOutputFrames * m_factor);
+
+    return SampleBuffer::ReadableSlice(
+            m_outputSamples.data(),
+            static_cast<SINT>(m_outputSamples.size()));
+}
+
+} // namespace mixxx
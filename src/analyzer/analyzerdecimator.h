@@ -0,0 +1,75 @@
+#pragma once
+
+#include <vector>
+
+#include "analyzer/constants.h"
+#include "util/samplebuffer.h"
+#include "util/types.h"
+
+namespace mixxx {
+
+// Reduces the sample rate of the decoded stereo signal by an integer
+// factor for analyzers that don't need the full bandwidth, e.g. beat and
+// key detection of high resolution audio files.
+//
+// All of those analyzers only analyze a mono downmix. The signal is
+// downmixed before filtering to halve the work and the output contains
+// the decimated mono signal in all channels.
+//
+// The signal is low-pass filtered by a windowed-sinc FIR filter in
+// polyphase form, i.e. only every n-th output sample is calculated. The
+// input is split into one contiguous sequence per phase such that the
+// filter loops run over adjacent samples and can be vectorized by the
+// compiler.
+//
+// The filter delay is compensated, i.e. the n-th output frame is aligned
+// with the (n * factor)-th input frame.
+class AnalyzerDecimator final {
+  public:
+    // The number of filter coefficients per phase, i.e. the number of
+    // multiply-accumulate operations per input frame.
+    static constexpr int kTapsPerPhase = 32;
+
+    // Returns the largest factor that keeps the decimated sample rate at
+    // or above minSampleRate. The factor is 1 if the signal should not be
+    // decimated, including minSampleRate <= 0.
+    static int decimationFactor(int sampleRate, int minSampleRate);
+
+    explicit AnalyzerDecimator(int factor);
+
+    int factor() const {
+        return m_factor;
+    }
+
+    // Discards all buffered samples before decimating the next track.
+    void reset();
+
+    // Decimates the next chunk of interleaved stereo samples. The returned
+    // slice is valid until the next invocation and might be empty if not
+    // enough samples have been buffered yet.
+    SampleBuffer::ReadableSlice process(
+            const CSAMPLE* pIn,
+            SINT numSamples);
+
+    // Decimates all remaining buffered samples at the end of the track.
+    SampleBuffer::ReadableSlice finish();
+
+  private:
+    SampleBuffer::ReadableSlice decimateBufferedFrames();
+
+    const int m_factor;
+    // The filter length is kTapsPerPhase * m_factor. The coefficients are
+    // stored separately for each phase.
+    std::vector<std::vector<CSAMPLE>> m_phaseCoefficients;
+    // The delay of the linear phase filter in input frames
+    const SINT m_delayFrames;
+
+    // Downmixed input frames that have not been consumed yet
+    std::vector<CSAMPLE> m_inputFrames;
+    // Temporary buffers that are reused between invocations
+    std::vector<CSAMPLE> m_phaseFrames;
+    std::vector<CSAMPLE> m_outputFrames;
+    std::vector<CSAMPLE> m_outputSamples;
+};
+
+} // namespace mixxx
@@ -20,10 +20,15 @@ AnalyzerEbur128::~AnalyzerEbur128() {
     cleanup(); // ...to prevent memory leaks
 }
 
+bool AnalyzerEbur128::shouldAnalyze(TrackPointer tio) const {
+    return !m_rgSettings.isAnalyzerDisabled(2, tio);
+}
+
 bool AnalyzerEbur128::initialize(TrackPointer tio,
         int sampleRate,
         int totalSamples) {
-    if (m_rgSettings.isAnalyzerDisabled(2, tio) || totalSamples == 0) {
+    Q_UNUSED(tio);
+    if (totalSamples == 0) {
         qDebug() << "Skipping AnalyzerEbur128";
         return false;
     }
@@ -76,5 +81,6 @@ void AnalyzerEbur128::storeResults(TrackPointer tio) {
     mixxx::ReplayGain replayGain(tio->getReplayGain());
     replayGain.setRatio(db2ratio(fReplayGain2));
     tio->setReplayGain(replayGain);
+    tio->setReplayGainVersion(ReplayGainSettings::getAnalyzerVersionId(2));
     qDebug() << "ReplayGain 2.0 (libebur128) result is" << fReplayGain2 << "dB for" << tio->getFileInfo();
 }
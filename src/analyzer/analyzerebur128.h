@@ -14,6 +14,7 @@ class AnalyzerEbur128 : public Analyzer {
         return rgSettings.isAnalyzerEnabled(2);
     }
 
+    bool shouldAnalyze(TrackPointer tio) const override;
     bool initialize(TrackPointer tio, int sampleRate, int totalSamples) override;
     bool processSamples(const CSAMPLE* pIn, const int iLen) override;
     void storeResults(TrackPointer tio) override;
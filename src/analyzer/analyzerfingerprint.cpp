@@ -0,0 +1,61 @@
+#include "analyzer/analyzerfingerprint.h"
+
+#include <QtDebug>
+
+#include "analyzer/constants.h"
+#include "musicbrainz/chromaprinter.h"
+#include "track/track.h"
+
+namespace {
+
+const ConfigKey kAnalyzeFingerprintConfigKey("[Library]", "AnalyzeFingerprint");
+
+} // anonymous namespace
+
+AnalyzerFingerprint::AnalyzerFingerprint() = default;
+
+AnalyzerFingerprint::~AnalyzerFingerprint() = default;
+
+// static
+bool AnalyzerFingerprint::isEnabled(UserSettingsPointer pConfig) {
+    return pConfig->getValue(kAnalyzeFingerprintConfigKey, false);
+}
+
+bool AnalyzerFingerprint::shouldAnalyze(TrackPointer pTrack) const {
+    // The fingerprint only depends on the audio data
+    return pTrack->getFingerprint().isEmpty();
+}
+
+bool AnalyzerFingerprint::initialize(TrackPointer pTrack, int sampleRate, int totalSamples) {
+    Q_UNUSED(pTrack);
+    if (totalSamples == 0) {
+        return false;
+    }
+    DEBUG_ASSERT(!m_pStream);
+    m_pStream = std::make_unique<ChromaPrintStream>(
+            sampleRate, mixxx::kAnalysisChannels);
+    return true;
+}
+
+bool AnalyzerFingerprint::processSamples(const CSAMPLE* pIn, const int iLen) {
+    VERIFY_OR_DEBUG_ASSERT(m_pStream) {
+        return false;
+    }
+    // Samples after the fingerprinted range are ignored by the stream
+    return m_pStream->feed(pIn, iLen);
+}
+
+void AnalyzerFingerprint::storeResults(TrackPointer pTrack) {
+    VERIFY_OR_DEBUG_ASSERT(m_pStream) {
+        return;
+    }
+    const QString fingerprint = m_pStream->finish();
+    if (fingerprint.isEmpty()) {
+        return;
+    }
+    pTrack->setFingerprint(fingerprint);
+}
+
+void AnalyzerFingerprint::cleanup() {
+    m_pStream.reset();
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <memory>
+
+#include "analyzer/analyzer.h"
+#include "preferences/usersettings.h"
+
+class ChromaPrintStream;
+
+// Calculates the Chromaprint fingerprint of a track from the samples that
+// are decoded for the other analyzers anyway, so that neither MusicBrainz
+// lookups nor duplicate detection need to decode the track again.
+class AnalyzerFingerprint : public Analyzer {
+  public:
+    AnalyzerFingerprint();
+    ~AnalyzerFingerprint() override;
+
+    static bool isEnabled(UserSettingsPointer pConfig);
+
+    bool shouldAnalyze(TrackPointer pTrack) const override;
+    bool initialize(TrackPointer pTrack, int sampleRate, int totalSamples) override;
+    bool processSamples(const CSAMPLE* pIn, const int iLen) override;
+    void storeResults(TrackPointer pTrack) override;
+    void cleanup() override;
+
+  private:
+    std::unique_ptr<ChromaPrintStream> m_pStream;
+};
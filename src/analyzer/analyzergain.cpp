@@ -21,8 +21,13 @@ AnalyzerGain::~AnalyzerGain() {
     delete m_pReplayGain;
 }
 
+bool AnalyzerGain::shouldAnalyze(TrackPointer tio) const {
+    return !m_rgSettings.isAnalyzerDisabled(1, tio);
+}
+
 bool AnalyzerGain::initialize(TrackPointer tio, int sampleRate, int totalSamples) {
-    if (m_rgSettings.isAnalyzerDisabled(1, tio) || totalSamples == 0) {
+    Q_UNUSED(tio);
+    if (totalSamples == 0) {
         qDebug() << "Skipping AnalyzerGain";
         return false;
     }
@@ -65,5 +70,6 @@ void AnalyzerGain::storeResults(TrackPointer tio) {
     mixxx::ReplayGain replayGain(tio->getReplayGain());
     replayGain.setRatio(db2ratio(fReplayGainOutput));
     tio->setReplayGain(replayGain);
+    tio->setReplayGainVersion(ReplayGainSettings::getAnalyzerVersionId(1));
     qDebug() << "ReplayGain 1.0 result is" << fReplayGainOutput << "dB for" << tio->getLocation();
 }
@@ -21,6 +21,7 @@ class AnalyzerGain : public Analyzer {
         return rgSettings.isAnalyzerEnabled(1);
     }
 
+    bool shouldAnalyze(TrackPointer tio) const override;
     bool initialize(TrackPointer tio, int sampleRate, int totalSamples) override;
     bool processSamples(const CSAMPLE* pIn, const int iLen) override;
     void storeResults(TrackPointer tio) override;
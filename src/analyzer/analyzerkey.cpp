@@ -34,6 +34,7 @@ AnalyzerKey::AnalyzerKey(const KeyDetectionSettings& keySettings)
         : m_keySettings(keySettings),
           m_iSampleRate(0),
           m_iTotalSamples(0),
+          m_iDecimationFactor(1),
           m_iMaxSamplesToProcess(0),
           m_iCurrentSample(0),
           m_bPreferencesKeyDetectionEnabled(true),
@@ -42,16 +43,12 @@ AnalyzerKey::AnalyzerKey(const KeyDetectionSettings& keySettings)
 }
 
 bool AnalyzerKey::initialize(TrackPointer tio, int sampleRate, int totalSamples) {
+    Q_UNUSED(tio);
     if (totalSamples == 0) {
         return false;
     }
 
     m_bPreferencesKeyDetectionEnabled = m_keySettings.getKeyDetectionEnabled();
-    if (!m_bPreferencesKeyDetectionEnabled) {
-        qDebug() << "Key detection is deactivated";
-        return false;
-    }
-
     m_bPreferencesFastAnalysisEnabled = m_keySettings.getFastAnalysis();
     m_bPreferencesReanalyzeEnabled = m_keySettings.getReanalyzeWhenSettingsChange();
 
@@ -74,48 +71,54 @@ bool AnalyzerKey::initialize(TrackPointer tio, int sampleRate, int totalSamples)
 
     m_iSampleRate = sampleRate;
     m_iTotalSamples = totalSamples;
+    // The plugin receives the decimated signal, see minSampleRate()
+    m_iDecimationFactor = mixxx::AnalyzerDecimator::decimationFactor(
+            sampleRate, minSampleRate());
+    const int decimatedSampleRate = sampleRate / m_iDecimationFactor;
     // In fast analysis mode, skip processing after
     // kFastAnalysisSecondsToAnalyze seconds are analyzed.
     if (m_bPreferencesFastAnalysisEnabled) {
-        m_iMaxSamplesToProcess = mixxx::kFastAnalysisSecondsToAnalyze * m_iSampleRate * mixxx::kAnalysisChannels;
+        m_iMaxSamplesToProcess = mixxx::kFastAnalysisSecondsToAnalyze *
+                decimatedSampleRate * mixxx::kAnalysisChannels;
     } else {
         m_iMaxSamplesToProcess = m_iTotalSamples;
     }
     m_iCurrentSample = 0;
 
-    // if we can't load a stored track reanalyze it
-    bool bShouldAnalyze = shouldAnalyze(tio);
-
     DEBUG_ASSERT(!m_pPlugin);
-    if (bShouldAnalyze) {
-        if (m_pluginId == mixxx::AnalyzerQueenMaryKey::pluginInfo().id) {
-            m_pPlugin = std::make_unique<mixxx::AnalyzerQueenMaryKey>();
+    if (m_pluginId == mixxx::AnalyzerQueenMaryKey::pluginInfo().id) {
+        m_pPlugin = std::make_unique<mixxx::AnalyzerQueenMaryKey>();
 #if defined __KEYFINDER__
-        } else if (m_pluginId == mixxx::AnalyzerKeyFinder::pluginInfo().id) {
-            m_pPlugin = std::make_unique<mixxx::AnalyzerKeyFinder>();
+    } else if (m_pluginId == mixxx::AnalyzerKeyFinder::pluginInfo().id) {
+        m_pPlugin = std::make_unique<mixxx::AnalyzerKeyFinder>();
 #endif
-        } else {
-            // This must not happen, because we have already verified above
-            // that the PlugInId is valid
-            DEBUG_ASSERT(false);
-        }
+    } else {
+        // This must not happen, because we have already verified above
+        // that the PlugInId is valid
+        DEBUG_ASSERT(false);
+        return false;
+    }
 
-        if (m_pPlugin) {
-            if (m_pPlugin->initialize(sampleRate)) {
-                qDebug() << "Key calculation started with plugin" << m_pluginId;
-            } else {
-                qDebug() << "Key calculation will not start.";
-                m_pPlugin.reset();
-                bShouldAnalyze = false;
-            }
-        } else {
-            bShouldAnalyze = false;
-        }
+    if (!m_pPlugin->initialize(decimatedSampleRate)) {
+        qDebug() << "Key calculation will not start.";
+        m_pPlugin.reset();
+        return false;
     }
-    return bShouldAnalyze;
+    qDebug() << "Key calculation started with plugin" << m_pluginId
+             << "at sample rate" << decimatedSampleRate;
+    return true;
+}
+
+int AnalyzerKey::minSampleRate() const {
+    return mixxx::kAnalysisBandLimitedSampleRate;
 }
 
 bool AnalyzerKey::shouldAnalyze(TrackPointer tio) const {
+    if (!m_keySettings.getKeyDetectionEnabled()) {
+        qDebug() << "Key detection is deactivated";
+        return false;
+    }
+
     bool bPreferencesFastAnalysisEnabled = m_keySettings.getFastAnalysis();
     QString pluginID = m_keySettings.getKeyPluginId();
     if (pluginID.isEmpty()) {
@@ -138,7 +141,7 @@ bool AnalyzerKey::shouldAnalyze(TrackPointer tio) const {
             qDebug() << "Keys version/sub-version unchanged since previous analysis. Not analyzing.";
             return false;
         }
-        if (!m_bPreferencesReanalyzeEnabled) {
+        if (!m_keySettings.getReanalyzeWhenSettingsChange()) {
             qDebug() << "Track has previous key detection result that is not up"
                      << "to date with latest settings but user preferences"
                      << "indicate we should not re-analyze it.";
@@ -176,6 +179,13 @@ void AnalyzerKey::storeResults(TrackPointer tio) {
     }
 
     KeyChangeList key_changes = m_pPlugin->getKeyChanges();
+    // Map the frame positions of the decimated signal back
+    // onto the original signal
+    if (m_iDecimationFactor > 1) {
+        for (auto& keyChange : key_changes) {
+            keyChange.second *= m_iDecimationFactor;
+        }
+    }
     QHash<QString, QString> extraVersionInfo = getExtraVersionInfo(
             m_pluginId, m_bPreferencesFastAnalysisEnabled);
     Keys track_keys = KeyFactory::makePreferredKeys(
@@ -19,7 +19,9 @@ class AnalyzerKey : public Analyzer {
     static QList<mixxx::AnalyzerPluginInfo> availablePlugins();
     static mixxx::AnalyzerPluginInfo defaultPlugin();
 
+    bool shouldAnalyze(TrackPointer tio) const override;
     bool initialize(TrackPointer tio, int sampleRate, int totalSamples) override;
+    int minSampleRate() const override;
     bool processSamples(const CSAMPLE *pIn, const int iLen) override;
     void storeResults(TrackPointer tio) override;
     void cleanup() override;
@@ -28,13 +30,13 @@ class AnalyzerKey : public Analyzer {
     static QHash<QString, QString> getExtraVersionInfo(
             const QString& pluginId, bool bPreferencesFastAnalysis);
 
-    bool shouldAnalyze(TrackPointer tio) const;
 
     KeyDetectionSettings m_keySettings;
     std::unique_ptr<mixxx::AnalyzerKeyPlugin> m_pPlugin;
     QString m_pluginId;
     int m_iSampleRate;
     int m_iTotalSamples;
+    int m_iDecimationFactor;
     int m_iMaxSamplesToProcess;
     int m_iCurrentSample;
 
@@ -10,17 +10,6 @@ constexpr CSAMPLE kSilenceThreshold = 0.001f;
 // TODO: Change the above line to:
 //constexpr CSAMPLE kSilenceThreshold = db2ratio(-60.0f);
 
-bool shouldAnalyze(TrackPointer pTrack) {
-    CuePointer pIntroCue = pTrack->findCueByType(mixxx::CueType::Intro);
-    CuePointer pOutroCue = pTrack->findCueByType(mixxx::CueType::Outro);
-    CuePointer pAudibleSound = pTrack->findCueByType(mixxx::CueType::AudibleSound);
-
-    if (!pIntroCue || !pOutroCue || !pAudibleSound || pAudibleSound->getLength() <= 0) {
-        return true;
-    }
-    return false;
-}
-
 } // anonymous namespace
 
 AnalyzerSilence::AnalyzerSilence(UserSettingsPointer pConfig)
@@ -32,14 +21,22 @@ AnalyzerSilence::AnalyzerSilence(UserSettingsPointer pConfig)
           m_iSignalEnd(-1) {
 }
 
+bool AnalyzerSilence::shouldAnalyze(TrackPointer pTrack) const {
+    CuePointer pIntroCue = pTrack->findCueByType(mixxx::CueType::Intro);
+    CuePointer pOutroCue = pTrack->findCueByType(mixxx::CueType::Outro);
+    CuePointer pAudibleSound = pTrack->findCueByType(mixxx::CueType::AudibleSound);
+
+    if (!pIntroCue || !pOutroCue || !pAudibleSound || pAudibleSound->getLength() <= 0) {
+        return true;
+    }
+    return false;
+}
+
 bool AnalyzerSilence::initialize(TrackPointer pTrack, int sampleRate, int totalSamples) {
+    Q_UNUSED(pTrack);
     Q_UNUSED(sampleRate);
     Q_UNUSED(totalSamples);
 
-    if (!shouldAnalyze(pTrack)) {
-        return false;
-    }
-
     m_iFramesProcessed = 0;
     m_bPrevSilence = true;
     m_iSignalStart = -1;
@@ -10,6 +10,7 @@ class AnalyzerSilence : public Analyzer {
     explicit AnalyzerSilence(UserSettingsPointer pConfig);
     ~AnalyzerSilence() override = default;
 
+    bool shouldAnalyze(TrackPointer pTrack) const override;
     bool initialize(TrackPointer pTrack, int sampleRate, int totalSamples) override;
     bool processSamples(const CSAMPLE* pIn, const int iLen) override;
     void storeResults(TrackPointer pTrack) override;
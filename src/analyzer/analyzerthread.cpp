@@ -1,9 +1,11 @@
 #include "analyzer/analyzerthread.h"
 
+#include <algorithm>
 #include <mutex>
 
 #include "analyzer/analyzerbeats.h"
 #include "analyzer/analyzerebur128.h"
+#include "analyzer/analyzerfingerprint.h"
 #include "analyzer/analyzergain.h"
 #include "analyzer/analyzerkey.h"
 #include "analyzer/analyzersilence.h"
@@ -117,6 +119,9 @@ void AnalyzerThread::doRun() {
     m_analyzers.push_back(AnalyzerWithState(std::make_unique<AnalyzerBeats>(m_pConfig, enforceBpmDetection)));
     m_analyzers.push_back(AnalyzerWithState(std::make_unique<AnalyzerKey>(m_pConfig)));
     m_analyzers.push_back(AnalyzerWithState(std::make_unique<AnalyzerSilence>(m_pConfig)));
+    if (AnalyzerFingerprint::isEnabled(m_pConfig)) {
+        m_analyzers.push_back(AnalyzerWithState(std::make_unique<AnalyzerFingerprint>()));
+    }
     DEBUG_ASSERT(!m_analyzers.empty());
     kLogger.debug() << "Activated" << m_analyzers.size() << "analyzers";
 
@@ -125,8 +130,29 @@ void AnalyzerThread::doRun() {
     mixxx::AudioSource::OpenParams openParams;
     openParams.setChannelCount(mixxx::kAnalysisChannels);
 
+    // The analyzers with outdated or missing results for the current track
+    std::vector<bool> staleAnalyzers(m_analyzers.size());
+
     while (awaitWorkItemsFetched()) {
         DEBUG_ASSERT(m_currentTrack);
+
+        // Decide which analyzers need to run before opening the file.
+        // Decoding is the most expensive part of the analysis and should
+        // be avoided for tracks with up-to-date results, e.g. when
+        // re-analyzing the whole library after changing a single setting.
+        bool anyAnalyzerStale = false;
+        for (std::size_t i = 0; i < m_analyzers.size(); ++i) {
+            staleAnalyzers[i] = m_analyzers[i].shouldAnalyze(m_currentTrack);
+            anyAnalyzerStale = anyAnalyzerStale || staleAnalyzers[i];
+        }
+        if (!anyAnalyzerStale) {
+            kLogger.debug()
+                    << "Skipping track analysis because all results are up-to-date:"
+                    << m_currentTrack->getFileInfo();
+            emitDoneProgress(kAnalyzerProgressDone);
+            continue;
+        }
+
         kLogger.debug() << "Analyzing" << m_currentTrack->getFileInfo();
 
         // Get the audio
@@ -141,9 +167,12 @@ void AnalyzerThread::doRun() {
         }
 
         bool processTrack = false;
-        for (auto&& analyzer : m_analyzers) {
+        for (std::size_t i = 0; i < m_analyzers.size(); ++i) {
+            if (!staleAnalyzers[i]) {
+                continue;
+            }
             // Make sure not to short-circuit initialize(...)
-            if (analyzer.initialize(
+            if (m_analyzers[i].initialize(
                         m_currentTrack,
                         audioSource->getSignalInfo().getSampleRate(),
                         audioSource->frameLength() * mixxx::kAnalysisChannels)) {
@@ -152,6 +181,7 @@ void AnalyzerThread::doRun() {
         }
 
         if (processTrack) {
+            initDecimators();
             const auto analysisResult = analyzeAudioSource(audioSource);
             DEBUG_ASSERT(analysisResult != AnalysisResult::Pending);
             if (analysisResult == AnalysisResult::Finished) {
@@ -298,11 +328,9 @@ AnalyzerThread::AnalysisResult AnalyzerThread::analyzeAudioSource(
 
         // 2nd: step: Analyze chunk of decoded audio data
         if (!readableSampleFrames.frameIndexRange().empty()) {
-            for (auto&& analyzer : m_analyzers) {
-                analyzer.processSamples(
-                        readableSampleFrames.readableData(),
-                        readableSampleFrames.readableLength());
-            }
+            processSamples(
+                    readableSampleFrames.readableData(),
+                    readableSampleFrames.readableLength());
         }
 
         // Don't check again for paused/stopped again and simply finish
@@ -327,9 +355,53 @@ AnalyzerThread::AnalysisResult AnalyzerThread::analyzeAudioSource(
         }
     }
 
+    // Pass the remaining samples that are delayed by the decimation filters
+    for (auto&& decimator : m_decimators) {
+        processDecimatedSamples(decimator.factor(), decimator.finish());
+    }
+
     return AnalysisResult::Finished;
 }
 
+void AnalyzerThread::initDecimators() {
+    m_decimators.clear();
+    for (const auto& analyzer : m_analyzers) {
+        if (!analyzer.isActive() || analyzer.decimationFactor() <= 1) {
+            continue;
+        }
+        const auto decimationFactor = analyzer.decimationFactor();
+        if (std::none_of(m_decimators.begin(),
+                    m_decimators.end(),
+                    [decimationFactor](const mixxx::AnalyzerDecimator& decimator) {
+                        return decimator.factor() == decimationFactor;
+                    })) {
+            m_decimators.emplace_back(decimationFactor);
+        }
+    }
+}
+
+void AnalyzerThread::processSamples(const CSAMPLE* pIn, SINT numSamples) {
+    processDecimatedSamples(1, mixxx::SampleBuffer::ReadableSlice(pIn, numSamples));
+    for (auto&& decimator : m_decimators) {
+        processDecimatedSamples(
+                decimator.factor(),
+                decimator.process(pIn, numSamples));
+    }
+}
+
+void AnalyzerThread::processDecimatedSamples(
+        int decimationFactor,
+        mixxx::SampleBuffer::ReadableSlice samples) {
+    if (samples.empty()) {
+        return;
+    }
+    for (auto&& analyzer : m_analyzers) {
+        if (analyzer.decimationFactor() == decimationFactor) {
+            analyzer.processSamples(samples.data(), samples.length());
+        }
+    }
+}
+
 void AnalyzerThread::emitBusyProgress(AnalyzerProgress busyProgress) {
     DEBUG_ASSERT(m_currentTrack);
     if ((m_emittedState == AnalyzerThreadState::Busy) &&
@@ -116,6 +116,10 @@ class AnalyzerThread : public WorkerThread {
 
     std::vector<AnalyzerWithState> m_analyzers;
 
+    // Decimation stages of the current track, each shared by all
+    // analyzers that need the same decimation factor
+    std::vector<mixxx::AnalyzerDecimator> m_decimators;
+
     mixxx::SampleBuffer m_sampleBuffer;
 
     TrackPointer m_currentTrack;
@@ -132,6 +136,14 @@ class AnalyzerThread : public WorkerThread {
     AnalysisResult analyzeAudioSource(
             const mixxx::AudioSourcePointer& audioSource);
 
+    void initDecimators();
+    // Passes the decoded samples to all analyzers directly or through
+    // the corresponding decimator
+    void processSamples(const CSAMPLE* pIn, SINT numSamples);
+    void processDecimatedSamples(
+            int decimationFactor,
+            mixxx::SampleBuffer::ReadableSlice samples);
+
     // Blocks the worker thread until a next track becomes available
     TrackPointer receiveNextTrack();
 
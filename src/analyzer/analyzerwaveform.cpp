@@ -40,11 +40,6 @@ bool AnalyzerWaveform::initialize(TrackPointer tio, int sampleRate, int totalSam
         return false;
     }
 
-    // If we don't need to calculate the waveform/wavesummary, skip.
-    if (!shouldAnalyze(tio)) {
-        return false;
-    }
-
     m_timer.start();
 
     // Now actually initialize the AnalyzerWaveform:
@@ -141,13 +141,13 @@ class AnalyzerWaveform : public Analyzer {
             const QSqlDatabase& dbConnection);
     ~AnalyzerWaveform() override;
 
+    bool shouldAnalyze(TrackPointer tio) const override;
     bool initialize(TrackPointer tio, int sampleRate, int totalSamples) override;
     bool processSamples(const CSAMPLE* buffer, const int bufferLength) override;
     void storeResults(TrackPointer tio) override;
     void cleanup() override;
 
   private:
-    bool shouldAnalyze(TrackPointer tio) const;
 
     void storeCurrentStridePower();
     void resetCurrentStride();
@@ -16,4 +16,10 @@ constexpr SINT kAnalysisSamplesPerChunk =
 // Only analyze the first minute in fast-analysis mode.
 constexpr int kFastAnalysisSecondsToAnalyze = 60;
 
+// Beat and key detection don't gain any accuracy from the bandwidth of
+// high resolution audio. Those analyzers receive the signal decimated by
+// an integer factor, e.g. from 96 kHz to 48 kHz or from 88.2 kHz to
+// 44.1 kHz, while the results for CD quality audio remain unaffected.
+constexpr int kAnalysisBandLimitedSampleRate = 44100;
+
 }  // namespace mixxx
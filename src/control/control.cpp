@@ -8,15 +8,14 @@
 UserSettingsPointer ControlDoublePrivate::s_pUserConfig;
 
 //static
-QHash<ConfigKey, QWeakPointer<ControlDoublePrivate>> ControlDoublePrivate::s_qCOHash
-        GUARDED_BY(ControlDoublePrivate::s_qCOHashMutex);
+ControlRegistry ControlDoublePrivate::s_registry;
 
 //static
 QHash<ConfigKey, ConfigKey> ControlDoublePrivate::s_qCOAliasHash
-        GUARDED_BY(ControlDoublePrivate::s_qCOHashMutex);
+        GUARDED_BY(ControlDoublePrivate::s_qCOAliasHashMutex);
 
 //static
-MMutex ControlDoublePrivate::s_qCOHashMutex;
+MMutex ControlDoublePrivate::s_qCOAliasHashMutex;
 
 ControlDoublePrivate::ControlDoublePrivate(
         const ConfigKey& key,
@@ -60,10 +59,8 @@ void ControlDoublePrivate::initialize(double defaultValue) {
 }
 
 ControlDoublePrivate::~ControlDoublePrivate() {
-    s_qCOHashMutex.lock();
-    //qDebug() << "ControlDoublePrivate::s_qCOHash.remove(" << m_key.group << "," << m_key.item << ")";
-    s_qCOHash.remove(m_key);
-    s_qCOHashMutex.unlock();
+    //qDebug() << "ControlDoublePrivate::s_registry.remove(" << m_key.group << "," << m_key.item << ")";
+    s_registry.remove(m_key, this);
 
     if (m_bPersistInConfiguration) {
         UserSettingsPointer pConfig = ControlDoublePrivate::s_pUserConfig;
@@ -75,22 +72,17 @@ ControlDoublePrivate::~ControlDoublePrivate() {
 
 // static
 void ControlDoublePrivate::insertAlias(const ConfigKey& alias, const ConfigKey& key) {
-    MMutexLocker locker(&s_qCOHashMutex);
-
-    auto it = s_qCOHash.constFind(key);
-    if (it == s_qCOHash.constEnd()) {
+    QSharedPointer<ControlDoublePrivate> pControl = s_registry.lookup(key);
+    if (pControl.isNull()) {
         qWarning() << "WARNING: ControlDoublePrivate::insertAlias called for null control" << key;
         return;
     }
 
-    QSharedPointer<ControlDoublePrivate> pControl = it.value();
-    if (pControl.isNull()) {
-        qWarning() << "WARNING: ControlDoublePrivate::insertAlias called for expired control" << key;
-        return;
+    {
+        const MMutexLocker locker(&s_qCOAliasHashMutex);
+        s_qCOAliasHash.insert(key, alias);
     }
-
-    s_qCOAliasHash.insert(key, alias);
-    s_qCOHash.insert(alias, pControl);
+    s_registry.insert(alias, pControl);
 }
 
 // static
@@ -108,40 +100,29 @@ QSharedPointer<ControlDoublePrivate> ControlDoublePrivate::getControl(
         return nullptr;
     }
 
-    // Scope for MMutexLocker.
-    {
-        const MMutexLocker locker(&s_qCOHashMutex);
-        const auto it = s_qCOHash.find(key);
-        if (it != s_qCOHash.end()) {
-            auto pControl = it.value().lock();
-            if (pControl) {
-                // Control object already exists
-                VERIFY_OR_DEBUG_ASSERT(!pCreatorCO) {
-                    qWarning()
-                            << "ControlObject"
-                            << key.group << key.item
-                            << "already created";
-                    return nullptr;
-                }
-                return pControl;
-            } else {
-                // The weak pointer has become invalid and can be cleaned up
-                s_qCOHash.erase(it);
-            }
+    auto pControl = s_registry.lookup(key);
+    if (pControl) {
+        // Control object already exists
+        VERIFY_OR_DEBUG_ASSERT(!pCreatorCO) {
+            qWarning()
+                    << "ControlObject"
+                    << key.group << key.item
+                    << "already created";
+            return nullptr;
         }
+        return pControl;
     }
 
     if (pCreatorCO) {
-        auto pControl = QSharedPointer<ControlDoublePrivate>(
+        pControl = QSharedPointer<ControlDoublePrivate>(
                 new ControlDoublePrivate(key,
                         pCreatorCO,
                         bIgnoreNops,
                         bTrack,
                         bPersist,
                         defaultValue));
-        const MMutexLocker locker(&s_qCOHashMutex);
-        //qDebug() << "ControlDoublePrivate::s_qCOHash.insert(" << key.group << "," << key.item << ")";
-        s_qCOHash.insert(key, pControl);
+        //qDebug() << "ControlDoublePrivate::s_registry.insert(" << key.group << "," << key.item << ")";
+        s_registry.insert(key, pControl);
         return pControl;
     }
 
@@ -155,34 +136,12 @@ QSharedPointer<ControlDoublePrivate> ControlDoublePrivate::getControl(
 
 // static
 QList<QSharedPointer<ControlDoublePrivate>> ControlDoublePrivate::getAllInstances() {
-    QList<QSharedPointer<ControlDoublePrivate>> result;
-    MMutexLocker locker(&s_qCOHashMutex);
-    result.reserve(s_qCOHash.size());
-    for (auto it = s_qCOHash.begin(); it != s_qCOHash.end(); ++it) {
-        auto pControl = it.value().lock();
-        if (pControl) {
-            result.append(std::move(pControl));
-        } else {
-            // The weak pointer has become invalid and can be cleaned up
-            s_qCOHash.erase(it);
-        }
-    }
-    return result;
+    return s_registry.getAll();
 }
 
 // static
 QList<QSharedPointer<ControlDoublePrivate>> ControlDoublePrivate::takeAllInstances() {
-    QList<QSharedPointer<ControlDoublePrivate>> result;
-    MMutexLocker locker(&s_qCOHashMutex);
-    result.reserve(s_qCOHash.size());
-    for (auto it = s_qCOHash.begin(); it != s_qCOHash.end(); ++it) {
-        auto pControl = it.value().lock();
-        if (pControl) {
-            result.append(std::move(pControl));
-        }
-    }
-    s_qCOHash.clear();
-    return result;
+    return s_registry.takeAll();
 }
 
 void ControlDoublePrivate::deleteCreatorCO() {
@@ -7,6 +7,7 @@
 #include <QString>
 
 #include "control/controlbehavior.h"
+#include "control/controlregistry.h"
 #include "control/controlvalue.h"
 #include "preferences/usersettings.h"
 #include "util/mutex.h"
@@ -58,12 +59,27 @@ class ControlDoublePrivate : public QObject {
             bool bPersist = false,
             double defaultValue = 0.0);
 
+    // Returns the compact handle of the ConfigKey of a control that exists or
+    // has existed, or kInvalidControlHandle. The handle remains valid if the
+    // control is deleted and created again. Lock-free.
+    static ControlHandle getHandle(const ConfigKey& key) {
+        return s_registry.findHandle(key);
+    }
+
+    // Gets the ControlDoublePrivate by a handle that was returned from
+    // getHandle(), without hashing the ConfigKey. Returns nullptr if the
+    // control does currently not exist. Lock-free.
+    static QSharedPointer<ControlDoublePrivate> getControl(ControlHandle handle) {
+        return s_registry.lookup(handle);
+    }
+
     // Returns a list of all existing instances.
     static QList<QSharedPointer<ControlDoublePrivate>> getAllInstances();
     // Clears all existing instances and returns them as a list.
     static QList<QSharedPointer<ControlDoublePrivate>> takeAllInstances();
 
     static QHash<ConfigKey, ConfigKey> getControlAliases() {
+        const MMutexLocker locker(&s_qCOAliasHashMutex);
         // Implicitly shared classes can safely be copied across threads
         return s_qCOAliasHash;
     }
@@ -214,13 +230,13 @@ class ControlDoublePrivate : public QObject {
     // configuration object would be arduous.
     static UserSettingsPointer s_pUserConfig;
 
-    // Hash of ControlDoublePrivate instantiations.
-    static QHash<ConfigKey, QWeakPointer<ControlDoublePrivate>> s_qCOHash;
+    // Registry of ControlDoublePrivate instantiations, including aliases.
+    static ControlRegistry s_registry;
 
     // Hash of aliases between ConfigKeys. Solely used for looking up the first
     // alias associated with a key.
     static QHash<ConfigKey, ConfigKey> s_qCOAliasHash;
 
-    // Mutex guarding access to s_qCOHash and s_qCOAliasHash.
-    static MMutex s_qCOHashMutex;
+    // Mutex guarding access to s_qCOAliasHash.
+    static MMutex s_qCOAliasHashMutex;
 };
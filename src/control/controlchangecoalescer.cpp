@@ -0,0 +1,71 @@
+#include "control/controlchangecoalescer.h"
+
+#include <QtAlgorithms>
+
+// static
+std::atomic<bool> ControlChangeCoalescer::s_enabled{false};
+
+// static
+ControlChangeCoalescer& ControlChangeCoalescer::instance() {
+    static ControlChangeCoalescer s_instance;
+    return s_instance;
+}
+
+ControlChangeCoalescer::ControlChangeCoalescer() {
+    for (auto& word : m_dirtyWords) {
+        word.store(0, std::memory_order_relaxed);
+    }
+}
+
+int ControlChangeCoalescer::subscribe(CoalescedControlSubscriber* pSubscriber) {
+    DEBUG_ASSERT(pSubscriber);
+    if (!m_freeIndices.empty()) {
+        const int index = m_freeIndices.back();
+        m_freeIndices.pop_back();
+        m_subscribers[index] = pSubscriber;
+        return index;
+    }
+    if (m_subscribers.size() >= kCapacity) {
+        return kInvalidIndex;
+    }
+    m_subscribers.push_back(pSubscriber);
+    return static_cast<int>(m_subscribers.size()) - 1;
+}
+
+void ControlChangeCoalescer::unsubscribe(int index) {
+    VERIFY_OR_DEBUG_ASSERT(index >= 0 &&
+            index < static_cast<int>(m_subscribers.size()) &&
+            m_subscribers[index]) {
+        return;
+    }
+    // A pending dirty bit is harmless. It may only cause a redundant delivery
+    // of the current value to the next subscriber at this index.
+    m_subscribers[index] = nullptr;
+    m_freeIndices.push_back(index);
+}
+
+int ControlChangeCoalescer::flush() {
+    int delivered = 0;
+    const int wordCount = static_cast<int>(
+            (m_subscribers.size() + kBitsPerWord - 1) / kBitsPerWord);
+    for (int wordIndex = 0; wordIndex < wordCount; ++wordIndex) {
+        auto& word = m_dirtyWords[wordIndex];
+        if (word.load(std::memory_order_relaxed) == 0) {
+            continue;
+        }
+        quint64 dirty = word.exchange(0, std::memory_order_acquire);
+        while (dirty) {
+            const int bit = qCountTrailingZeroBits(dirty);
+            dirty &= dirty - 1;
+            const int index = wordIndex * kBitsPerWord + bit;
+            // A subscriber may unsubscribe any subscriber including itself
+            // during the delivery, so look it up every time.
+            CoalescedControlSubscriber* pSubscriber = m_subscribers[index];
+            if (pSubscriber) {
+                pSubscriber->deliverCoalescedChange();
+                ++delivered;
+            }
+        }
+    }
+    return delivered;
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <QtGlobal>
+#include <array>
+#include <atomic>
+#include <vector>
+
+#include "util/assert.h"
+
+// Receives the coalesced changes of a control from the
+// ControlChangeCoalescer in the main thread.
+class CoalescedControlSubscriber {
+  public:
+    virtual ~CoalescedControlSubscriber() = default;
+
+    // Called once per GUI frame if the control has changed at least once
+    // since the previous frame. The subscriber reads the latest value itself.
+    virtual void deliverCoalescedChange() = 0;
+};
+
+// Coalesces the valueChanged() signals of controls for the GUI.
+//
+// By default every set() of a control emits a queued signal to every
+// connected widget. Controls that change with every engine callback or every
+// controller message (playposition, VU meters, jog wheels) flood the event
+// loop of the main thread with thousands of events per second, although a
+// widget only needs the latest value once per frame.
+//
+// Coalesced subscribers are marked dirty by a direct connection from the
+// thread that changes the control. Marking sets a bit in a fixed size set of
+// atomic words, which is wait-free and never allocates. flush() is called by
+// GuiTick once per frame from the main thread and delivers each dirty
+// subscriber exactly once.
+//
+// Coalescing is opt-in with the [Controls],CoalesceGuiUpdates preference.
+class ControlChangeCoalescer {
+  public:
+    static constexpr int kCapacity = 4096;
+    static constexpr int kInvalidIndex = -1;
+
+    static ControlChangeCoalescer& instance();
+
+    // Coalescing is only enabled if flush() is called periodically
+    static bool isEnabled() {
+        return s_enabled.load(std::memory_order_relaxed);
+    }
+    static void setEnabled(bool enabled) {
+        s_enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    // Returns the index of the subscriber, or kInvalidIndex if the capacity is
+    // exhausted and the caller needs to fall back to the plain signal.
+    // Must be called from the main thread.
+    int subscribe(CoalescedControlSubscriber* pSubscriber);
+    // Must be called from the main thread.
+    void unsubscribe(int index);
+
+    // Thread safe and wait-free.
+    void markDirty(int index) {
+        DEBUG_ASSERT(index >= 0 && index < kCapacity);
+        m_dirtyWords[index / kBitsPerWord].fetch_or(
+                quint64(1) << (index % kBitsPerWord),
+                std::memory_order_release);
+    }
+
+    // Delivers all changes since the previous call and returns the number of
+    // notified subscribers. Must be called from the main thread.
+    int flush();
+
+    int subscriberCount() const {
+        return static_cast<int>(m_subscribers.size() - m_freeIndices.size());
+    }
+
+  private:
+    static constexpr int kBitsPerWord = 64;
+
+    ControlChangeCoalescer();
+
+    static std::atomic<bool> s_enabled;
+
+    std::array<std::atomic<quint64>, kCapacity / kBitsPerWord> m_dirtyWords;
+    // Only accessed from the main thread
+    std::vector<CoalescedControlSubscriber*> m_subscribers;
+    std::vector<int> m_freeIndices;
+};
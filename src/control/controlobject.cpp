@@ -66,6 +66,15 @@ ControlObject* ControlObject::getControl(const ConfigKey& key, ControlFlags flag
     return nullptr;
 }
 
+// static
+ControlObject* ControlObject::getControl(ControlHandle handle) {
+    QSharedPointer<ControlDoublePrivate> pCDP = ControlDoublePrivate::getControl(handle);
+    if (pCDP) {
+        return pCDP->getCreatorCO();
+    }
+    return nullptr;
+}
+
 void ControlObject::setValueFromMidi(MidiOpCode o, double v) {
     if (m_pControl) {
         m_pControl->setValueFromMidi(o, v);
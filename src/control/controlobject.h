@@ -33,6 +33,9 @@ class ControlObject : public QObject {
         ConfigKey key(group, item);
         return getControl(key, flags);
     }
+    // Returns a pointer to the ControlObject with the given handle, see
+    // ControlDoublePrivate::getHandle(). This does not hash the ConfigKey.
+    static ControlObject* getControl(ControlHandle handle);
 
     QString name() const {
         return m_pControl ?  m_pControl->name() : QString();
@@ -3,6 +3,7 @@
 #include <QtDebug>
 
 #include "control/control.h"
+#include "control/controlchangecoalescer.h"
 #include "moc_controlproxy.cpp"
 
 ControlProxy::ControlProxy(const QString& g, const QString& i, QObject* pParent, ControlFlags flags)
@@ -41,3 +42,25 @@ void ControlProxy::initialize(ControlFlags flags) {
 ControlProxy::~ControlProxy() {
     //qDebug() << "ControlProxy::~ControlProxy()";
 }
+
+bool ControlProxy::connectValueChangedCoalesced(int subscriberIndex) {
+    if (!m_pControl) {
+        return false;
+    }
+    // The direct connection runs in the thread that changes the control. It
+    // must not touch this object, only compare its address, since it may be
+    // invoked concurrently with the destruction of this proxy. The connection
+    // is removed when this proxy is destroyed.
+    const QObject* pSelf = this;
+    return static_cast<bool>(connect(
+            m_pControl.data(),
+            &ControlDoublePrivate::valueChanged,
+            this,
+            [pSelf, subscriberIndex](double value, QObject* pSetter) {
+                Q_UNUSED(value);
+                if (pSetter != pSelf) {
+                    ControlChangeCoalescer::instance().markDirty(subscriberIndex);
+                }
+            },
+            Qt::DirectConnection));
+}
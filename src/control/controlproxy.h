@@ -108,6 +108,12 @@ class ControlProxy : public QObject {
         return true;
     }
 
+    // Marks the subscriber with the given index of the ControlChangeCoalescer
+    // as dirty whenever the control is changed by someone else. This does not
+    // emit valueChanged(). The subscriber reads the value with get() when the
+    // changes are flushed once per GUI frame.
+    bool connectValueChangedCoalesced(int subscriberIndex);
+
     // Called from update();
     virtual void emitValueChanged() {
         emit valueChanged(get());
@@ -0,0 +1,209 @@
+#include "control/controlregistry.h"
+
+#include <QtDebug>
+
+#include "control/control.h"
+#include "util/assert.h"
+
+namespace {
+
+constexpr int kInitialIndexCapacity = 4096;
+
+} // anonymous namespace
+
+ControlRegistry::Index::Index(int capacity)
+        : mask(static_cast<uint>(capacity - 1)),
+          entries(new std::atomic<int>[capacity]) {
+    DEBUG_ASSERT((capacity & (capacity - 1)) == 0);
+    for (int i = 0; i < capacity; ++i) {
+        entries[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+ControlRegistry::ControlRegistry()
+        : m_handleCount(0),
+          m_pIndex(new Index(kInitialIndexCapacity)),
+          m_activeReaders(0) {
+    for (auto& chunk : m_chunks) {
+        chunk.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+ControlRegistry::~ControlRegistry() {
+    const int handleCount = m_handleCount.load(std::memory_order_acquire);
+    for (ControlHandle handle = 0; handle < handleCount; ++handle) {
+        delete slot(handle).pRecord.load(std::memory_order_acquire);
+    }
+    for (auto& chunk : m_chunks) {
+        delete[] chunk.load(std::memory_order_acquire);
+    }
+    delete m_pIndex.load(std::memory_order_acquire);
+}
+
+ControlHandle ControlRegistry::findHandle(const ConfigKey& key) const {
+    const ReadScope readScope(this);
+    const Index* pIndex = m_pIndex.load(std::memory_order_seq_cst);
+    for (uint position = qHash(key);; ++position) {
+        const int entry = pIndex->entries[position & pIndex->mask].load(
+                std::memory_order_acquire);
+        if (entry == 0) {
+            return kInvalidControlHandle;
+        }
+        const ControlHandle handle = entry - 1;
+        if (slot(handle).key == key) {
+            return handle;
+        }
+    }
+}
+
+ConfigKey ControlRegistry::key(ControlHandle handle) const {
+    VERIFY_OR_DEBUG_ASSERT(handle >= 0 && handle < handleCount()) {
+        return ConfigKey();
+    }
+    return slot(handle).key;
+}
+
+QSharedPointer<ControlDoublePrivate> ControlRegistry::lookup(ControlHandle handle) const {
+    if (handle < 0 || handle >= handleCount()) {
+        return nullptr;
+    }
+    const ReadScope readScope(this);
+    const Record* pRecord = slot(handle).pRecord.load(std::memory_order_seq_cst);
+    if (!pRecord) {
+        return nullptr;
+    }
+    // Returns nullptr if the control is being deleted
+    return pRecord->pControl.toStrongRef();
+}
+
+ControlHandle ControlRegistry::internLocked(const ConfigKey& key) {
+    ControlHandle handle = findHandle(key);
+    if (handle != kInvalidControlHandle) {
+        return handle;
+    }
+
+    handle = m_handleCount.load(std::memory_order_relaxed);
+    const int chunkIndex = handle / kChunkSize;
+    VERIFY_OR_DEBUG_ASSERT(chunkIndex < kMaxChunks) {
+        qWarning() << "ControlRegistry: Too many controls, cannot register" << key;
+        return kInvalidControlHandle;
+    }
+    if (!m_chunks[chunkIndex].load(std::memory_order_relaxed)) {
+        m_chunks[chunkIndex].store(new Slot[kChunkSize], std::memory_order_release);
+    }
+    // The key is written before the handle is published
+    slot(handle).key = key;
+    m_handleCount.store(handle + 1, std::memory_order_release);
+    addToIndexLocked(handle);
+    return handle;
+}
+
+void ControlRegistry::addToIndexLocked(ControlHandle handle) {
+    Index* pIndex = m_pIndex.load(std::memory_order_relaxed);
+    const int capacity = static_cast<int>(pIndex->mask) + 1;
+    if (2 * m_handleCount.load(std::memory_order_relaxed) > capacity) {
+        // Build a larger index with all handles and publish it at once
+        auto pNewIndex = std::make_unique<Index>(2 * capacity);
+        for (ControlHandle other = 0; other < handle; ++other) {
+            for (uint position = qHash(slot(other).key);; ++position) {
+                auto& entry = pNewIndex->entries[position & pNewIndex->mask];
+                if (entry.load(std::memory_order_relaxed) == 0) {
+                    entry.store(other + 1, std::memory_order_relaxed);
+                    break;
+                }
+            }
+        }
+        m_retiredIndices.emplace_back(pIndex);
+        pIndex = pNewIndex.release();
+        m_pIndex.store(pIndex, std::memory_order_seq_cst);
+        reclaimRetiredLocked();
+    }
+    for (uint position = qHash(slot(handle).key);; ++position) {
+        auto& entry = pIndex->entries[position & pIndex->mask];
+        if (entry.load(std::memory_order_relaxed) == 0) {
+            entry.store(handle + 1, std::memory_order_release);
+            return;
+        }
+    }
+}
+
+void ControlRegistry::replaceRecordLocked(ControlHandle handle, Record* pRecord) {
+    Record* pOldRecord = slot(handle).pRecord.exchange(pRecord, std::memory_order_seq_cst);
+    if (pOldRecord) {
+        // A concurrent lookup may still read it
+        m_retiredRecords.emplace_back(pOldRecord);
+    }
+    reclaimRetiredLocked();
+}
+
+void ControlRegistry::reclaimRetiredLocked() {
+    if (m_retiredRecords.empty() && m_retiredIndices.empty()) {
+        return;
+    }
+    // All memory has been retired before this check. A reader that started
+    // afterwards only sees the published replacements, and all readers that
+    // might have loaded the retired pointers have finished if none is active.
+    if (m_activeReaders.load(std::memory_order_seq_cst) > 0) {
+        // Retry on the next write
+        return;
+    }
+    m_retiredRecords.clear();
+    m_retiredIndices.clear();
+}
+
+int ControlRegistry::retiredCount() const {
+    const MMutexLocker locker(&m_mutex);
+    return static_cast<int>(m_retiredRecords.size() + m_retiredIndices.size());
+}
+
+ControlHandle ControlRegistry::insert(const ConfigKey& key,
+        const QSharedPointer<ControlDoublePrivate>& pControl) {
+    const MMutexLocker locker(&m_mutex);
+    const ControlHandle handle = internLocked(key);
+    if (handle != kInvalidControlHandle) {
+        replaceRecordLocked(handle, new Record{pControl, pControl.data()});
+    }
+    return handle;
+}
+
+void ControlRegistry::remove(const ConfigKey& key, const ControlDoublePrivate* pControl) {
+    const MMutexLocker locker(&m_mutex);
+    const ControlHandle handle = findHandle(key);
+    if (handle == kInvalidControlHandle) {
+        return;
+    }
+    const Record* pRecord = slot(handle).pRecord.load(std::memory_order_relaxed);
+    if (pRecord && pRecord->pRawControl == pControl) {
+        replaceRecordLocked(handle, nullptr);
+    }
+}
+
+QList<QSharedPointer<ControlDoublePrivate>> ControlRegistry::getAll() const {
+    QList<QSharedPointer<ControlDoublePrivate>> result;
+    const int handleCount = this->handleCount();
+    result.reserve(handleCount);
+    for (ControlHandle handle = 0; handle < handleCount; ++handle) {
+        auto pControl = lookup(handle);
+        if (pControl) {
+            result.append(std::move(pControl));
+        }
+    }
+    return result;
+}
+
+QList<QSharedPointer<ControlDoublePrivate>> ControlRegistry::takeAll() {
+    QList<QSharedPointer<ControlDoublePrivate>> result;
+    const MMutexLocker locker(&m_mutex);
+    const int handleCount = this->handleCount();
+    result.reserve(handleCount);
+    for (ControlHandle handle = 0; handle < handleCount; ++handle) {
+        auto pControl = lookup(handle);
+        if (pControl) {
+            result.append(std::move(pControl));
+        }
+        delete slot(handle).pRecord.exchange(nullptr, std::memory_order_acq_rel);
+    }
+    m_retiredRecords.clear();
+    m_retiredIndices.clear();
+    return result;
+}
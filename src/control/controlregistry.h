@@ -0,0 +1,150 @@
+#pragma once
+
+#include <QList>
+#include <QSharedPointer>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "preferences/configobject.h"
+#include "util/mutex.h"
+
+class ControlDoublePrivate;
+
+// A compact integer handle of an interned ConfigKey. A handle stays valid for
+// the lifetime of the process, also if the control with the key is deleted
+// and created again.
+typedef int ControlHandle;
+constexpr ControlHandle kInvalidControlHandle = -1;
+
+// The registry of all ControlDoublePrivate instances by ConfigKey.
+//
+// Every ConfigKey that is registered is interned once and gets a handle,
+// which is the index of its slot. Each slot points to an immutable record
+// with a weak pointer to the current control of the key.
+//
+// Lookups are lock-free: The open addressing hash index from keys to handles
+// and the slots are only ever added to, never changed in place. Writers
+// (creating, aliasing and deleting controls) are serialized by a mutex,
+// publish new records and indices with atomic stores and retire the replaced
+// ones instead of deleting them, so a concurrent reader never accesses freed
+// memory. Readers are counted while they access records or indices. Retired
+// memory is released by the next writer that sees no active readers, because
+// none of them can still hold a pointer to it then.
+//
+// Lookups by handle skip hashing the group and item strings entirely.
+class ControlRegistry {
+  public:
+    static constexpr int kChunkSize = 1024;
+    static constexpr int kMaxChunks = 1024;
+
+    ControlRegistry();
+    ~ControlRegistry();
+
+    // Returns the handle of the key or kInvalidControlHandle if no control
+    // with this key has ever been registered. Lock-free.
+    ControlHandle findHandle(const ConfigKey& key) const;
+    // Returns the key of a valid handle. Lock-free.
+    ConfigKey key(ControlHandle handle) const;
+
+    // Returns the current control of the key or handle, or nullptr.
+    // Lock-free.
+    QSharedPointer<ControlDoublePrivate> lookup(const ConfigKey& key) const {
+        return lookup(findHandle(key));
+    }
+    QSharedPointer<ControlDoublePrivate> lookup(ControlHandle handle) const;
+
+    // Registers pControl as the current control of key, replacing any
+    // previous one. Returns the handle of key.
+    ControlHandle insert(const ConfigKey& key,
+            const QSharedPointer<ControlDoublePrivate>& pControl);
+
+    // Unregisters pControl from key, unless the key has already been taken
+    // by another control. Called by the destructor of the control, so pControl
+    // must not be dereferenced.
+    void remove(const ConfigKey& key, const ControlDoublePrivate* pControl);
+
+    // Returns all controls that are alive. An aliased control is returned
+    // once per key.
+    QList<QSharedPointer<ControlDoublePrivate>> getAll() const;
+
+    // Unregisters all controls and returns those that are alive. The handles
+    // remain valid. Must not be called concurrently to lookups.
+    QList<QSharedPointer<ControlDoublePrivate>> takeAll();
+
+    // The number of interned keys
+    int handleCount() const {
+        return m_handleCount.load(std::memory_order_acquire);
+    }
+
+    // The number of replaced records and indices that have not been
+    // released yet
+    int retiredCount() const;
+
+  private:
+    // Counts a reader while it is in scope
+    class ReadScope {
+      public:
+        explicit ReadScope(const ControlRegistry* pRegistry)
+                : m_pRegistry(pRegistry) {
+            // Sequentially consistent, so a writer either sees this reader
+            // or the reader sees the pointers that the writer has published
+            // before.
+            m_pRegistry->m_activeReaders.fetch_add(1, std::memory_order_seq_cst);
+        }
+        ~ReadScope() {
+            m_pRegistry->m_activeReaders.fetch_sub(1, std::memory_order_release);
+        }
+
+      private:
+        const ControlRegistry* const m_pRegistry;
+    };
+
+    struct Record {
+        QWeakPointer<ControlDoublePrivate> pControl;
+        // Only compared, never dereferenced
+        const ControlDoublePrivate* pRawControl;
+    };
+
+    struct Slot {
+        Slot()
+                : pRecord(nullptr) {
+        }
+        ConfigKey key;
+        std::atomic<Record*> pRecord;
+    };
+
+    // Open addressing hash index with linear probing. Each entry holds the
+    // handle + 1 or 0 if it is empty. It is at most half full, so every probe
+    // sequence ends at an empty entry.
+    struct Index {
+        explicit Index(int capacity);
+        const uint mask;
+        std::unique_ptr<std::atomic<int>[]> entries;
+    };
+
+    const Slot& slot(ControlHandle handle) const {
+        return m_chunks[handle / kChunkSize].load(std::memory_order_acquire)
+                [handle % kChunkSize];
+    }
+    Slot& slot(ControlHandle handle) {
+        return m_chunks[handle / kChunkSize].load(std::memory_order_acquire)
+                [handle % kChunkSize];
+    }
+
+    ControlHandle internLocked(const ConfigKey& key) REQUIRES(m_mutex);
+    void addToIndexLocked(ControlHandle handle) REQUIRES(m_mutex);
+    void replaceRecordLocked(ControlHandle handle, Record* pRecord) REQUIRES(m_mutex);
+    // Releases the retired memory if no reader is active
+    void reclaimRetiredLocked() REQUIRES(m_mutex);
+
+    std::array<std::atomic<Slot*>, kMaxChunks> m_chunks;
+    std::atomic<int> m_handleCount;
+    std::atomic<Index*> m_pIndex;
+    mutable std::atomic<int> m_activeReaders;
+
+    mutable MMutex m_mutex;
+    std::vector<std::unique_ptr<Record>> m_retiredRecords GUARDED_BY(m_mutex);
+    std::vector<std::unique_ptr<Index>> m_retiredIndices GUARDED_BY(m_mutex);
+};
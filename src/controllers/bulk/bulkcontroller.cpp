@@ -213,6 +213,7 @@ int BulkController::close() {
     // Stop controller engine here to ensure it's done before the device is
     // closed in case it has any final parting messages
     stopEngine();
+    flushAllOutput();
 
     // Close device
     controllerDebug("  Closing device");
@@ -7,14 +7,38 @@
 #include "controllers/defs_controllers.h"
 #include "moc_controller.cpp"
 #include "util/screensaver.h"
+#include "util/time.h"
+
+// Poll every 1ms (where possible) for good controller response
+#ifdef __LINUX__
+// Many Linux distros ship with the system tick set to 250Hz so 1ms timer
+// reportedly causes CPU hosage. See Bug #990992 rryan 6/2012
+const mixxx::Duration Controller::kPollInterval = mixxx::Duration::fromMillis(5);
+#else
+const mixxx::Duration Controller::kPollInterval = mixxx::Duration::fromMillis(1);
+#endif
+
+namespace {
+
+// Queued output is flushed about once per GUI frame
+constexpr int kOutputFlushIntervalMillis = 10;
+
+} // anonymous namespace
 
 Controller::Controller()
         : m_pScriptEngineLegacy(nullptr),
           m_bIsOutputDevice(false),
           m_bIsInputDevice(false),
           m_bIsOpen(false),
-          m_bLearning(false) {
+          m_bLearning(false),
+          m_outputTimer(this),
+          m_pollTimer(this),
+          m_skipPoll(false) {
     m_userActivityInhibitTimer.start();
+    m_outputTimer.setInterval(kOutputFlushIntervalMillis);
+    connect(&m_outputTimer, &QTimer::timeout, this, &Controller::flushOutput);
+    m_pollTimer.setInterval(kPollInterval.toIntegerMillis());
+    connect(&m_pollTimer, &QTimer::timeout, this, &Controller::pollDevice);
 }
 
 Controller::~Controller() {
@@ -92,6 +116,93 @@ void Controller::send(const QList<int>& data, unsigned int length) {
     sendBytes(msg);
 }
 
+void Controller::setMaxOutputRate(int messagesPerSecond) {
+    m_outputQueue.setMaxRate(messagesPerSecond);
+}
+
+void Controller::setOpen(bool open) {
+    m_bIsOpen = open;
+    if (m_bIsOpen) {
+        if (isPolling()) {
+            m_pollTimer.start();
+        }
+    } else {
+        m_pollTimer.stop();
+        // The state of the device is unknown when it is opened again
+        m_outputTimer.stop();
+        m_outputQueue.clear();
+        controllerDebug(getName() << "output messages sent:"
+                                  << m_outputQueue.sentCount() << "suppressed:"
+                                  << m_outputQueue.suppressedCount());
+    }
+    emit openChanged(m_bIsOpen);
+}
+
+void Controller::pollDevice() {
+    // Each controller polls in its own thread, so a controller that
+    // emits more messages than Mixxx is able to handle, like the Stanton
+    // SCS.1D, or one that goes wild, like the Hercules RMX2, does not delay
+    // others. To free at least some CPU time for the other threads, the
+    // next poll is skipped when a poll takes longer than the poll interval,
+    // similar to the audio thread.
+    //
+    // Some random test data form a i5-3317U CPU @ 1.70GHz Running
+    // Ubuntu Trusty:
+    // * Idle poll: ~5 µs.
+    // * 5 messages burst (full midi bandwidth): ~872 µs.
+    if (m_skipPoll) {
+        m_skipPoll = false;
+        return;
+    }
+
+    const mixxx::Duration start = mixxx::Time::elapsed();
+    poll();
+    if (mixxx::Time::elapsed() - start > kPollInterval) {
+        m_skipPoll = true;
+    }
+}
+
+void Controller::recordUnqueuedOutput(quint32 key, const QByteArray& data) {
+    m_outputQueue.recordSent(key, data);
+    if (m_outputQueue.isEmpty()) {
+        m_outputTimer.stop();
+    }
+}
+
+void Controller::queueOutput(quint32 key, const QByteArray& data) {
+    m_outputQueue.enqueue(key, data);
+    if (!m_outputQueue.isEmpty() && !m_outputTimer.isActive()) {
+        m_outputTimer.start();
+    }
+}
+
+void Controller::flushOutput() {
+    const QVector<ControllerOutputQueue::Message> messages =
+            m_outputQueue.takeReady(mixxx::Time::elapsed());
+    if (!messages.isEmpty()) {
+        sendOutput(messages);
+    }
+    if (m_outputQueue.isEmpty()) {
+        // Messages that exceed the rate limit are sent by the next flushes
+        m_outputTimer.stop();
+    }
+}
+
+void Controller::flushAllOutput() {
+    m_outputTimer.stop();
+    const QVector<ControllerOutputQueue::Message> messages =
+            m_outputQueue.takeAll();
+    if (!messages.isEmpty()) {
+        sendOutput(messages);
+    }
+}
+
+void Controller::sendOutput(const QVector<ControllerOutputQueue::Message>& messages) {
+    for (const auto& message : messages) {
+        sendBytes(message.data);
+    }
+}
+
 void Controller::triggerActivity()
 {
      // Inhibit Updates for 1000 milliseconds
@@ -1,10 +1,12 @@
 #pragma once
 
 #include <QElapsedTimer>
+#include <QTimer>
 #include <QTimerEvent>
 
 #include "controllers/controllermappinginfo.h"
 #include "controllers/controllermappingvisitor.h"
+#include "controllers/controlleroutputqueue.h"
 #include "controllers/controllervisitor.h"
 #include "controllers/legacycontrollermapping.h"
 #include "controllers/legacycontrollermappingfilehandler.h"
@@ -22,6 +24,8 @@ class Controller : public QObject, ConstLegacyControllerMappingVisitor {
     explicit Controller();
     ~Controller() override;  // Subclass should call close() at minimum.
 
+    static const mixxx::Duration kPollInterval;
+
     /// The object that is exposed to the JS scripts as the "controller" object.
     /// Subclasses of Controller can return a subclass of ControllerJSProxy to further
     /// customize their JS api.
@@ -65,6 +69,11 @@ class Controller : public QObject, ConstLegacyControllerMappingVisitor {
 
     virtual bool matchMapping(const MappingInfo& mapping) = 0;
 
+    /// Limits the number of output messages per second sent to the device.
+    /// With a limit, also the output of scripts is queued and coalesced.
+    /// 0 means unlimited.
+    void setMaxOutputRate(int messagesPerSecond);
+
   signals:
     // Emitted when a new mapping is loaded. pMapping is a /clone/ of the loaded
     // mapping, not a pointer to the mapping itself.
@@ -90,6 +99,11 @@ class Controller : public QObject, ConstLegacyControllerMappingVisitor {
     void startLearning();
     void stopLearning();
 
+  private slots:
+    void flushOutput();
+    /// Calls poll() while the device is open, if isPolling() is true.
+    void pollDevice();
+
   protected:
     // The length parameter is here for backwards compatibility for when scripts
     // were required to specify it.
@@ -99,6 +113,29 @@ class Controller : public QObject, ConstLegacyControllerMappingVisitor {
     // controller.
     virtual void sendBytes(const QByteArray& data) = 0;
 
+    inline bool isOutputRateLimited() const {
+        return m_outputQueue.maxRate() > 0;
+    }
+
+    // Queues an output message that is sent with the next flush of the
+    // output queue, unless it is replaced by another message with the same
+    // key before. See ControllerOutputQueue.
+    void queueOutput(quint32 key, const QByteArray& data);
+
+    // Must be called for messages with a key that are sent to the device
+    // directly, so the output queue knows the current state of the device.
+    void recordUnqueuedOutput(quint32 key, const QByteArray& data);
+
+    // Sends the messages of a flush of the output queue. Sub-classes that
+    // queue other messages than raw bytes or can write several messages at
+    // once should reimplement this.
+    virtual void sendOutput(const QVector<ControllerOutputQueue::Message>& messages);
+
+    // Sends all queued output regardless of the rate limit. Must be called
+    // by sub-classes after stopping the engine and before closing the
+    // device, so the messages of the shutdown scripts reach the device.
+    void flushAllOutput();
+
     // To be called in sub-class' open() functions after opening the device but
     // before starting any input polling/processing.
     virtual void startEngine();
@@ -125,10 +162,7 @@ class Controller : public QObject, ConstLegacyControllerMappingVisitor {
     inline void setInputDevice(bool inputDevice) {
         m_bIsInputDevice = inputDevice;
     }
-    inline void setOpen(bool open) {
-        m_bIsOpen = open;
-        emit openChanged(m_bIsOpen);
-    }
+    void setOpen(bool open);
 
   private: // but used by ControllerManager
 
@@ -163,6 +197,10 @@ class Controller : public QObject, ConstLegacyControllerMappingVisitor {
     bool m_bIsOpen;
     bool m_bLearning;
     QElapsedTimer m_userActivityInhibitTimer;
+    ControllerOutputQueue m_outputQueue;
+    QTimer m_outputTimer;
+    QTimer m_pollTimer;
+    bool m_skipPoll;
 
     friend class ControllerJSProxy;
     // accesses lots of our stuff, but in the same thread
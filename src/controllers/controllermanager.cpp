@@ -2,10 +2,13 @@
 
 #include <QSet>
 #include <QThread>
+#include <functional>
 
+#include "controllers/controller.h"
 #include "controllers/controllerlearningeventfilter.h"
 #include "controllers/defs_controllers.h"
 #include "controllers/midi/portmidienumerator.h"
+#include "controllers/scripting/controllerscriptwatchdog.h"
 #include "moc_controllermanager.cpp"
 #include "util/cmdlineargs.h"
 #include "util/time.h"
@@ -24,16 +27,21 @@
 
 // http://developer.qt.nokia.com/wiki/Threads_Events_QObjects
 
-// Poll every 1ms (where possible) for good controller response
-#ifdef __LINUX__
-// Many Linux distros ship with the system tick set to 250Hz so 1ms timer
-// reportedly causes CPU hosage. See Bug #990992 rryan 6/2012
-const mixxx::Duration ControllerManager::kPollInterval = mixxx::Duration::fromMillis(5);
-#else
-const mixxx::Duration ControllerManager::kPollInterval = mixxx::Duration::fromMillis(1);
-#endif
-
 namespace {
+
+// How often the ControllerScriptWatchdog looks for stuck scripts
+constexpr int kScriptWatchdogIntervalMillis = 100;
+
+/// Runs function in the thread of the controller and waits until it has
+/// returned. The controllers, their script engines and their devices are
+/// only accessed from their own thread.
+void runInControllerThread(Controller* pController, const std::function<void()>& function) {
+    if (pController->thread() == QThread::currentThread()) {
+        function();
+        return;
+    }
+    QMetaObject::invokeMethod(pController, function, Qt::BlockingQueuedConnection);
+}
 /// Strip slashes and spaces from device name, so that it can be used as config
 /// key or a filename.
 QString sanitizeDeviceName(QString name) {
@@ -60,6 +68,10 @@ QFileInfo findMappingFile(const QString& pathOrFilename, const QStringList& path
 // kept for backwards compatibility.
 const QString kSettingsGroup = QLatin1String("[ControllerPreset]");
 
+// The maximum number of output messages per second of each device, 0 or
+// missing for no limit
+const QString kOutputRateSettingsGroup = QLatin1String("[ControllerOutputRate]");
+
 } // anonymous namespace
 
 QString firstAvailableFilename(QSet<QString>& filenames,
@@ -85,8 +97,7 @@ ControllerManager::ControllerManager(UserSettingsPointer pConfig)
           // ControllerManager because the CM is moved to its own thread and runs
           // its own event loop.
           m_pControllerLearningEventFilter(new ControllerLearningEventFilter()),
-          m_pollTimer(this),
-          m_skipPoll(false) {
+          m_watchdogTimer(this) {
     qRegisterMetaType<LegacyControllerMappingPointer>("LegacyControllerMappingPointer");
 
     // Create controller mapping paths in the user's home directory.
@@ -96,18 +107,16 @@ ControllerManager::ControllerManager(UserSettingsPointer pConfig)
         QDir().mkpath(userMappings);
     }
 
-    m_pollTimer.setInterval(kPollInterval.toIntegerMillis());
-    connect(&m_pollTimer, &QTimer::timeout, this, &ControllerManager::pollDevices);
+    m_watchdogTimer.setInterval(kScriptWatchdogIntervalMillis);
+    connect(&m_watchdogTimer, &QTimer::timeout, this, &ControllerManager::checkScripts);
 
     m_pThread = new QThread;
     m_pThread->setObjectName("Controller");
 
-    // Moves all children (including the poll timer) to m_pThread
+    // Moves all children (including the watchdog timer) to m_pThread. Each
+    // controller runs in a thread of its own, see startControllerThread().
     moveToThread(m_pThread);
-
-    // Controller processing needs to be prioritized since it can affect the
-    // audio directly, like when scratching
-    m_pThread->start(QThread::HighPriority);
+    m_pThread->start();
 
     connect(this, &ControllerManager::requestInitialize, this, &ControllerManager::slotInitialize);
     connect(this,
@@ -154,18 +163,26 @@ void ControllerManager::slotInitialize() {
 #ifdef __HID__
     m_enumerators.append(new HidEnumerator());
 #endif
+
+    m_watchdogTimer.start();
 }
 
 void ControllerManager::slotShutdown() {
-    stopPolling();
+    m_watchdogTimer.stop();
 
     // Clear m_enumerators before deleting the enumerators to prevent other code
     // paths from accessing them.
     QMutexLocker locker(&m_mutex);
     QList<ControllerEnumerator*> enumerators = m_enumerators;
     m_enumerators.clear();
+    const QList<Controller*> controllers = m_controllers;
     locker.unlock();
 
+    // The enumerators delete their controllers in this thread
+    for (Controller* pController : controllers) {
+        stopControllerThread(pController);
+    }
+
     // Delete enumerators and they'll delete their Devices
     for (ControllerEnumerator* pEnumerator : enumerators) {
         delete pEnumerator;
@@ -182,13 +199,24 @@ void ControllerManager::updateControllerList() {
         return;
     }
     QList<ControllerEnumerator*> enumerators = m_enumerators;
+    const QList<Controller*> oldDeviceList = m_controllers;
     locker.unlock();
 
+    // Some enumerators delete their previous controllers when querying, which
+    // is only safe in this thread.
+    for (Controller* pController : oldDeviceList) {
+        stopControllerThread(pController);
+    }
+
     QList<Controller*> newDeviceList;
     for (ControllerEnumerator* pEnumerator : enumerators) {
         newDeviceList.append(pEnumerator->queryDevices());
     }
 
+    for (Controller* pController : qAsConst(newDeviceList)) {
+        startControllerThread(pController);
+    }
+
     locker.relock();
     if (newDeviceList != m_controllers) {
         m_controllers = newDeviceList;
@@ -226,6 +254,11 @@ QString ControllerManager::getConfiguredMappingFileForDevice(const QString& name
     return m_pConfig->getValueString(ConfigKey(kSettingsGroup, sanitizeDeviceName(name)));
 }
 
+int ControllerManager::getConfiguredMaxOutputRateForDevice(const QString& name) {
+    return m_pConfig->getValue(
+            ConfigKey(kOutputRateSettingsGroup, sanitizeDeviceName(name)), 0);
+}
+
 void ControllerManager::slotSetUpDevices() {
     qDebug() << "ControllerManager: Setting up devices";
 
@@ -236,9 +269,11 @@ void ControllerManager::slotSetUpDevices() {
     for (Controller* pController : deviceList) {
         QString name = pController->getName();
 
-        if (pController->isOpen()) {
-            pController->close();
-        }
+        runInControllerThread(pController, [pController] {
+            if (pController->isOpen()) {
+                pController->close();
+            }
+        });
 
         // The filename for this device name.
         QString deviceName = sanitizeDeviceName(name);
@@ -269,7 +304,9 @@ void ControllerManager::slotSetUpDevices() {
             continue;
         }
 
-        pController->setMapping(*pMapping);
+        runInControllerThread(pController, [pController, pMapping] {
+            pController->setMapping(*pMapping);
+        });
 
         // If we are in safe mode, skip opening controllers.
         if (CmdlineArgs::Instance().getSafeMode()) {
@@ -279,105 +316,75 @@ void ControllerManager::slotSetUpDevices() {
 
         qDebug() << "Opening controller:" << name;
 
-        int value = pController->open();
+        const int maxOutputRate = getConfiguredMaxOutputRateForDevice(name);
+        int value = 0;
+        runInControllerThread(pController, [pController, maxOutputRate, &value] {
+            pController->setMaxOutputRate(maxOutputRate);
+            value = pController->open();
+            if (value == 0) {
+                pController->applyMapping();
+            }
+        });
         if (value != 0) {
             qWarning() << "There was a problem opening" << name;
-            continue;
-        }
-        pController->applyMapping();
-    }
-
-    maybeStartOrStopPolling();
-}
-
-void ControllerManager::maybeStartOrStopPolling() {
-    QMutexLocker locker(&m_mutex);
-    QList<Controller*> controllers = m_controllers;
-    locker.unlock();
-
-    bool shouldPoll = false;
-    for (Controller* pController : controllers) {
-        if (pController->isOpen() && pController->isPolling()) {
-            shouldPoll = true;
         }
     }
-    if (shouldPoll) {
-        startPolling();
-    } else {
-        stopPolling();
-    }
-}
-
-void ControllerManager::startPolling() {
-    // Start the polling timer.
-    if (!m_pollTimer.isActive()) {
-        m_pollTimer.start();
-        qDebug() << "Controller polling started.";
-    }
 }
 
-void ControllerManager::stopPolling() {
-    m_pollTimer.stop();
-    qDebug() << "Controller polling stopped.";
+void ControllerManager::startControllerThread(Controller* pController) {
+    DEBUG_ASSERT(!m_controllerThreads.contains(pController));
+    QThread* pThread = new QThread;
+    pThread->setObjectName(QStringLiteral("Controller %1").arg(pController->getName()));
+    // Moves all children (including the poll timer) to pThread
+    pController->moveToThread(pThread);
+    // Controller processing needs to be prioritized since it can affect the
+    // audio directly, like when scratching
+    pThread->start(QThread::HighPriority);
+    m_controllerThreads.insert(pController, pThread);
 }
 
-void ControllerManager::pollDevices() {
-    // Note: this function is called from a high priority thread which
-    // may stall the GUI or may reduce the available CPU time for other
-    // High Priority threads like caching reader or broadcasting more
-    // then desired, if it is called endless loop like.
-    //
-    // This especially happens if a controller like the 3x Speed
-    // Stanton SCS.1D emits more massages than Mixxx is able to handle
-    // or a controller like Hercules RMX2 goes wild. In such a case the
-    // receive buffer is stacked up every call to insane values > 500 messages.
-    //
-    // To avoid this we pick here a strategies similar like the audio
-    // thread. In case pollDevice() takes longer than a call cycle
-    // we are cooperative a skip the next cycle to free at least some
-    // CPU time
-    //
-    // Some random test data form a i5-3317U CPU @ 1.70GHz Running
-    // Ubuntu Trusty:
-    // * Idle poll: ~5 µs.
-    // * 5 messages burst (full midi bandwidth): ~872 µs.
-
-    if (m_skipPoll) {
-        // skip poll in overload situation
-        m_skipPoll = false;
-        //qDebug() << "ControllerManager::pollDevices() skip";
+void ControllerManager::stopControllerThread(Controller* pController) {
+    QThread* pThread = m_controllerThreads.take(pController);
+    if (!pThread) {
         return;
     }
-
-    mixxx::Duration start = mixxx::Time::elapsed();
-    for (Controller* pDevice : qAsConst(m_controllers)) {
-        if (pDevice->isOpen() && pDevice->isPolling()) {
-            pDevice->poll();
+    QThread* pManagerThread = thread();
+    runInControllerThread(pController, [pController, pManagerThread] {
+        if (pController->isOpen()) {
+            pController->close();
         }
-    }
+        // An object can only be moved by its own thread
+        pController->moveToThread(pManagerThread);
+    });
+    pThread->quit();
+    pThread->wait();
+    delete pThread;
+}
 
-    mixxx::Duration duration = mixxx::Time::elapsed() - start;
-    if (duration > kPollInterval) {
-        m_skipPoll = true;
-    }
-    //qDebug() << "ControllerManager::pollDevices()" << duration << start;
+void ControllerManager::checkScripts() {
+    ControllerScriptWatchdog::instance().check();
 }
 
 void ControllerManager::openController(Controller* pController) {
     if (!pController) {
         return;
     }
-    if (pController->isOpen()) {
-        pController->close();
-    }
-    int result = pController->open();
-    maybeStartOrStopPolling();
+    const int maxOutputRate = getConfiguredMaxOutputRateForDevice(pController->getName());
+    int result = 0;
+    runInControllerThread(pController, [pController, maxOutputRate, &result] {
+        if (pController->isOpen()) {
+            pController->close();
+        }
+        pController->setMaxOutputRate(maxOutputRate);
+        result = pController->open();
+        // If successfully opened the device, apply the mapping
+        if (result == 0) {
+            pController->applyMapping();
+        }
+    });
 
-    // If successfully opened the device, apply the mapping and save the
-    // preference setting.
+    // Save the preference setting
     if (result == 0) {
-        pController->applyMapping();
-
         // Update configuration to reflect controller is enabled.
         m_pConfig->setValue(
                 ConfigKey("[Controller]", sanitizeDeviceName(pController->getName())), 1);
@@ -388,8 +395,9 @@ void ControllerManager::closeController(Controller* pController) {
     if (!pController) {
         return;
     }
-    pController->close();
-    maybeStartOrStopPolling();
+    runInControllerThread(pController, [pController] {
+        pController->close();
+    });
     // Update configuration to reflect controller is disabled.
     m_pConfig->setValue(
             ConfigKey("[Controller]", sanitizeDeviceName(pController->getName())), 0);
@@ -415,7 +423,9 @@ void ControllerManager::slotApplyMapping(Controller* pController,
         qWarning() << "Mapping is dirty, changes might be lost on restart!";
     }
 
-    pController->setMapping(*pMapping);
+    runInControllerThread(pController, [pController, pMapping] {
+        pController->setMapping(*pMapping);
+    });
 
     // Save the file path/name in the config so it can be auto-loaded at
     // startup next time
@@ -23,8 +23,6 @@ class ControllerManager : public QObject {
     ControllerManager(UserSettingsPointer pConfig);
     virtual ~ControllerManager();
 
-    static const mixxx::Duration kPollInterval;
-
     QList<Controller*> getControllers() const;
     QList<Controller*> getControllerList(bool outputDevices=true, bool inputDevices=true);
     ControllerLearningEventFilter* getControllerLearningEventFilter() const;
@@ -35,6 +33,7 @@ class ControllerManager : public QObject {
         return m_pMainThreadSystemMappingEnumerator;
     }
     QString getConfiguredMappingFileForDevice(const QString& name);
+    int getConfiguredMaxOutputRateForDevice(const QString& name);
 
     /// Prevent other parts of Mixxx from having to manually connect to our slots
     void setUpDevices() { emit requestSetUpDevices(); };
@@ -65,21 +64,25 @@ class ControllerManager : public QObject {
     /// preferences dialog on apply, and only open/close changed devices
     void slotSetUpDevices();
     void slotShutdown();
-    /// Calls poll() on all devices that have isPolling() true.
-    void pollDevices();
-    void startPolling();
-    void stopPolling();
-    void maybeStartOrStopPolling();
+    /// Reports controller scripts that exceed their time budget
+    void checkScripts();
 
   private:
+    /// Moves the controller to a new thread with its own event loop, so a
+    /// slow mapping does not delay the input of other controllers.
+    void startControllerThread(Controller* pController);
+    /// Closes the controller and moves it back to the thread of the manager.
+    void stopControllerThread(Controller* pController);
+
     UserSettingsPointer m_pConfig;
     ControllerLearningEventFilter* m_pControllerLearningEventFilter;
-    QTimer m_pollTimer;
+    QTimer m_watchdogTimer;
     mutable QMutex m_mutex;
     QList<ControllerEnumerator*> m_enumerators;
     QList<Controller*> m_controllers;
+    // Only accessed by m_pThread
+    QHash<Controller*, QThread*> m_controllerThreads;
     QThread* m_pThread;
     QSharedPointer<MappingInfoEnumerator> m_pMainThreadUserMappingEnumerator;
     QSharedPointer<MappingInfoEnumerator> m_pMainThreadSystemMappingEnumerator;
-    bool m_skipPoll;
 };
@@ -0,0 +1,117 @@
+#include "controllers/controlleroutputqueue.h"
+
+#include "util/math.h"
+
+namespace {
+
+// The number of messages that may be sent at once after an idle period,
+// as a fraction of the maximum rate per second
+constexpr double kMaxBurstSeconds = 0.1;
+
+} // anonymous namespace
+
+ControllerOutputQueue::ControllerOutputQueue()
+        : m_maxRate(0),
+          m_tokens(0.0),
+          m_sentCount(0),
+          m_suppressedCount(0) {
+}
+
+void ControllerOutputQueue::setMaxRate(int messagesPerSecond) {
+    m_maxRate = math_max(0, messagesPerSecond);
+    m_tokens = 0.0;
+    m_lastRefill = mixxx::Duration::empty();
+}
+
+void ControllerOutputQueue::enqueue(quint32 key, const QByteArray& data) {
+    const auto pendingIt = m_pendingIndex.constFind(key);
+    if (pendingIt != m_pendingIndex.constEnd()) {
+        // The pending message is outdated and never sent
+        m_pending[pendingIt.value()].data = data;
+        ++m_suppressedCount;
+        return;
+    }
+    const auto lastSentIt = m_lastSent.constFind(key);
+    if (lastSentIt != m_lastSent.constEnd() && lastSentIt.value() == data) {
+        ++m_suppressedCount;
+        return;
+    }
+    m_pendingIndex.insert(key, m_pending.size());
+    m_pending.append(Message{key, data});
+}
+
+void ControllerOutputQueue::refill(mixxx::Duration now) {
+    const double maxTokens = math_max(1.0, m_maxRate * kMaxBurstSeconds);
+    if (m_lastRefill == mixxx::Duration::empty()) {
+        m_tokens = maxTokens;
+    } else {
+        m_tokens = math_min(maxTokens,
+                m_tokens + m_maxRate * (now - m_lastRefill).toDoubleSeconds());
+    }
+    m_lastRefill = now;
+}
+
+QVector<ControllerOutputQueue::Message> ControllerOutputQueue::takeReady(
+        mixxx::Duration now) {
+    if (m_maxRate > 0) {
+        refill(now);
+        return takePending(true);
+    }
+    return takePending(false);
+}
+
+QVector<ControllerOutputQueue::Message> ControllerOutputQueue::takeAll() {
+    return takePending(false);
+}
+
+QVector<ControllerOutputQueue::Message> ControllerOutputQueue::takePending(
+        bool limitRate) {
+    QVector<Message> ready;
+    int taken = 0;
+    for (; taken < m_pending.size(); ++taken) {
+        if (limitRate && m_tokens < 1.0) {
+            break;
+        }
+        Message& message = m_pending[taken];
+        const auto lastSentIt = m_lastSent.constFind(message.key);
+        if (lastSentIt != m_lastSent.constEnd() && lastSentIt.value() == message.data) {
+            // Changed back to the last sent value before the flush
+            ++m_suppressedCount;
+            continue;
+        }
+        m_lastSent.insert(message.key, message.data);
+        if (limitRate) {
+            m_tokens -= 1.0;
+        }
+        ready.append(std::move(message));
+    }
+    m_sentCount += ready.size();
+
+    m_pending.remove(0, taken);
+    rebuildPendingIndex();
+    return ready;
+}
+
+void ControllerOutputQueue::recordSent(quint32 key, const QByteArray& data) {
+    m_lastSent.insert(key, data);
+    const auto pendingIt = m_pendingIndex.constFind(key);
+    if (pendingIt != m_pendingIndex.constEnd()) {
+        // Sending it afterwards would revert the newer message
+        m_pending.remove(pendingIt.value());
+        rebuildPendingIndex();
+        ++m_suppressedCount;
+    }
+}
+
+void ControllerOutputQueue::rebuildPendingIndex() {
+    m_pendingIndex.clear();
+    for (int i = 0; i < m_pending.size(); ++i) {
+        m_pendingIndex.insert(m_pending[i].key, i);
+    }
+}
+
+void ControllerOutputQueue::clear() {
+    m_pending.clear();
+    m_pendingIndex.clear();
+    m_lastSent.clear();
+}
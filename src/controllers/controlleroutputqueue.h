@@ -0,0 +1,85 @@
+#pragma once
+
+#include <QByteArray>
+#include <QHash>
+#include <QVector>
+
+#include "util/duration.h"
+
+/// Collects the output messages of a controller between two flushes.
+///
+/// Every message has a key that identifies what it controls on the device,
+/// e.g. the status and control byte of a MIDI message that sets an LED or
+/// the ID of a HID report. A message replaces a pending message with the
+/// same key and is suppressed if it is equal to the last message sent with
+/// that key. With a maximum rate, messages exceeding it stay pending until a
+/// later flush. Pending messages are sent in the order in which their keys
+/// were first queued.
+///
+/// Messages that are sent to the device without the queue must be reported
+/// with recordSent(), otherwise the queue would compare the next message
+/// against an outdated state of the device.
+class ControllerOutputQueue {
+  public:
+    struct Message {
+        quint32 key;
+        QByteArray data;
+    };
+
+    ControllerOutputQueue();
+
+    /// Limits the number of messages sent per second. 0 means unlimited.
+    void setMaxRate(int messagesPerSecond);
+    int maxRate() const {
+        return m_maxRate;
+    }
+
+    void enqueue(quint32 key, const QByteArray& data);
+
+    /// Records a message that has been sent without the queue. A pending
+    /// message with the same key is older and is dropped.
+    void recordSent(quint32 key, const QByteArray& data);
+
+    /// Removes and returns the messages that may be sent at the time now
+    /// without exceeding the maximum rate.
+    QVector<Message> takeReady(mixxx::Duration now);
+
+    /// Removes and returns all pending messages regardless of the maximum
+    /// rate, e.g. the last messages before the device is closed.
+    QVector<Message> takeAll();
+
+    bool isEmpty() const {
+        return m_pending.isEmpty();
+    }
+
+    /// Drops all pending messages and forgets what has been sent, e.g. when
+    /// the device has been closed.
+    void clear();
+
+    /// The number of messages that have been taken for sending and of those
+    /// that have been suppressed, because they were outdated or did not
+    /// change anything on the device.
+    quint64 sentCount() const {
+        return m_sentCount;
+    }
+    quint64 suppressedCount() const {
+        return m_suppressedCount;
+    }
+
+  private:
+    void refill(mixxx::Duration now);
+    QVector<Message> takePending(bool limitRate);
+    void rebuildPendingIndex();
+
+    int m_maxRate;
+    double m_tokens;
+    mixxx::Duration m_lastRefill;
+
+    QVector<Message> m_pending;
+    // The index of the pending message of each key in m_pending
+    QHash<quint32, int> m_pendingIndex;
+    QHash<quint32, QByteArray> m_lastSent;
+
+    quint64 m_sentCount;
+    quint64 m_suppressedCount;
+};
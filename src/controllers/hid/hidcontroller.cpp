@@ -129,6 +129,7 @@ int HidController::close() {
     // Stop controller engine here to ensure it's done before the device is closed
     //  in case it has any final parting messages
     stopEngine();
+    flushAllOutput();
 
     // Close device
     controllerDebug("  Closing device");
@@ -191,11 +192,28 @@ void HidController::sendReport(QList<int> data, unsigned int length, unsigned in
     foreach (int datum, data) {
         temp.append(datum);
     }
-    sendBytesReport(temp, reportID);
+    if (isOutputRateLimited()) {
+        // Only the latest report with each ID is sent with the next flush
+        queueOutput(reportID, temp);
+    } else {
+        recordUnqueuedOutput(reportID, temp);
+        sendBytesReport(temp, reportID);
+    }
 }
 
 void HidController::sendBytes(const QByteArray& data) {
-    sendBytesReport(data, 0);
+    if (isOutputRateLimited()) {
+        queueOutput(0, data);
+    } else {
+        recordUnqueuedOutput(0, data);
+        sendBytesReport(data, 0);
+    }
+}
+
+void HidController::sendOutput(const QVector<ControllerOutputQueue::Message>& messages) {
+    for (const auto& message : messages) {
+        sendBytesReport(message.data, message.key);
+    }
 }
 
 void HidController::sendBytesReport(QByteArray data, unsigned int reportID) {
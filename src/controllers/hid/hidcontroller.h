@@ -52,6 +52,8 @@ class HidController final : public Controller {
     // For devices which only support a single report, reportID must be set to
     // 0x0.
     void sendBytes(const QByteArray& data) override;
+    // Sends queued reports, which are keyed by their report ID
+    void sendOutput(const QVector<ControllerOutputQueue::Message>& messages) override;
     void sendBytesReport(QByteArray data, unsigned int reportID);
     void sendFeatureReport(const QList<int>& dataList, unsigned int reportID);
 
@@ -157,6 +157,7 @@ int Hss1394Controller::close() {
             &Hss1394Controller::receive);
 
     stopEngine();
+    flushAllOutput();
     MidiController::close();
 
     // Clean up the HSS1394Node
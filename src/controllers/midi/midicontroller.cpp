@@ -11,6 +11,24 @@
 #include "util/math.h"
 #include "util/screensaver.h"
 
+namespace {
+
+quint32 shortMsgOutputKey(unsigned char status, unsigned char byte1) {
+    return (static_cast<quint32>(status) << 8) | byte1;
+}
+
+QByteArray shortMsgBytes(unsigned char status,
+        unsigned char byte1,
+        unsigned char byte2) {
+    QByteArray message(3, 0);
+    message[0] = static_cast<char>(status);
+    message[1] = static_cast<char>(byte1);
+    message[2] = static_cast<char>(byte2);
+    return message;
+}
+
+} // anonymous namespace
+
 MidiController::MidiController()
         : Controller() {
     setDeviceCategory(tr("MIDI Controller"));
@@ -158,6 +176,29 @@ void MidiController::destroyOutputHandlers() {
     }
 }
 
+void MidiController::queueShortMsg(unsigned char status,
+        unsigned char byte1,
+        unsigned char byte2) {
+    queueOutput(shortMsgOutputKey(status, byte1),
+            shortMsgBytes(status, byte1, byte2));
+}
+
+void MidiController::sendUnqueuedShortMsg(unsigned char status,
+        unsigned char byte1,
+        unsigned char byte2) {
+    recordUnqueuedOutput(shortMsgOutputKey(status, byte1),
+            shortMsgBytes(status, byte1, byte2));
+    sendShortMsg(status, byte1, byte2);
+}
+
+void MidiController::sendOutput(const QVector<ControllerOutputQueue::Message>& messages) {
+    for (const auto& message : messages) {
+        sendShortMsg(static_cast<unsigned char>(message.data.at(0)),
+                static_cast<unsigned char>(message.data.at(1)),
+                static_cast<unsigned char>(message.data.at(2)));
+    }
+}
+
 void MidiController::learnTemporaryInputMappings(const MidiInputMappings& mappings) {
     foreach (const MidiInputMapping& mapping, mappings) {
         m_temporaryInputMappings.insert(mapping.key.key, mapping);
@@ -54,6 +54,20 @@ class MidiController : public Controller {
             unsigned char byte1,
             unsigned char byte2) = 0;
 
+    /// Queues a short message, which replaces a queued message with the same
+    /// status and control byte. See Controller::queueOutput().
+    void queueShortMsg(unsigned char status,
+            unsigned char byte1,
+            unsigned char byte2);
+
+    /// Sends a short message immediately and records it in the output queue
+    void sendUnqueuedShortMsg(unsigned char status,
+            unsigned char byte1,
+            unsigned char byte2);
+
+    /// Sends queued short messages one by one
+    void sendOutput(const QVector<ControllerOutputQueue::Message>& messages) override;
+
     /// Alias for send()
     /// The length parameter is here for backwards compatibility for when scripts
     /// were required to specify it.
@@ -128,7 +142,11 @@ class MidiControllerJSProxy : public ControllerJSProxy {
     Q_INVOKABLE void sendShortMsg(unsigned char status,
             unsigned char byte1,
             unsigned char byte2) {
-        m_pMidiController->sendShortMsg(status, byte1, byte2);
+        if (m_pMidiController->isOutputRateLimited()) {
+            m_pMidiController->queueShortMsg(status, byte1, byte2);
+        } else {
+            m_pMidiController->sendUnqueuedShortMsg(status, byte1, byte2);
+        }
     }
 
     Q_INVOKABLE void sendSysexMsg(const QList<int>& data, unsigned int length = 0) {
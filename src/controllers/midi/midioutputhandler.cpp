@@ -47,11 +47,13 @@ void MidiOutputHandler::controlChanged(double value) {
     if (!m_pController->isOpen()) {
         qWarning() << "MIDI device" << m_pController->getName() << "not open for output!";
     } else if (byte3 != 0xFF) {
-        controllerDebug("sending MIDI bytes:" << m_mapping.output.status
+        controllerDebug("queueing MIDI bytes:" << m_mapping.output.status
                      << "," << m_mapping.output.control << ","
                      << byte3);
-        m_pController->sendShortMsg(m_mapping.output.status,
-                                    m_mapping.output.control, byte3);
+        // Queued to coalesce fast changes, e.g. of VU meters, per frame
+        m_pController->queueShortMsg(m_mapping.output.status,
+                m_mapping.output.control,
+                byte3);
         m_lastVal = static_cast<int>(byte3);
     }
 }
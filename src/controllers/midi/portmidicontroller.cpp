@@ -1,5 +1,7 @@
 #include "controllers/midi/portmidicontroller.h"
 
+#include <QVarLengthArray>
+
 #include "controllers/controllerdebug.h"
 #include "controllers/midi/midiutils.h"
 #include "moc_portmidicontroller.cpp"
@@ -88,6 +90,7 @@ int PortMidiController::close() {
     }
 
     stopEngine();
+    flushAllOutput();
     MidiController::close();
 
     int result = 0;
@@ -222,6 +225,42 @@ void PortMidiController::sendShortMsg(unsigned char status, unsigned char byte1,
     }
 }
 
+void PortMidiController::sendOutput(const QVector<ControllerOutputQueue::Message>& messages) {
+    if (m_pOutputDevice.isNull() || !m_pOutputDevice->isOpen()) {
+        return;
+    }
+
+    QVarLengthArray<PmEvent, 64> events;
+    events.reserve(messages.size());
+    for (const auto& message : messages) {
+        PmEvent event;
+        event.message = Pm_Message(static_cast<unsigned char>(message.data.at(0)),
+                static_cast<unsigned char>(message.data.at(1)),
+                static_cast<unsigned char>(message.data.at(2)));
+        event.timestamp = 0;
+        events.append(event);
+    }
+
+    PmError err = m_pOutputDevice->write(events.data(), events.size());
+    if (err != pmNoError) {
+        // Use two qWarnings() to ensure line break works on all operating systems
+        qWarning() << "Error sending" << events.size() << "short messages to" << getName();
+        qWarning() << "PortMidi error:" << Pm_GetErrorText(err);
+        return;
+    }
+    if (ControllerDebug::isEnabled()) {
+        for (const auto& message : messages) {
+            const auto status = static_cast<unsigned char>(message.data.at(0));
+            controllerDebug(MidiUtils::formatMidiMessage(getName(),
+                    status,
+                    static_cast<unsigned char>(message.data.at(1)),
+                    static_cast<unsigned char>(message.data.at(2)),
+                    MidiUtils::channelFromStatus(status),
+                    MidiUtils::opCodeFromStatus(status)));
+        }
+    }
+}
+
 void PortMidiController::sendBytes(const QByteArray& data) {
     // PortMidi does not receive a length argument for the buffer we provide to
     // Pm_WriteSysEx. Instead, it scans for a MIDI_EOX byte to know when the
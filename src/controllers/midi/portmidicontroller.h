@@ -65,6 +65,9 @@ class PortMidiController : public MidiController {
     void sendShortMsg(unsigned char status, unsigned char byte1,
                       unsigned char byte2) override;
 
+    // Writes all queued short messages at once
+    void sendOutput(const QVector<ControllerOutputQueue::Message>& messages) override;
+
   private:
     // The sysex data must already contain the start byte 0xf0 and the end byte
     // 0xf7.
@@ -12,7 +12,8 @@ ControllerScriptEngineBase::ControllerScriptEngineBase(Controller* controller)
         : m_bDisplayingExceptionDialog(false),
           m_pJSEngine(nullptr),
           m_pController(controller),
-          m_bTesting(false) {
+          m_bTesting(false),
+          m_watchdogEntry(controller ? controller->getName() : QStringLiteral("test")) {
     // Handle error dialog buttons
     qRegisterMetaType<QMessageBox::StandardButton>("QMessageBox::StandardButton");
 }
@@ -81,6 +82,7 @@ bool ControllerScriptEngineBase::executeFunction(
     }
 
     // If it does happen to be a function, call it.
+    const ControllerScriptWatchdog::Scope watchdogScope(&m_watchdogEntry);
     QJSValue returnValue = functionObject.call(args);
     if (returnValue.isError()) {
         showScriptExceptionDialog(returnValue);
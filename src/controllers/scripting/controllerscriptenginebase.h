@@ -7,6 +7,7 @@
 #include <memory>
 
 #include "controllers/legacycontrollermapping.h"
+#include "controllers/scripting/controllerscriptwatchdog.h"
 #include "util/duration.h"
 
 class Controller;
@@ -38,6 +39,12 @@ class ControllerScriptEngineBase : public QObject {
         return m_bTesting;
     }
 
+    /// Calls into the scripts are timed with a ControllerScriptWatchdog::Scope
+    /// on this entry.
+    ControllerScriptWatchdog::Entry* watchdogEntry() {
+        return &m_watchdogEntry;
+    }
+
   protected:
     virtual void shutdown();
 
@@ -50,6 +57,8 @@ class ControllerScriptEngineBase : public QObject {
 
     bool m_bTesting;
 
+    ControllerScriptWatchdog::Entry m_watchdogEntry;
+
   protected slots:
     void reload();
 
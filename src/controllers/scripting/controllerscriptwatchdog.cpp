@@ -0,0 +1,116 @@
+#include "controllers/scripting/controllerscriptwatchdog.h"
+
+#include <QtDebug>
+
+#include "util/assert.h"
+#include "util/math.h"
+#include "util/time.h"
+
+// Input is noticeably late if a script blocks the thread of its controller
+// for longer
+const mixxx::Duration ControllerScriptWatchdog::kDefaultTimeBudget =
+        mixxx::Duration::fromMillis(20);
+
+// static
+ControllerScriptWatchdog& ControllerScriptWatchdog::instance() {
+    static ControllerScriptWatchdog s_instance;
+    return s_instance;
+}
+
+ControllerScriptWatchdog::ControllerScriptWatchdog()
+        : m_timeBudgetNanos(kDefaultTimeBudget.toIntegerNanos()),
+          m_exceededCount(0) {
+}
+
+ControllerScriptWatchdog::Entry::Entry(const QString& name)
+        : m_name(name),
+          m_depth(0),
+          m_callStartNanos(0),
+          m_reportedCallStartNanos(0) {
+    ControllerScriptWatchdog::instance().registerEntry(this);
+}
+
+ControllerScriptWatchdog::Entry::~Entry() {
+    ControllerScriptWatchdog::instance().unregisterEntry(this);
+}
+
+ControllerScriptWatchdog::Scope::Scope(Entry* pEntry)
+        : m_pEntry(pEntry) {
+    if (m_pEntry->m_depth++ == 0) {
+        // Never 0, which means idle
+        m_pEntry->m_callStartNanos.store(
+                math_max<qint64>(1, mixxx::Time::elapsed().toIntegerNanos()),
+                std::memory_order_release);
+    }
+}
+
+ControllerScriptWatchdog::Scope::~Scope() {
+    DEBUG_ASSERT(m_pEntry->m_depth > 0);
+    if (--m_pEntry->m_depth == 0) {
+        ControllerScriptWatchdog::instance().callFinished(m_pEntry);
+    }
+}
+
+void ControllerScriptWatchdog::setTimeBudget(mixxx::Duration timeBudget) {
+    m_timeBudgetNanos.store(timeBudget.toIntegerNanos(), std::memory_order_relaxed);
+}
+
+mixxx::Duration ControllerScriptWatchdog::timeBudget() const {
+    return mixxx::Duration::fromNanos(m_timeBudgetNanos.load(std::memory_order_relaxed));
+}
+
+void ControllerScriptWatchdog::registerEntry(Entry* pEntry) {
+    const MMutexLocker locker(&m_mutex);
+    m_entries.append(pEntry);
+}
+
+void ControllerScriptWatchdog::unregisterEntry(Entry* pEntry) {
+    const MMutexLocker locker(&m_mutex);
+    m_entries.removeOne(pEntry);
+}
+
+void ControllerScriptWatchdog::callFinished(Entry* pEntry) {
+    const qint64 startNanos = pEntry->m_callStartNanos.exchange(0, std::memory_order_acq_rel);
+    const mixxx::Duration duration = mixxx::Time::elapsed() -
+            mixxx::Duration::fromNanos(startNanos);
+    if (duration <= timeBudget()) {
+        return;
+    }
+    if (pEntry->m_reportedCallStartNanos.load(std::memory_order_acquire) == startNanos) {
+        // Already reported by check() while it was running
+        qWarning() << "Controller script of" << pEntry->m_name
+                   << "finished after" << duration.formatMillisWithUnit();
+        return;
+    }
+    m_exceededCount.fetch_add(1, std::memory_order_relaxed);
+    qWarning() << "Controller script of" << pEntry->m_name
+               << "took" << duration.formatMillisWithUnit()
+               << "exceeding its time budget of"
+               << timeBudget().formatMillisWithUnit();
+}
+
+int ControllerScriptWatchdog::check() {
+    const qint64 nowNanos = mixxx::Time::elapsed().toIntegerNanos();
+    const qint64 timeBudgetNanos = m_timeBudgetNanos.load(std::memory_order_relaxed);
+    int reported = 0;
+    const MMutexLocker locker(&m_mutex);
+    for (Entry* pEntry : qAsConst(m_entries)) {
+        const qint64 startNanos = pEntry->m_callStartNanos.load(std::memory_order_acquire);
+        if (startNanos == 0 || nowNanos - startNanos <= timeBudgetNanos) {
+            continue;
+        }
+        if (pEntry->m_reportedCallStartNanos.exchange(
+                    startNanos, std::memory_order_acq_rel) == startNanos) {
+            continue;
+        }
+        ++reported;
+        m_exceededCount.fetch_add(1, std::memory_order_relaxed);
+        qWarning() << "Controller script of" << pEntry->m_name
+                   << "has been running for"
+                   << mixxx::Duration::fromNanos(nowNanos - startNanos)
+                              .formatMillisWithUnit()
+                   << "exceeding its time budget of"
+                   << timeBudget().formatMillisWithUnit();
+    }
+    return reported;
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <QList>
+#include <QString>
+#include <atomic>
+
+#include "util/duration.h"
+#include "util/mutex.h"
+
+/// Reports controller scripts that exceed a time budget.
+///
+/// Each script engine owns an Entry, which is registered with the single
+/// instance. A Scope times a call into the scripts in the thread of the
+/// engine and reports it when it has exceeded the budget. check() is called
+/// periodically from another thread, so calls that do not return, e.g.
+/// because a script is stuck in a loop, are reported while they run.
+class ControllerScriptWatchdog {
+  public:
+    static const mixxx::Duration kDefaultTimeBudget;
+
+    static ControllerScriptWatchdog& instance();
+
+    class Entry {
+      public:
+        explicit Entry(const QString& name);
+        ~Entry();
+
+      private:
+        const QString m_name;
+        // Only accessed by the thread of the engine
+        int m_depth;
+        // The start of the running call or 0 if the engine is idle
+        std::atomic<qint64> m_callStartNanos;
+        // The start of the last call that check() has reported
+        std::atomic<qint64> m_reportedCallStartNanos;
+
+        friend class ControllerScriptWatchdog;
+    };
+
+    /// Times a call into the scripts. Nested calls are timed as part of the
+    /// outermost one.
+    class Scope {
+      public:
+        explicit Scope(Entry* pEntry);
+        ~Scope();
+
+      private:
+        Entry* const m_pEntry;
+    };
+
+    void setTimeBudget(mixxx::Duration timeBudget);
+    mixxx::Duration timeBudget() const;
+
+    /// Reports the calls that are running longer than the time budget and
+    /// have not been reported yet. Returns the number of reported calls.
+    int check();
+
+    /// The number of calls that have exceeded the time budget
+    int exceededCount() const {
+        return m_exceededCount.load(std::memory_order_relaxed);
+    }
+
+  private:
+    ControllerScriptWatchdog();
+
+    void registerEntry(Entry* pEntry);
+    void unregisterEntry(Entry* pEntry);
+    void callFinished(Entry* pEntry);
+
+    std::atomic<qint64> m_timeBudgetNanos;
+    std::atomic<int> m_exceededCount;
+
+    MMutex m_mutex;
+    QList<Entry*> m_entries GUARDED_BY(m_mutex);
+};
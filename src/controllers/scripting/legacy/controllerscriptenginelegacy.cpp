@@ -48,6 +48,7 @@ bool ControllerScriptEngineLegacy::callFunctionOnObjects(
         }
         controllerDebug("Executing"
                 << prefixName << "." << function);
+        const ControllerScriptWatchdog::Scope watchdogScope(watchdogEntry());
         QJSValue result = init.callWithInstance(prefix, args);
         if (result.isError()) {
             showScriptExceptionDialog(result, bFatalError);
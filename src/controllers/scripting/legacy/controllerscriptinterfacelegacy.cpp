@@ -1,10 +1,13 @@
 #include "controllerscriptinterfacelegacy.h"
 
+#include <vector>
+
 #include "control/controlobject.h"
 #include "control/controlobjectscript.h"
 #include "controllers/controllerdebug.h"
 #include "controllers/scripting/legacy/controllerscriptenginelegacy.h"
 #include "controllers/scripting/legacy/scriptconnectionjsproxy.h"
+#include "controllers/scripting/legacy/scriptcontroljsproxy.h"
 #include "mixer/playermanager.h"
 #include "moc_controllerscriptinterfacelegacy.cpp"
 #include "util/math.h"
@@ -121,13 +124,19 @@ void ControllerScriptInterfaceLegacy::setValue(
     ControlObjectScript* coScript = getControlObjectScript(group, name);
 
     if (coScript != nullptr) {
-        ControlObject* pControl = ControlObject::getControl(
-                coScript->getKey(), ControllerDebug::controlFlags());
-        if (pControl &&
-                !m_st.ignore(
-                        pControl, coScript->getParameterForValue(newValue))) {
-            coScript->slotSet(newValue);
-        }
+        setControlValue(coScript,
+                ControlObject::getControl(
+                        coScript->getKey(), ControllerDebug::controlFlags()),
+                newValue);
+    }
+}
+
+void ControllerScriptInterfaceLegacy::setControlValue(
+        ControlObjectScript* coScript, ControlObject* pControl, double newValue) {
+    if (pControl &&
+            !m_st.ignore(
+                    pControl, coScript->getParameterForValue(newValue))) {
+        coScript->slotSet(newValue);
     }
 }
 
@@ -152,11 +161,17 @@ void ControllerScriptInterfaceLegacy::setParameter(
     ControlObjectScript* coScript = getControlObjectScript(group, name);
 
     if (coScript != nullptr) {
-        ControlObject* pControl = ControlObject::getControl(
-                coScript->getKey(), ControllerDebug::controlFlags());
-        if (pControl && !m_st.ignore(pControl, newParameter)) {
-            coScript->setParameter(newParameter);
-        }
+        setControlParameter(coScript,
+                ControlObject::getControl(
+                        coScript->getKey(), ControllerDebug::controlFlags()),
+                newParameter);
+    }
+}
+
+void ControllerScriptInterfaceLegacy::setControlParameter(
+        ControlObjectScript* coScript, ControlObject* pControl, double newParameter) {
+    if (pControl && !m_st.ignore(pControl, newParameter)) {
+        coScript->setParameter(newParameter);
     }
 }
 
@@ -186,6 +201,65 @@ void ControllerScriptInterfaceLegacy::reset(const QString& group, const QString&
     }
 }
 
+QJSValue ControllerScriptInterfaceLegacy::getControl(const QString& group, const QString& name) {
+    auto pJsEngine = m_pScriptEngineLegacy->jsEngine();
+    VERIFY_OR_DEBUG_ASSERT(pJsEngine) {
+        return QJSValue();
+    }
+
+    ControlObjectScript* coScript = getControlObjectScript(group, name);
+    if (coScript == nullptr) {
+        qWarning() << "Unknown control" << group << name
+                   << ", returning undefined";
+        return QJSValue();
+    }
+
+    ScriptControlJSProxy* pProxy = m_controlProxyCache.value(coScript->getKey(), nullptr);
+    if (pProxy == nullptr) {
+        // Owned by this object, so the proxy is not garbage collected and
+        // every call for the same control returns the same object.
+        pProxy = new ScriptControlJSProxy(this, coScript);
+        m_controlProxyCache.insert(coScript->getKey(), pProxy);
+    }
+    return pJsEngine->newQObject(pProxy);
+}
+
+void ControllerScriptInterfaceLegacy::setValues(
+        const QJSValue& controls, const QJSValue& values) {
+    if (!controls.isArray() || !values.isArray()) {
+        m_pScriptEngineLegacy->throwJSError(
+                "engine.setValues expects an array of controls returned by "
+                "engine.getControl and an array of values.");
+        return;
+    }
+    const quint32 count = controls.property(QStringLiteral("length")).toUInt();
+    if (values.property(QStringLiteral("length")).toUInt() != count) {
+        m_pScriptEngineLegacy->throwJSError(
+                "engine.setValues expects as many values as controls.");
+        return;
+    }
+
+    // Validate all elements before setting any control, so an invalid
+    // element does not leave the controls partially updated.
+    std::vector<ScriptControlJSProxy*> proxies;
+    proxies.reserve(count);
+    for (quint32 i = 0; i < count; ++i) {
+        auto* pProxy = qobject_cast<ScriptControlJSProxy*>(
+                controls.property(i).toQObject());
+        if (pProxy == nullptr) {
+            m_pScriptEngineLegacy->throwJSError(
+                    QStringLiteral("engine.setValues: Element %1 is not a "
+                                   "control returned by engine.getControl.")
+                            .arg(i));
+            return;
+        }
+        proxies.push_back(pProxy);
+    }
+    for (quint32 i = 0; i < count; ++i) {
+        proxies[i]->set(values.property(i).toNumber());
+    }
+}
+
 double ControllerScriptInterfaceLegacy::getDefaultValue(const QString& group, const QString& name) {
     ControlObjectScript* coScript = getControlObjectScript(group, name);
 
@@ -7,8 +7,10 @@
 #include "util/alphabetafilter.h"
 
 class ControllerScriptEngineLegacy;
+class ControlObject;
 class ControlObjectScript;
 class ScriptConnection;
+class ScriptControlJSProxy;
 class ConfigKey;
 
 /// ControllerScriptInterfaceLegacy is the legacy API for controller scripts to interact
@@ -27,6 +29,12 @@ class ControllerScriptInterfaceLegacy : public QObject {
     Q_INVOKABLE double getParameterForValue(
             const QString& group, const QString& name, double value);
     Q_INVOKABLE void reset(const QString& group, const QString& name);
+    /// Returns a ScriptControlJSProxy for fast repeated access to a control
+    /// or undefined if the control does not exist.
+    Q_INVOKABLE QJSValue getControl(const QString& group, const QString& name);
+    /// Sets the values of many controls at once. Takes an array of objects
+    /// returned by getControl and an array of values with the same length.
+    Q_INVOKABLE void setValues(const QJSValue& controls, const QJSValue& values);
     Q_INVOKABLE double getDefaultValue(const QString& group, const QString& name);
     Q_INVOKABLE double getDefaultParameter(const QString& group, const QString& name);
     Q_INVOKABLE QJSValue makeConnection(
@@ -56,6 +64,14 @@ class ControllerScriptInterfaceLegacy : public QObject {
     Q_INVOKABLE void spinback(int deck, bool activate, double factor = 1.8, double rate = -10.0);
     Q_INVOKABLE void softStart(int deck, bool activate, double factor = 1.0);
 
+    /// Set a control, respecting soft takeover. pControl may be nullptr.
+    void setControlValue(ControlObjectScript* coScript,
+            ControlObject* pControl,
+            double newValue);
+    void setControlParameter(ControlObjectScript* coScript,
+            ControlObject* pControl,
+            double newParameter);
+
     bool removeScriptConnection(const ScriptConnection& conn);
     /// Execute a ScriptConnection's JS callback
     void triggerScriptConnection(const ScriptConnection& conn);
@@ -66,6 +82,7 @@ class ControllerScriptInterfaceLegacy : public QObject {
   private:
     QHash<ConfigKey, ControlObjectScript*> m_controlCache;
     ControlObjectScript* getControlObjectScript(const QString& group, const QString& name);
+    QHash<ConfigKey, ScriptControlJSProxy*> m_controlProxyCache;
 
     SoftTakeoverCtrl m_st;
 
@@ -8,7 +8,13 @@ void ScriptConnection::executeCallback(double value) const {
     args << QJSValue(key.group);
     args << QJSValue(key.item);
     QJSValue func = callback; // copy function because QJSValue::call is not const
-    QJSValue result = func.call(args);
+    QJSValue result;
+    if (controllerEngine != nullptr) {
+        const ControllerScriptWatchdog::Scope watchdogScope(controllerEngine->watchdogEntry());
+        result = func.call(args);
+    } else {
+        result = func.call(args);
+    }
     if (result.isError()) {
         if (controllerEngine != nullptr) {
             controllerEngine->showScriptExceptionDialog(result);
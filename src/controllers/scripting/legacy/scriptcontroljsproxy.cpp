@@ -0,0 +1,65 @@
+#include "controllers/scripting/legacy/scriptcontroljsproxy.h"
+
+#include "control/controlobject.h"
+#include "control/controlobjectscript.h"
+#include "controllers/scripting/legacy/controllerscriptinterfacelegacy.h"
+#include "moc_scriptcontroljsproxy.cpp"
+#include "util/math.h"
+
+ScriptControlJSProxy::ScriptControlJSProxy(
+        ControllerScriptInterfaceLegacy* pScriptInterface,
+        ControlObjectScript* pControlScript)
+        : QObject(pScriptInterface),
+          m_pScriptInterface(pScriptInterface),
+          m_pControlScript(pControlScript),
+          m_handle(ControlDoublePrivate::getHandle(pControlScript->getKey())) {
+}
+
+QString ScriptControlJSProxy::readGroup() const {
+    return m_pControlScript->getKey().group;
+}
+
+QString ScriptControlJSProxy::readName() const {
+    return m_pControlScript->getKey().item;
+}
+
+double ScriptControlJSProxy::get() const {
+    return m_pControlScript->get();
+}
+
+void ScriptControlJSProxy::set(double newValue) {
+    if (isnan(newValue)) {
+        qWarning() << "script setting" << m_pControlScript->getKey()
+                   << "to NotANumber, ignoring.";
+        return;
+    }
+    m_pScriptInterface->setControlValue(
+            m_pControlScript, ControlObject::getControl(m_handle), newValue);
+}
+
+double ScriptControlJSProxy::getParameter() const {
+    return m_pControlScript->getParameter();
+}
+
+void ScriptControlJSProxy::setParameter(double newParameter) {
+    if (isnan(newParameter)) {
+        qWarning() << "script setting" << m_pControlScript->getKey()
+                   << "to NotANumber, ignoring.";
+        return;
+    }
+    m_pScriptInterface->setControlParameter(
+            m_pControlScript, ControlObject::getControl(m_handle), newParameter);
+}
+
+double ScriptControlJSProxy::getParameterForValue(double value) const {
+    if (isnan(value)) {
+        qWarning() << "script setting" << m_pControlScript->getKey()
+                   << "to NotANumber, ignoring.";
+        return 0.0;
+    }
+    return m_pControlScript->getParameterForValue(value);
+}
+
+void ScriptControlJSProxy::reset() {
+    m_pControlScript->reset();
+}
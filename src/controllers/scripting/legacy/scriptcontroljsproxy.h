@@ -0,0 +1,38 @@
+#pragma once
+
+#include <QObject>
+
+#include "control/controlregistry.h"
+
+class ControllerScriptInterfaceLegacy;
+class ControlObjectScript;
+
+/// ScriptControlJSProxy provides scripts with a handle to a single control,
+/// returned by engine.getControl(group, name). Its methods skip looking up
+/// the control by group and name strings on every call, which makes it the
+/// fast alternative to engine.getValue/setValue for code that runs often,
+/// like updating LEDs. The proxy is owned by the ControllerScriptInterfaceLegacy
+/// and shared by all callers of engine.getControl with the same key.
+class ScriptControlJSProxy : public QObject {
+    Q_OBJECT
+    Q_PROPERTY(QString group READ readGroup)
+    Q_PROPERTY(QString name READ readName)
+  public:
+    ScriptControlJSProxy(ControllerScriptInterfaceLegacy* pScriptInterface,
+            ControlObjectScript* pControlScript);
+
+    QString readGroup() const;
+    QString readName() const;
+
+    Q_INVOKABLE double get() const;
+    Q_INVOKABLE void set(double newValue);
+    Q_INVOKABLE double getParameter() const;
+    Q_INVOKABLE void setParameter(double newParameter);
+    Q_INVOKABLE double getParameterForValue(double value) const;
+    Q_INVOKABLE void reset();
+
+  private:
+    ControllerScriptInterfaceLegacy* const m_pScriptInterface;
+    ControlObjectScript* const m_pControlScript;
+    const ControlHandle m_handle;
+};
@@ -14,6 +14,8 @@ constexpr double kQLowKillShelve = 0.4;
 constexpr double kQHighKillShelve = 0.4;
 constexpr double kKillGain = -23;
 constexpr double kBesselStartRatio = 0.25;
+// Smaller gain changes of a moving knob do not justify redesigning the filters
+constexpr double kGainThresholdDb = 0.1;
 
 double getCenterFrequency(double low, double high) {
     double scaleLow = log10(low);
@@ -86,6 +88,9 @@ BiquadFullKillEQEffectGroupState::BiquadFullKillEQEffectGroupState(
           m_oldHigh(1.0),
           m_loFreqCorner(0),
           m_highFreqCorner(0),
+          m_lowGainDb(0, kGainThresholdDb),
+          m_midGainDb(0, kGainThresholdDb),
+          m_highGainDb(0, kGainThresholdDb),
           m_rampHoldOff(LVMixEQEffectGroupStateConstants::kRampDone),
           m_groupDelay(0),
           m_oldSampleRate(kStartupSamplerate) {
@@ -177,18 +182,22 @@ void BiquadFullKillEQEffect::processChannel(
                            pState->m_loFreqCorner, pState->m_highFreqCorner);
     }
 
-    // Ramp to dry, when disabling, this will ramp from dry when enabling as well
-    double bqGainLow = 0;
-    double bqGainMid = 0;
-    double bqGainHigh = 0;
     if (enableState != EffectEnableState::Disabling) {
-        bqGainLow = knobValueToBiquadGainDb(
-                m_pPotLow->value(), m_pKillLow->toBool());
-        bqGainMid = knobValueToBiquadGainDb(
-                m_pPotMid->value(), m_pKillMid->toBool());
-        bqGainHigh = knobValueToBiquadGainDb(
-                m_pPotHigh->value(), m_pKillHigh->toBool());
+        pState->m_lowGainDb.update(knobValueToBiquadGainDb(
+                m_pPotLow->value(), m_pKillLow->toBool()));
+        pState->m_midGainDb.update(knobValueToBiquadGainDb(
+                m_pPotMid->value(), m_pKillMid->toBool()));
+        pState->m_highGainDb.update(knobValueToBiquadGainDb(
+                m_pPotHigh->value(), m_pKillHigh->toBool()));
+    } else {
+        // Ramp to dry, when disabling, this will ramp from dry when enabling as well
+        pState->m_lowGainDb.force(0);
+        pState->m_midGainDb.force(0);
+        pState->m_highGainDb.force(0);
     }
+    const double bqGainLow = pState->m_lowGainDb.value();
+    const double bqGainMid = pState->m_midGainDb.value();
+    const double bqGainHigh = pState->m_highGainDb.value();
 
     int activeFilters = 0;
 
@@ -5,6 +5,7 @@
 #include "effects/effectprocessor.h"
 #include "engine/effects/engineeffect.h"
 #include "engine/effects/engineeffectparameter.h"
+#include "engine/effects/smoothedparameter.h"
 #include "engine/filters/enginefilterbiquad1.h"
 #include "engine/filters/enginefilterbessel4.h"
 #include "effects/builtin/lvmixeqbase.h"
@@ -51,6 +52,11 @@ class BiquadFullKillEQEffectGroupState : public EffectState {
     double m_loFreqCorner;
     double m_highFreqCorner;
 
+    // The gains of the bands, held back while a knob moves in small steps
+    SmoothedParameter m_lowGainDb;
+    SmoothedParameter m_midGainDb;
+    SmoothedParameter m_highGainDb;
+
     SINT m_rampHoldOff;
     SINT m_groupDelay;
 
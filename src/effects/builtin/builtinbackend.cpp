@@ -7,6 +7,7 @@
 #include "effects/builtin/bessel8lvmixeqeffect.h"
 #include "effects/builtin/biquadfullkilleqeffect.h"
 #include "effects/builtin/bitcrushereffect.h"
+#include "effects/builtin/convolutionreverbeffect.h"
 #include "effects/builtin/filtereffect.h"
 #include "effects/builtin/flangereffect.h"
 #include "effects/builtin/graphiceqeffect.h"
@@ -51,6 +52,7 @@ BuiltInBackend::BuiltInBackend(QObject* pParent)
 #ifndef __MACAPPSTORE__
     registerEffect<ReverbEffect>();
 #endif
+    registerEffect<ConvolutionReverbEffect>();
     registerEffect<PhaserEffect>();
     registerEffect<MetronomeEffect>();
     registerEffect<WhiteNoiseEffect>();
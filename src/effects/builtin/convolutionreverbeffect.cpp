@@ -0,0 +1,262 @@
+#include "effects/builtin/convolutionreverbeffect.h"
+
+#include <QDir>
+#include <QMutex>
+#include <QtDebug>
+#include <vector>
+
+#include "sources/audiosourcestereoproxy.h"
+#include "sources/soundsourceproxy.h"
+#include "track/track.h"
+#include "util/cmdlineargs.h"
+#include "util/math.h"
+#include "util/performancetimer.h"
+
+namespace {
+
+// Limits the memory and CPU time needed for a single instance.
+constexpr SINT kMaxImpulseResponseSeconds = 10;
+
+// Parameters of the impulse response that is synthesized when the user did
+// not provide one.
+constexpr SINT kSyntheticSampleRate = 44100;
+constexpr double kSyntheticDecaySeconds = 2.0;
+
+// The impulse responses are read from this subdirectory of the settings
+// directory. The first audio file in alphabetical order is used.
+const QString kImpulseResponsesDir = QStringLiteral("effects/impulse_responses");
+
+/// Returns an interleaved stereo impulse response or an empty buffer on failure.
+std::vector<CSAMPLE> readImpulseResponse(const QFileInfo& fileInfo) {
+    TrackPointer pTrack = Track::newTemporary(TrackFile(fileInfo));
+    mixxx::AudioSource::OpenParams config;
+    config.setChannelCount(mixxx::audio::ChannelCount(2));
+    auto pAudioSource = SoundSourceProxy(pTrack).openAudioSource(config);
+    if (!pAudioSource) {
+        qWarning() << "Failed to open impulse response" << fileInfo.filePath();
+        return {};
+    }
+    const auto frameRange = intersect(
+            pAudioSource->frameIndexRange(),
+            mixxx::IndexRange::forward(
+                    pAudioSource->frameIndexMin(),
+                    kMaxImpulseResponseSeconds *
+                            pAudioSource->getSignalInfo().getSampleRate()));
+    mixxx::AudioSourceStereoProxy audioSourceProxy(
+            pAudioSource,
+            frameRange.length());
+    std::vector<CSAMPLE> samples(
+            audioSourceProxy.getSignalInfo().frames2samples(frameRange.length()));
+    const auto readableSampleFrames =
+            audioSourceProxy.readSampleFrames(
+                    mixxx::WritableSampleFrames(
+                            frameRange,
+                            mixxx::SampleBuffer::WritableSlice(
+                                    samples.data(), samples.size())));
+    samples.resize(audioSourceProxy.getSignalInfo().frames2samples(
+            readableSampleFrames.frameLength()));
+    return samples;
+}
+
+/// Exponentially decaying stereo noise with increasing damping of high
+/// frequencies, which resembles a large hall.
+std::vector<CSAMPLE> synthesizeImpulseResponse() {
+    const SINT frames = static_cast<SINT>(kSyntheticDecaySeconds * kSyntheticSampleRate);
+    std::vector<CSAMPLE> samples(frames * mixxx::kEngineChannelCount);
+    // -60 dB after kSyntheticDecaySeconds
+    const double decay = std::exp(std::log(0.001) / frames);
+    unsigned int seed = 1;
+    double gain = 1.0;
+    double lowpassLeft = 0.0;
+    double lowpassRight = 0.0;
+    for (SINT frame = 0; frame < frames; ++frame) {
+        const double damping = 0.2 + 0.7 * frame / frames;
+        seed = seed * 1664525 + 1013904223;
+        const double noiseLeft = static_cast<double>(seed >> 8) / (1 << 23) - 1.0;
+        seed = seed * 1664525 + 1013904223;
+        const double noiseRight = static_cast<double>(seed >> 8) / (1 << 23) - 1.0;
+        lowpassLeft += (1.0 - damping) * (noiseLeft - lowpassLeft);
+        lowpassRight += (1.0 - damping) * (noiseRight - lowpassRight);
+        samples[frame * 2] = static_cast<CSAMPLE>(gain * lowpassLeft);
+        samples[frame * 2 + 1] = static_cast<CSAMPLE>(gain * lowpassRight);
+        gain *= decay;
+    }
+    return samples;
+}
+
+/// Scales the impulse response to unity energy, so the reverberated signal
+/// has about the same loudness as the input regardless of the length of the
+/// impulse response.
+void normalizeImpulseResponse(std::vector<CSAMPLE>* pSamples) {
+    double energy[mixxx::kEngineChannelCount] = {};
+    for (size_t i = 0; i < pSamples->size(); ++i) {
+        energy[i % mixxx::kEngineChannelCount] += (*pSamples)[i] * (*pSamples)[i];
+    }
+    const double maxEnergy = math_max(energy[0], energy[1]);
+    if (maxEnergy <= 0.0) {
+        return;
+    }
+    const auto gain = static_cast<CSAMPLE>(1.0 / std::sqrt(maxEnergy));
+    for (auto& sample : *pSamples) {
+        sample *= gain;
+    }
+}
+
+ConvolutionReverbKernelsPointer createKernels() {
+    PerformanceTimer timer;
+    timer.start();
+
+    std::vector<CSAMPLE> samples;
+    const QDir dir(QDir(CmdlineArgs::Instance().getSettingsPath())
+                           .filePath(kImpulseResponsesDir));
+    const auto fileInfos = dir.entryInfoList(
+            SoundSourceProxy::getSupportedFileNamePatterns(),
+            QDir::Files | QDir::Readable,
+            QDir::Name);
+    for (const auto& fileInfo : fileInfos) {
+        samples = readImpulseResponse(fileInfo);
+        if (!samples.empty()) {
+            qDebug() << "Loaded impulse response" << fileInfo.filePath();
+            break;
+        }
+    }
+    if (samples.empty()) {
+        samples = synthesizeImpulseResponse();
+    }
+    normalizeImpulseResponse(&samples);
+
+    // The impulse response is not resampled, so impulse responses that have
+    // been recorded at a different sample rate than the engine is running
+    // with sound slightly shorter or longer.
+    const SINT frames = samples.size() / mixxx::kEngineChannelCount;
+    auto pKernels = std::make_shared<ConvolutionReverbKernels>();
+    pKernels->pLeft = std::make_shared<PartitionedConvolver::Kernel>(
+            samples.data(), frames, mixxx::kEngineChannelCount);
+    pKernels->pRight = std::make_shared<PartitionedConvolver::Kernel>(
+            samples.data() + 1, frames, mixxx::kEngineChannelCount);
+
+    qDebug() << "Preparing the impulse response with"
+             << pKernels->pLeft->partitionCount() << "partitions took"
+             << timer.elapsed().debugMillisWithUnit();
+    return pKernels;
+}
+
+// The kernels are shared by all states, but they are released when the
+// last effect and state are deleted so the memory is not wasted while the
+// effect is not in use.
+QMutex s_kernelsMutex;
+std::weak_ptr<const ConvolutionReverbKernels> s_pKernels;
+
+} // anonymous namespace
+
+// static
+ConvolutionReverbKernelsPointer ConvolutionReverbGroupState::loadKernels() {
+    QMutexLocker locker(&s_kernelsMutex);
+    ConvolutionReverbKernelsPointer pKernels = s_pKernels.lock();
+    if (!pKernels) {
+        pKernels = createKernels();
+        s_pKernels = pKernels;
+    }
+    return pKernels;
+}
+
+// static
+ConvolutionReverbKernelsPointer ConvolutionReverbGroupState::loadedKernels() {
+    QMutexLocker locker(&s_kernelsMutex);
+    return s_pKernels.lock();
+}
+
+// static
+QString ConvolutionReverbEffect::getId() {
+    return "org.mixxx.effects.convolutionreverb";
+}
+
+// static
+EffectManifestPointer ConvolutionReverbEffect::getManifest() {
+    EffectManifestPointer pManifest(new EffectManifest());
+    pManifest->setAddDryToWet(true);
+    pManifest->setEffectRampsFromDry(true);
+
+    pManifest->setId(getId());
+    pManifest->setName(QObject::tr("Convolution Reverb"));
+    pManifest->setShortName(QObject::tr("Conv. Reverb"));
+    pManifest->setAuthor("The Mixxx Team");
+    pManifest->setVersion("1.0");
+    pManifest->setDescription(QObject::tr(
+            "Places the signal in the room that has been recorded in an "
+            "impulse response.\n"
+            "The first audio file in the effects/impulse_responses folder of "
+            "the Mixxx settings folder is used. Without such a file a large "
+            "hall is simulated."));
+
+    EffectManifestParameterPointer send = pManifest->addParameter();
+    send->setId("send_amount");
+    send->setName(QObject::tr("Send"));
+    send->setShortName(QObject::tr("Send"));
+    send->setDescription(QObject::tr(
+            "How much of the signal to send in to the effect"));
+    send->setControlHint(EffectManifestParameter::ControlHint::KNOB_LINEAR);
+    send->setSemanticHint(EffectManifestParameter::SemanticHint::UNKNOWN);
+    send->setUnitsHint(EffectManifestParameter::UnitsHint::UNKNOWN);
+    send->setDefaultLinkType(EffectManifestParameter::LinkType::LINKED);
+    send->setDefaultLinkInversion(EffectManifestParameter::LinkInversion::NOT_INVERTED);
+    send->setMinimum(0);
+    send->setDefault(0);
+    send->setMaximum(1);
+
+    return pManifest;
+}
+
+ConvolutionReverbEffect::ConvolutionReverbEffect(EngineEffect* pEffect)
+        : m_pSendParameter(pEffect->getParameterById("send_amount")),
+          // The effect is instantiated on the main thread before its states
+          // are created
+          m_pKernels(ConvolutionReverbGroupState::loadKernels()) {
+}
+
+void ConvolutionReverbEffect::processChannel(const ChannelHandle& handle,
+        ConvolutionReverbGroupState* pState,
+        const CSAMPLE* pInput,
+        CSAMPLE* pOutput,
+        const mixxx::EngineParameters& bufferParameters,
+        const EffectEnableState enableState,
+        const GroupFeatureState& groupFeatures) {
+    Q_UNUSED(handle);
+    Q_UNUSED(groupFeatures);
+    DEBUG_ASSERT(bufferParameters.channelCount() == mixxx::kEngineChannelCount);
+
+    if (!pState->pLeft) {
+        // No impulse response had been loaded when the state was created
+        SampleUtil::clear(pOutput, bufferParameters.samplesPerBuffer());
+        return;
+    }
+
+    // Prevent replaying the tail from the last time the effect was enabled
+    if (enableState == EffectEnableState::Enabling) {
+        pState->clear();
+    }
+
+    pState->send.update(m_pSendParameter->value());
+    SampleUtil::copyWithRampingGain(pState->sendBuffer.data(),
+            pInput,
+            static_cast<CSAMPLE_GAIN>(pState->send.previous()),
+            static_cast<CSAMPLE_GAIN>(pState->send.value()),
+            bufferParameters.samplesPerBuffer());
+
+    pState->pLeft->process(pState->sendBuffer.data(),
+            pOutput,
+            bufferParameters.framesPerBuffer(),
+            mixxx::kEngineChannelCount);
+    pState->pRight->process(pState->sendBuffer.data() + 1,
+            pOutput + 1,
+            bufferParameters.framesPerBuffer(),
+            mixxx::kEngineChannelCount);
+
+    // The ramping of the send parameter handles ramping when enabling, so
+    // this effect must handle ramping to dry when disabling itself (instead
+    // of being handled by EngineEffect::process).
+    if (enableState == EffectEnableState::Disabling) {
+        SampleUtil::applyRampingGain(pOutput, 1.0, 0.0, bufferParameters.samplesPerBuffer());
+        pState->send.force(0);
+    }
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <QString>
+#include <memory>
+
+#include "effects/effectprocessor.h"
+#include "engine/effects/engineeffect.h"
+#include "engine/effects/engineeffectparameter.h"
+#include "engine/effects/smoothedparameter.h"
+#include "engine/filters/partitionedconvolver.h"
+#include "util/class.h"
+#include "util/defs.h"
+#include "util/sample.h"
+#include "util/samplebuffer.h"
+#include "util/types.h"
+
+// The precomputed spectra of the left and right channel of the impulse
+// response, shared by all ConvolutionReverbGroupStates.
+struct ConvolutionReverbKernels {
+    PartitionedConvolver::KernelPointer pLeft;
+    PartitionedConvolver::KernelPointer pRight;
+};
+typedef std::shared_ptr<const ConvolutionReverbKernels> ConvolutionReverbKernelsPointer;
+
+class ConvolutionReverbGroupState : public EffectState {
+  public:
+    // Only takes the kernels that ConvolutionReverbEffect has loaded. The
+    // impulse response is never read here, because a state might be
+    // created on the engine thread as a last resort.
+    ConvolutionReverbGroupState(const mixxx::EngineParameters& bufferParameters)
+            : EffectState(bufferParameters),
+              sendBuffer(MAX_BUFFER_LEN),
+              send(0) {
+        acquireResources();
+    }
+
+    void clear() {
+        if (pLeft) {
+            pLeft->clear();
+        }
+        if (pRight) {
+            pRight->clear();
+        }
+        send.force(0);
+    }
+
+    // Releases the kernels while the state is waiting in the EffectStatePool,
+    // so they are not kept alive by unused states and a different impulse
+    // response is used when the state is reused.
+    void releaseResources() {
+        pLeft.reset();
+        pRight.reset();
+        pKernels.reset();
+    }
+
+    // Takes the kernels that are currently in use and creates the
+    // convolvers for them. Must not be called from the engine thread.
+    void acquireResources() {
+        pKernels = loadedKernels();
+        if (!pKernels) {
+            return;
+        }
+        pLeft = std::make_unique<PartitionedConvolver>(pKernels->pLeft);
+        pRight = std::make_unique<PartitionedConvolver>(pKernels->pRight);
+    }
+
+    // Returns the kernels of the impulse response that is currently in use,
+    // reading and decoding it if no one holds a reference to them anymore.
+    // Must be called from the main thread or a worker thread.
+    static ConvolutionReverbKernelsPointer loadKernels();
+
+    ConvolutionReverbKernelsPointer pKernels;
+    // Null if no kernels have been loaded
+    std::unique_ptr<PartitionedConvolver> pLeft;
+    std::unique_ptr<PartitionedConvolver> pRight;
+    mixxx::SampleBuffer sendBuffer;
+    SmoothedParameter send;
+
+  private:
+    // Returns the kernels that have been loaded by loadKernels() and are
+    // still referenced or null.
+    static ConvolutionReverbKernelsPointer loadedKernels();
+};
+
+class ConvolutionReverbEffect : public EffectProcessorImpl<ConvolutionReverbGroupState> {
+  public:
+    ConvolutionReverbEffect(EngineEffect* pEffect);
+
+    static QString getId();
+    static EffectManifestPointer getManifest();
+
+    // See effectprocessor.h
+    void processChannel(const ChannelHandle& handle,
+            ConvolutionReverbGroupState* pState,
+            const CSAMPLE* pInput,
+            CSAMPLE* pOutput,
+            const mixxx::EngineParameters& bufferParameters,
+            const EffectEnableState enableState,
+            const GroupFeatureState& groupFeatures);
+
+  private:
+    QString debugString() const {
+        return getId();
+    }
+
+    EngineEffectParameter* m_pSendParameter;
+    // Keeps the impulse response loaded for the states of this effect
+    const ConvolutionReverbKernelsPointer m_pKernels;
+
+    DISALLOW_COPY_AND_ASSIGN(ConvolutionReverbEffect);
+};
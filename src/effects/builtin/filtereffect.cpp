@@ -4,6 +4,10 @@
 namespace {
 const double kMinCorner = 13; // Hz
 const double kMaxCorner = 22050; // Hz
+// Redesigning the filters while a corner is moving is only worth it for
+// changes of more than ~17 cents.
+const double kCornerThreshold = 0.01;
+const double kQThreshold = 0.01;
 } // anonymous namespace
 
 // static
@@ -72,12 +76,16 @@ EffectManifestPointer FilterEffect::getManifest() {
 
 FilterGroupState::FilterGroupState(const mixxx::EngineParameters& bufferParameters)
         : EffectState(bufferParameters),
-          m_loFreq(kMaxCorner / bufferParameters.sampleRate()),
-          m_q(0.707106781),
-          m_hiFreq(kMinCorner / bufferParameters.sampleRate()) {
+          m_loFreq(kMaxCorner / bufferParameters.sampleRate(),
+                  kCornerThreshold,
+                  SmoothedParameter::Threshold::Relative),
+          m_q(0.707106781, kQThreshold, SmoothedParameter::Threshold::Relative),
+          m_hiFreq(kMinCorner / bufferParameters.sampleRate(),
+                  kCornerThreshold,
+                  SmoothedParameter::Threshold::Relative) {
     m_buffer = mixxx::SampleBuffer(bufferParameters.samplesPerBuffer());
-    m_pLowFilter = new EngineFilterBiquad1Low(1, m_loFreq, m_q, true);
-    m_pHighFilter = new EngineFilterBiquad1High(1, m_hiFreq, m_q, true);
+    m_pLowFilter = new EngineFilterBiquad1Low(1, m_loFreq.value(), m_q.value(), true);
+    m_pHighFilter = new EngineFilterBiquad1High(1, m_hiFreq.value(), m_q.value(), true);
 }
 
 FilterGroupState::~FilterGroupState() {
@@ -104,25 +112,26 @@ void FilterEffect::processChannel(const ChannelHandle& handle,
     Q_UNUSED(handle);
     Q_UNUSED(groupFeatures);
 
-    double hpf;
-    double lpf;
-    double q = m_pQ->value();
-
     const double minCornerNormalized = kMinCorner / bufferParameters.sampleRate();
     const double maxCornerNormalized = kMaxCorner / bufferParameters.sampleRate();
 
+    pState->m_q.update(m_pQ->value());
     if (enableState == EffectEnableState::Disabling) {
         // Ramp to dry, when disabling, this will ramp from dry when enabling as well
-        hpf = minCornerNormalized;
-        lpf = maxCornerNormalized;
+        pState->m_hiFreq.force(minCornerNormalized);
+        pState->m_loFreq.force(maxCornerNormalized);
     } else {
-        hpf = m_pHPF->value() / bufferParameters.sampleRate();
-        lpf = m_pLPF->value() / bufferParameters.sampleRate();
+        pState->m_hiFreq.update(m_pHPF->value() / bufferParameters.sampleRate());
+        pState->m_loFreq.update(m_pLPF->value() / bufferParameters.sampleRate());
     }
 
-    if ((pState->m_loFreq != lpf) ||
-            (pState->m_q != q) ||
-            (pState->m_hiFreq != hpf)) {
+    const double hpf = pState->m_hiFreq.value();
+    const double lpf = pState->m_loFreq.value();
+    const double q = pState->m_q.value();
+
+    if (pState->m_loFreq.changed() ||
+            pState->m_q.changed() ||
+            pState->m_hiFreq.changed()) {
         // limit Q to ~4 in case of overlap
         // Determined empirically at 1000 Hz
         double ratio = hpf / lpf;
@@ -144,7 +153,7 @@ void FilterEffect::processChannel(const ChannelHandle& handle,
 
     const CSAMPLE* pLpfInput = pState->m_buffer.data();
     CSAMPLE* pHpfOutput = pState->m_buffer.data();
-    if (lpf >= maxCornerNormalized && pState->m_loFreq >= maxCornerNormalized) {
+    if (lpf >= maxCornerNormalized && pState->m_loFreq.previous() >= maxCornerNormalized) {
         // Lpf disabled Hpf can write directly to output
         pHpfOutput = pOutput;
         pLpfInput = pHpfOutput;
@@ -153,7 +162,7 @@ void FilterEffect::processChannel(const ChannelHandle& handle,
     if (hpf > minCornerNormalized) {
         // hpf enabled, fade-in is handled in the filter when starting from pause
         pState->m_pHighFilter->process(pInput, pHpfOutput, bufferParameters.samplesPerBuffer());
-    } else if (pState->m_hiFreq > minCornerNormalized) {
+    } else if (pState->m_hiFreq.previous() > minCornerNormalized) {
             // hpf disabling
             pState->m_pHighFilter->processAndPauseFilter(pInput,
                     pHpfOutput, bufferParameters.samplesPerBuffer());
@@ -165,7 +174,7 @@ void FilterEffect::processChannel(const ChannelHandle& handle,
     if (lpf < maxCornerNormalized) {
         // lpf enabled, fade-in is handled in the filter when starting from pause
         pState->m_pLowFilter->process(pLpfInput, pOutput, bufferParameters.samplesPerBuffer());
-    } else if (pState->m_loFreq < maxCornerNormalized) {
+    } else if (pState->m_loFreq.previous() < maxCornerNormalized) {
         // hpf disabling
         pState->m_pLowFilter->processAndPauseFilter(pLpfInput,
                 pOutput, bufferParameters.samplesPerBuffer());
@@ -176,8 +185,4 @@ void FilterEffect::processChannel(const ChannelHandle& handle,
             SampleUtil::copy(pOutput, pInput, bufferParameters.samplesPerBuffer());
         }
     }
-
-    pState->m_loFreq = lpf;
-    pState->m_q = q;
-    pState->m_hiFreq = hpf;
 }
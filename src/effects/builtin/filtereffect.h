@@ -4,6 +4,7 @@
 #include "effects/effectprocessor.h"
 #include "engine/effects/engineeffect.h"
 #include "engine/effects/engineeffectparameter.h"
+#include "engine/effects/smoothedparameter.h"
 #include "engine/filters/enginefilterbiquad1.h"
 #include "util/class.h"
 #include "util/defs.h"
@@ -21,9 +22,10 @@ struct FilterGroupState : public EffectState {
     EngineFilterBiquad1Low* m_pLowFilter;
     EngineFilterBiquad1High* m_pHighFilter;
 
-    double m_loFreq;
-    double m_q;
-    double m_hiFreq;
+    // Normalized to the sample rate
+    SmoothedParameter m_loFreq;
+    SmoothedParameter m_q;
+    SmoothedParameter m_hiFreq;
 
 };
 
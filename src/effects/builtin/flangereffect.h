@@ -24,16 +24,20 @@ constexpr double kMaxLfoBeats = 32.0;
 
 struct FlangerGroupState : public EffectState {
     FlangerGroupState(const mixxx::EngineParameters& bufferParameters)
-            : EffectState(bufferParameters),
-              delayPos(0),
-              lfoFrames(0),
-              previousPeriodFrames(-1),
-              prev_regen(0),
-              prev_mix(0),
-              prev_width(0),
-              prev_manual(static_cast<CSAMPLE_GAIN>(kCenterDelayMs)) {
+            : EffectState(bufferParameters) {
+        clear();
+    }
+
+    void clear() {
         SampleUtil::clear(delayLeft, kBufferLenth);
         SampleUtil::clear(delayRight, kBufferLenth);
+        delayPos = 0;
+        lfoFrames = 0;
+        previousPeriodFrames = -1;
+        prev_regen = 0;
+        prev_mix = 0;
+        prev_width = 0;
+        prev_manual = static_cast<CSAMPLE_GAIN>(kCenterDelayMs);
     }
     CSAMPLE delayLeft[kBufferLenth];
     CSAMPLE delayRight[kBufferLenth];
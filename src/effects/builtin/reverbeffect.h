@@ -18,8 +18,14 @@
 class ReverbGroupState : public EffectState {
   public:
     ReverbGroupState(const mixxx::EngineParameters& bufferParameters)
-        : EffectState(bufferParameters),
-          sendPrevious(0) {
+        : EffectState(bufferParameters) {
+        clear();
+    }
+
+    void clear() {
+        // Forces reinitializing the reverb on the next callback
+        sampleRate = 0;
+        sendPrevious = 0;
     }
 
     void engineParametersChanged(const mixxx::EngineParameters& bufferParameters) {
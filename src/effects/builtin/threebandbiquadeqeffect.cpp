@@ -18,6 +18,8 @@ static const double kQKill = 0.9;
 static const double kQKillShelve = 0.4;
 static const double kBoostGain = 12;
 static const double kKillGain = -26;
+// Smaller gain changes of a moving knob do not justify redesigning the filters
+static const double kGainThresholdDb = 0.1;
 
 
 double getCenterFrequency(double low, double high) {
@@ -80,6 +82,9 @@ ThreeBandBiquadEQEffectGroupState::ThreeBandBiquadEQEffectGroupState(
           m_oldHighCut(0),
           m_loFreqCorner(0),
           m_highFreqCorner(0),
+          m_lowGainDb(0, kGainThresholdDb),
+          m_midGainDb(0, kGainThresholdDb),
+          m_highGainDb(0, kGainThresholdDb),
           m_oldSampleRate(bufferParameters.sampleRate()) {
 
     // Initialize the filters with default parameters
@@ -159,18 +164,22 @@ void ThreeBandBiquadEQEffect::processChannel(
     }
 
 
-    // Ramp to dry, when disabling, this will ramp from dry when enabling as well
-    double bqGainLow = 0;
-    double bqGainMid = 0;
-    double bqGainHigh = 0;
     if (enableState != EffectEnableState::Disabling) {
-        bqGainLow = knobValueToBiquadGainDb(
-                m_pPotLow->value(), m_pKillLow->toBool());
-        bqGainMid = knobValueToBiquadGainDb(
-                m_pPotMid->value(), m_pKillMid->toBool());
-        bqGainHigh = knobValueToBiquadGainDb(
-                m_pPotHigh->value(), m_pKillHigh->toBool());
+        pState->m_lowGainDb.update(knobValueToBiquadGainDb(
+                m_pPotLow->value(), m_pKillLow->toBool()));
+        pState->m_midGainDb.update(knobValueToBiquadGainDb(
+                m_pPotMid->value(), m_pKillMid->toBool()));
+        pState->m_highGainDb.update(knobValueToBiquadGainDb(
+                m_pPotHigh->value(), m_pKillHigh->toBool()));
+    } else {
+        // Ramp to dry, when disabling, this will ramp from dry when enabling as well
+        pState->m_lowGainDb.force(0);
+        pState->m_midGainDb.force(0);
+        pState->m_highGainDb.force(0);
     }
+    const double bqGainLow = pState->m_lowGainDb.value();
+    const double bqGainMid = pState->m_midGainDb.value();
+    const double bqGainHigh = pState->m_highGainDb.value();
 
     int activeFilters = 0;
 
@@ -5,6 +5,7 @@
 #include "effects/effectprocessor.h"
 #include "engine/effects/engineeffect.h"
 #include "engine/effects/engineeffectparameter.h"
+#include "engine/effects/smoothedparameter.h"
 #include "engine/filters/enginefilterbiquad1.h"
 #include "util/class.h"
 #include "util/defs.h"
@@ -38,6 +39,11 @@ class ThreeBandBiquadEQEffectGroupState final : public EffectState {
     double m_loFreqCorner;
     double m_highFreqCorner;
 
+    // The gains of the bands, held back while a knob moves in small steps
+    SmoothedParameter m_lowGainDb;
+    SmoothedParameter m_midGainDb;
+    SmoothedParameter m_highGainDb;
+
     mixxx::audio::SampleRate m_oldSampleRate;
 };
 
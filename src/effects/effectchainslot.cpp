@@ -2,10 +2,12 @@
 
 #include "control/controlencoder.h"
 #include "control/controlpotmeter.h"
+#include "control/controlproxy.h"
 #include "control/controlpushbutton.h"
 #include "effects/effectrack.h"
 #include "effects/effectslot.h"
 #include "effects/effectxmlelements.h"
+#include "engine/effects/engineeffectchain.h"
 #include "mixer/playermanager.h"
 #include "moc_effectchainslot.cpp"
 #include "util/math.h"
@@ -87,6 +89,15 @@ EffectChainSlot::EffectChainSlot(EffectRack* pRack, const QString& group,
             this,
             &EffectChainSlot::slotControlChainSelector);
 
+    // Fraction of the real-time budget of the audio callback that is spent
+    // in the loaded chain, summed over all channels it processes.
+    m_pControlChainCpuLoad = new ControlObject(ConfigKey(m_group, "cpu_load"));
+    m_pControlChainCpuLoad->setReadOnly();
+
+    m_pGuiTick50ms = new ControlProxy(
+            "[Master]", "guiTick50ms", this, ControlFlag::NoAssertIfMissing);
+    m_pGuiTick50ms->connectValueChanged(this, &EffectChainSlot::slotUpdateCpuLoad);
+
     // ControlObjects for skin <-> controller mapping interaction.
     // Refer to comment in header for full explanation.
     m_pControlChainShowFocus = new ControlPushButton(
@@ -122,6 +133,7 @@ EffectChainSlot::~EffectChainSlot() {
     delete m_pControlChainPrevPreset;
     delete m_pControlChainNextPreset;
     delete m_pControlChainSelector;
+    delete m_pControlChainCpuLoad;
     delete m_pControlChainShowFocus;
     delete m_pControlChainHasControllerFocus;
     delete m_pControlChainShowParameters;
@@ -315,11 +327,26 @@ void EffectChainSlot::clear() {
     }
     m_pControlNumEffects->forceSet(0.0);
     m_pControlChainLoaded->forceSet(0.0);
+    m_pControlChainCpuLoad->forceSet(0.0);
     m_pControlChainMixMode->set(
             static_cast<double>(EffectChainMixMode::DrySlashWet));
     emit updated();
 }
 
+void EffectChainSlot::slotUpdateCpuLoad(double v) {
+    Q_UNUSED(v);
+    if (!m_pEffectChain) {
+        return;
+    }
+    EngineEffectChain* pEngineChain = m_pEffectChain->getEngineEffectChain();
+    if (!pEngineChain) {
+        return;
+    }
+    // The EngineEffectChain is only deleted by the main thread after it has
+    // been removed from the engine, so it is safe to access it here.
+    m_pControlChainCpuLoad->forceSet(pEngineChain->cpuLoadMeter().sampleLoad());
+}
+
 unsigned int EffectChainSlot::numSlots() const {
     //qDebug() << debugString() << "numSlots";
     return m_slots.size();
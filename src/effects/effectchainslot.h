@@ -9,6 +9,7 @@
 #include "effects/effectchain.h"
 
 class ControlObject;
+class ControlProxy;
 class ControlPushButton;
 class ControlEncoder;
 class EffectChainSlot;
@@ -113,6 +114,7 @@ class EffectChainSlot : public QObject {
     void slotControlChainNextPreset(double v);
     void slotControlChainPrevPreset(double v);
     void slotChannelStatusChanged(const QString& group);
+    void slotUpdateCpuLoad(double v);
 
   private:
     QString debugString() const {
@@ -136,6 +138,8 @@ class EffectChainSlot : public QObject {
     ControlEncoder* m_pControlChainSelector;
     ControlPushButton* m_pControlChainNextPreset;
     ControlPushButton* m_pControlChainPrevPreset;
+    ControlObject* m_pControlChainCpuLoad;
+    ControlProxy* m_pGuiTick50ms;
 
     /**
       These COs do not affect how the effects are processed;
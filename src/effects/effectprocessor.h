@@ -12,6 +12,7 @@
 #include "engine/effects/message.h"
 #include "engine/channelhandle.h"
 #include "effects/effectsmanager.h"
+#include "effects/effectstatepool.h"
 
 class EngineEffect;
 
@@ -22,6 +23,8 @@ class EngineEffect;
 // audible glitches. EffectStates allocated on the main thread are passed as
 // pointers to the EffectProcessorImpl in the audio callback thread via the
 // effect MessagePipe FIFO (see EngineEffectsManager::onCallbackStart).
+// EffectStates that are no longer needed are recycled by the EffectStatePool
+// of their type if they can be reset with clear().
 
 // Each EffectState instance is responsible for one routing of input signal to
 // output signal. The base EffectProcessorImpl class handles the management
@@ -91,6 +94,7 @@ class EffectProcessorImpl : public EffectProcessor {
   public:
     EffectProcessorImpl()
       : m_pEffectsManager(nullptr) {
+        EffectStatePool<EffectSpecificState>::instance().addProcessor();
     }
     // Subclasses should not implement their own destructor. All state should
     // be stored in the EffectState subclass, not the EffectProcessorImpl subclass.
@@ -110,13 +114,14 @@ class EffectProcessorImpl : public EffectProcessor {
                              << "for input ChannelHandle(" << inputChannelHandleNumber << ")"
                              << "and output ChannelHandle(" << outputChannelHandleNumber << ")";
                 }
-                delete pState;
+                EffectStatePool<EffectSpecificState>::instance().release(pState);
                 outputChannelHandleNumber++;
             }
             outputsMap.clear();
             inputChannelHandleNumber++;
         }
         m_channelStateMatrix.clear();
+        EffectStatePool<EffectSpecificState>::instance().removeProcessor();
     };
 
     // NOTE: Subclasses must implement the following static methods for
@@ -149,7 +154,8 @@ class EffectProcessorImpl : public EffectProcessor {
                            << "EffectState should have been preallocated in the"
                               "main thread.";
             }
-            pState = createSpecificState(bufferParameters);
+            // The EffectStatePool must not be accessed from the audio thread
+            pState = new EffectSpecificState(bufferParameters);
             m_channelStateMatrix[inputHandle][outputHandle] = pState;
         }
         processChannel(inputHandle, pState, pInput, pOutput, bufferParameters,
@@ -255,7 +261,7 @@ class EffectProcessorImpl : public EffectProcessor {
                       qDebug() << "EffectProcessorImpl::deleteStatesForInputChannel"
                                << this << "deleting state" << pState;
                 }
-                delete pState;
+                EffectStatePool<EffectSpecificState>::instance().release(pState);
           }
           stateMap.clear();
     };
@@ -263,7 +269,8 @@ class EffectProcessorImpl : public EffectProcessor {
   private:
 
     EffectSpecificState* createSpecificState(const mixxx::EngineParameters& bufferParameters) {
-        EffectSpecificState* pState = new EffectSpecificState(bufferParameters);
+        EffectSpecificState* pState =
+                EffectStatePool<EffectSpecificState>::instance().acquire(bufferParameters);
         if (kEffectDebugOutput) {
             qDebug() << this << "EffectProcessorImpl creating EffectState" << pState;
         }
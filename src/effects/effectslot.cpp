@@ -6,6 +6,7 @@
 #include "control/controlproxy.h"
 #include "control/controlpushbutton.h"
 #include "effects/effectxmlelements.h"
+#include "engine/effects/engineeffect.h"
 #include "moc_effectslot.cpp"
 #include "util/math.h"
 #include "util/xml.h"
@@ -74,6 +75,15 @@ EffectSlot::EffectSlot(const QString& group,
     m_pControlMetaParameter->set(0.0);
     m_pControlMetaParameter->setDefaultValue(0.0);
 
+    // Fraction of the real-time budget of the audio callback that is spent
+    // in the loaded effect, summed over all channels it processes.
+    m_pControlCpuLoad = new ControlObject(ConfigKey(m_group, "cpu_load"));
+    m_pControlCpuLoad->setReadOnly();
+
+    m_pGuiTick50ms = new ControlProxy(
+            "[Master]", "guiTick50ms", this, ControlFlag::NoAssertIfMissing);
+    m_pGuiTick50ms->connectValueChanged(this, &EffectSlot::slotUpdateCpuLoad);
+
     m_pSoftTakeover = new SoftTakeover();
 
     clear();
@@ -94,6 +104,7 @@ EffectSlot::~EffectSlot() {
     delete m_pControlClear;
     delete m_pControlEnabled;
     delete m_pControlMetaParameter;
+    delete m_pControlCpuLoad;
     delete m_pSoftTakeover;
 }
 
@@ -215,6 +226,7 @@ void EffectSlot::clear() {
     m_pControlLoaded->forceSet(0.0);
     m_pControlNumParameters->forceSet(0.0);
     m_pControlNumButtonParameters->forceSet(0.0);
+    m_pControlCpuLoad->forceSet(0.0);
     for (const auto& pParameter : qAsConst(m_parameters)) {
         pParameter->clear();
     }
@@ -225,6 +237,20 @@ void EffectSlot::clear() {
     emit updated();
 }
 
+void EffectSlot::slotUpdateCpuLoad(double v) {
+    Q_UNUSED(v);
+    if (!m_pEffect) {
+        return;
+    }
+    EngineEffect* pEngineEffect = m_pEffect->getEngineEffect();
+    if (!pEngineEffect) {
+        return;
+    }
+    // The EngineEffect is only deleted by the main thread after it has been
+    // removed from the engine, so it is safe to access it here.
+    m_pControlCpuLoad->forceSet(pEngineEffect->cpuLoadMeter().sampleLoad());
+}
+
 void EffectSlot::slotPrevEffect(double v) {
     if (v > 0) {
         slotEffectSelector(-1);
@@ -81,6 +81,7 @@ class EffectSlot : public QObject {
     void slotEffectSelector(double v);
     void slotEffectEnabledChanged(bool enabled);
     void slotEffectMetaParameter(double v, bool force);
+    void slotUpdateCpuLoad(double v);
 
   signals:
     // Indicates that the effect pEffect has been loaded into this
@@ -127,6 +128,8 @@ class EffectSlot : public QObject {
     ControlEncoder* m_pControlEffectSelector;
     ControlObject* m_pControlClear;
     ControlPotmeter* m_pControlMetaParameter;
+    ControlObject* m_pControlCpuLoad;
+    ControlProxy* m_pGuiTick50ms;
     QList<EffectParameterSlotPointer> m_parameters;
     QList<EffectButtonParameterSlotPointer> m_buttonParameters;
 
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <QString>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "engine/engine.h"
+#include "util/assert.h"
+#include "util/counter.h"
+
+namespace detail {
+
+template<typename T, typename = void>
+struct IsClearableEffectState : std::false_type {};
+
+template<typename T>
+struct IsClearableEffectState<T, std::void_t<decltype(std::declval<T&>().clear())>>
+        : std::true_type {};
+
+template<typename T, typename = void>
+struct HasEffectStateResources : std::false_type {};
+
+template<typename T>
+struct HasEffectStateResources<T,
+        std::void_t<decltype(std::declval<T&>().releaseResources()),
+                decltype(std::declval<T&>().acquireResources())>>
+        : std::true_type {};
+
+} // namespace detail
+
+// Recycles the EffectStates of one EffectState subclass, so switching effects
+// and enabling chains for inputs during a set does not allocate and zero the
+// large buffers of delay based effects over and over again.
+//
+// Only EffectStates with a clear() method that resets them to the state after
+// construction are recycled, all others are allocated and deleted as before.
+// States that share resources with other states, e.g. data loaded from a file,
+// may also provide releaseResources() and acquireResources(). They are called
+// when the state is put into the pool and when it is taken out again, so
+// pooled states neither keep the resources alive nor reuse stale ones.
+// The pooled states are deleted when the last EffectProcessor of the type
+// is deleted, so they don't occupy memory while the effect is not loaded.
+// The pool is only used from the main thread. The audio engine thread never
+// allocates or deletes EffectStates.
+template<typename EffectSpecificState>
+class EffectStatePool {
+  public:
+    // Enough released states for the master and headphone outputs of four
+    // decks, the microphone and the auxiliary inputs.
+    static constexpr int kMaxPooledStates = 16;
+    static constexpr bool kRecyclable =
+            detail::IsClearableEffectState<EffectSpecificState>::value;
+    static constexpr bool kHasResources =
+            detail::HasEffectStateResources<EffectSpecificState>::value;
+
+    static EffectStatePool& instance() {
+        static EffectStatePool s_pool;
+        return s_pool;
+    }
+
+    EffectSpecificState* acquire(const mixxx::EngineParameters& bufferParameters) {
+        if constexpr (!kRecyclable) {
+            return new EffectSpecificState(bufferParameters);
+        }
+        if (!m_states.empty() &&
+                m_sampleRate == bufferParameters.sampleRate() &&
+                m_framesPerBuffer == bufferParameters.framesPerBuffer()) {
+            EffectSpecificState* pState = m_states.back().release();
+            m_states.pop_back();
+            if constexpr (kHasResources) {
+                pState->acquireResources();
+            }
+            ++m_hits;
+            Counter(QStringLiteral("EffectStatePool hits")).increment();
+            return pState;
+        }
+        // The states are constructed with placeholder parameters, which only
+        // change if the engine configuration is known some day.
+        m_states.clear();
+        m_sampleRate = bufferParameters.sampleRate();
+        m_framesPerBuffer = bufferParameters.framesPerBuffer();
+        ++m_misses;
+        Counter(QStringLiteral("EffectStatePool misses")).increment();
+        return new EffectSpecificState(bufferParameters);
+    }
+
+    void release(EffectSpecificState* pState) {
+        if constexpr (kRecyclable) {
+            if (m_states.size() < kMaxPooledStates) {
+                pState->clear();
+                if constexpr (kHasResources) {
+                    pState->releaseResources();
+                }
+                m_states.emplace_back(pState);
+                return;
+            }
+        }
+        delete pState;
+    }
+
+    // Called by each EffectProcessor of this type on construction
+    void addProcessor() {
+        ++m_processors;
+    }
+
+    // Called by each EffectProcessor of this type on destruction after it
+    // has released its states. The pooled states are deleted with the last
+    // processor.
+    void removeProcessor() {
+        VERIFY_OR_DEBUG_ASSERT(m_processors > 0) {
+            return;
+        }
+        if (--m_processors == 0) {
+            m_states.clear();
+        }
+    }
+
+    // The number of acquired states that have been recycled
+    int hits() const {
+        return m_hits;
+    }
+    // The number of acquired states that had to be allocated
+    int misses() const {
+        return m_misses;
+    }
+    // The number of released states that are waiting to be recycled
+    int size() const {
+        return static_cast<int>(m_states.size());
+    }
+
+  private:
+    EffectStatePool()
+            : m_framesPerBuffer(0),
+              m_processors(0),
+              m_hits(0),
+              m_misses(0) {
+    }
+
+    std::vector<std::unique_ptr<EffectSpecificState>> m_states;
+    mixxx::audio::SampleRate m_sampleRate;
+    SINT m_framesPerBuffer;
+    int m_processors;
+    int m_hits;
+    int m_misses;
+};
@@ -108,6 +108,10 @@ class CachingReader : public QObject {
         m_worker.setScheduler(pScheduler);
     }
 
+    void setPreloader(std::shared_ptr<CachingReaderPreloader> pPreloader) {
+        m_worker.setPreloader(std::move(pPreloader));
+    }
+
   signals:
     // Emitted once a new track is loaded and ready to be read from.
     void trackLoading();
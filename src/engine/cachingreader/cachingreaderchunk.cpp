@@ -43,21 +43,29 @@ void CachingReaderChunk::init(SINT index) {
     m_bufferedSampleFrames.frameIndexRange() = mixxx::IndexRange();
 }
 
-// Frame index range of this chunk for the given audio source.
+// static
 mixxx::IndexRange CachingReaderChunk::frameIndexRange(
-        const mixxx::AudioSourcePointer& pAudioSource) const {
-    DEBUG_ASSERT(m_index != kInvalidChunkIndex);
+        const mixxx::AudioSourcePointer& pAudioSource,
+        SINT chunkIndex) {
+    DEBUG_ASSERT(chunkIndex != kInvalidChunkIndex);
     if (!pAudioSource) {
         return mixxx::IndexRange();
     }
     const SINT minFrameIndex =
             pAudioSource->frameIndexMin() +
-            frameIndexOffset();
+            chunkIndex * kFrames;
     return intersect(
             mixxx::IndexRange::forward(minFrameIndex, kFrames),
             pAudioSource->frameIndexRange());
 }
 
+// Frame index range of this chunk for the given audio source.
+mixxx::IndexRange CachingReaderChunk::frameIndexRange(
+        const mixxx::AudioSourcePointer& pAudioSource) const {
+    DEBUG_ASSERT(m_index != kInvalidChunkIndex);
+    return frameIndexRange(pAudioSource, m_index);
+}
+
 mixxx::IndexRange CachingReaderChunk::bufferSampleFrames(
         const mixxx::AudioSourcePointer& pAudioSource,
         mixxx::SampleBuffer::WritableSlice tempOutputBuffer) {
@@ -79,6 +87,27 @@ mixxx::IndexRange CachingReaderChunk::bufferSampleFrames(
     return m_bufferedSampleFrames.frameIndexRange();
 }
 
+mixxx::IndexRange CachingReaderChunk::copySampleFrames(
+        const mixxx::ReadableSampleFrames& sampleFrames) {
+    DEBUG_ASSERT(m_index != kInvalidChunkIndex);
+    const SINT sampleCount = frames2samples(sampleFrames.frameLength());
+    VERIFY_OR_DEBUG_ASSERT(sampleCount <= m_sampleBuffer.length() &&
+            sampleCount <= sampleFrames.readableLength()) {
+        m_bufferedSampleFrames = mixxx::ReadableSampleFrames();
+        return mixxx::IndexRange();
+    }
+    SampleUtil::copy(
+            m_sampleBuffer.data(),
+            sampleFrames.readableData(),
+            sampleCount);
+    m_bufferedSampleFrames = mixxx::ReadableSampleFrames(
+            sampleFrames.frameIndexRange(),
+            mixxx::SampleBuffer::ReadableSlice(
+                    m_sampleBuffer.data(),
+                    sampleCount));
+    return m_bufferedSampleFrames.frameIndexRange();
+}
+
 mixxx::IndexRange CachingReaderChunk::readBufferedSampleFrames(
         CSAMPLE* sampleBuffer,
         const mixxx::IndexRange& frameIndexRange) const {
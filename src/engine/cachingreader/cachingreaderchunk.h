@@ -46,6 +46,12 @@ public:
         return m_index;
     }
 
+    // Frame index range of the chunk with the given index for the
+    // given audio source.
+    static mixxx::IndexRange frameIndexRange(
+            const mixxx::AudioSourcePointer& pAudioSource,
+            SINT chunkIndex);
+
     // Frame index range of this chunk for the given audio source.
     mixxx::IndexRange frameIndexRange(
             const mixxx::AudioSourcePointer& pAudioSource) const;
@@ -56,6 +62,12 @@ public:
             const mixxx::AudioSourcePointer& pAudioSource,
             mixxx::SampleBuffer::WritableSlice tempOutputBuffer);
 
+    // Copy sample frames that have already been read from the audio
+    // source into the chunk and return the range of frames that have
+    // been copied.
+    mixxx::IndexRange copySampleFrames(
+            const mixxx::ReadableSampleFrames& sampleFrames);
+
     mixxx::IndexRange readBufferedSampleFrames(
             CSAMPLE* sampleBuffer,
             const mixxx::IndexRange& frameIndexRange) const;
@@ -71,10 +83,6 @@ protected:
     void init(SINT index);
 
 private:
-    SINT frameIndexOffset() const {
-        return m_index * kFrames;
-    }
-
     SINT m_index;
 
     // The worker thread will fill the sample buffer and
@@ -0,0 +1,190 @@
+#include "engine/cachingreader/cachingreaderpreloader.h"
+
+#include <QMutexLocker>
+#include <QtConcurrentRun>
+#include <algorithm>
+#include <set>
+
+#include "engine/cachingreader/cachingreaderchunk.h"
+#include "sources/audiosourcestereoproxy.h"
+#include "sources/soundsourceproxy.h"
+#include "track/cue.h"
+#include "track/track.h"
+#include "util/assert.h"
+#include "util/logger.h"
+#include "util/timer.h"
+
+namespace {
+
+const mixxx::Logger kLogger("CachingReaderPreloader");
+
+// Returns the frame indices where playback of the track is likely
+// to start after loading it into a deck
+std::set<SINT> playbackStartFrames(const Track& track) {
+    std::set<SINT> frames = {0};
+    const auto addSamplePosition = [&frames](double samplePosition) {
+        if (samplePosition > 0) {
+            frames.insert(static_cast<SINT>(samplePosition) /
+                    CachingReaderChunk::kChannels);
+        }
+    };
+    addSamplePosition(track.getCuePoint().getPosition());
+    for (const auto type : {mixxx::CueType::Intro, mixxx::CueType::AudibleSound}) {
+        CuePointer pCue = track.findCueByType(type);
+        if (pCue) {
+            addSamplePosition(pCue->getPosition());
+        }
+    }
+    return frames;
+}
+
+} // anonymous namespace
+
+CachingReaderPreloader::~CachingReaderPreloader() {
+    waitForFinished();
+}
+
+void CachingReaderPreloader::preload(TrackPointer pTrack) {
+    VERIFY_OR_DEBUG_ASSERT(pTrack) {
+        return;
+    }
+    QMutexLocker locker(&m_mutex);
+    if (m_pStandbyTrack == pTrack) {
+        return;
+    }
+    releaseStandbyTrackLocked();
+    kLogger.debug() << "Preloading" << pTrack->getLocation();
+    m_pStandbyTrack = pTrack;
+    m_standbyFuture = QtConcurrent::run([pTrack] {
+        return std::make_shared<std::unique_ptr<CachingReaderPreloadedTrack>>(
+                preloadTrack(pTrack));
+    });
+}
+
+std::unique_ptr<CachingReaderPreloadedTrack> CachingReaderPreloader::take(
+        const TrackPointer& pTrack) {
+    QFuture<PreloadResult> future;
+    {
+        QMutexLocker locker(&m_mutex);
+        if (!pTrack || m_pStandbyTrack != pTrack) {
+            return nullptr;
+        }
+        if (!m_standbyFuture.isFinished()) {
+            kLogger.debug()
+                    << "Discarding unfinished preload of"
+                    << pTrack->getLocation();
+            releaseStandbyTrackLocked();
+            return nullptr;
+        }
+        future = m_standbyFuture;
+        m_standbyFuture = QFuture<PreloadResult>();
+        m_pStandbyTrack.reset();
+    }
+    const PreloadResult result = future.result();
+    if (!result) {
+        return nullptr;
+    }
+    return std::move(*result);
+}
+
+void CachingReaderPreloader::clear() {
+    QMutexLocker locker(&m_mutex);
+    releaseStandbyTrackLocked();
+}
+
+void CachingReaderPreloader::waitForFinished() {
+    QList<QFuture<PreloadResult>> futures;
+    {
+        QMutexLocker locker(&m_mutex);
+        futures = m_replacedFutures;
+        futures.append(m_standbyFuture);
+    }
+    for (auto& future : futures) {
+        future.waitForFinished();
+    }
+    QMutexLocker locker(&m_mutex);
+    dropFinishedPreloadsLocked();
+}
+
+void CachingReaderPreloader::releaseStandbyTrackLocked() {
+    dropFinishedPreloadsLocked();
+    if (!m_pStandbyTrack) {
+        return;
+    }
+    if (!m_standbyFuture.isFinished()) {
+        m_replacedFutures.append(m_standbyFuture);
+    }
+    m_standbyFuture = QFuture<PreloadResult>();
+    m_pStandbyTrack.reset();
+}
+
+void CachingReaderPreloader::dropFinishedPreloadsLocked() {
+    // The results of finished preloads hold the track and its open
+    // audio source until the last reference is dropped
+    m_replacedFutures.erase(
+            std::remove_if(m_replacedFutures.begin(),
+                    m_replacedFutures.end(),
+                    [](const QFuture<PreloadResult>& future) {
+                        return future.isFinished();
+                    }),
+            m_replacedFutures.end());
+}
+
+// static
+std::unique_ptr<CachingReaderPreloadedTrack> CachingReaderPreloader::preloadTrack(
+        TrackPointer pTrack) {
+    ScopedTimer t("CachingReaderPreloader::preloadTrack");
+    if (!pTrack->checkFileExists()) {
+        return nullptr;
+    }
+    mixxx::AudioSource::OpenParams config;
+    config.setChannelCount(CachingReaderChunk::kChannels);
+    auto pPreloadedTrack = std::make_unique<CachingReaderPreloadedTrack>();
+    pPreloadedTrack->pAudioSource = SoundSourceProxy(pTrack).openAudioSource(config);
+    if (!pPreloadedTrack->pAudioSource ||
+            pPreloadedTrack->pAudioSource->frameIndexRange().empty()) {
+        kLogger.warning()
+                << "Failed to preload"
+                << pTrack->getLocation();
+        return nullptr;
+    }
+    const mixxx::AudioSourcePointer& pAudioSource = pPreloadedTrack->pAudioSource;
+
+    // Decode the chunks in ascending order to avoid seeking backwards
+    std::set<SINT> chunkIndices;
+    for (const SINT frame : playbackStartFrames(*pTrack)) {
+        const SINT firstChunkIndex = CachingReaderChunk::indexForFrame(frame);
+        for (SINT i = 0; i < kChunksPerPosition; ++i) {
+            chunkIndices.insert(firstChunkIndex + i);
+        }
+    }
+    mixxx::SampleBuffer tempReadBuffer(
+            pAudioSource->getSignalInfo().frames2samples(CachingReaderChunk::kFrames));
+    for (const SINT chunkIndex : chunkIndices) {
+        const auto frameIndexRange =
+                CachingReaderChunk::frameIndexRange(pAudioSource, chunkIndex);
+        if (frameIndexRange.empty()) {
+            continue;
+        }
+        CachingReaderPreloadedTrack::Chunk chunk;
+        mixxx::SampleBuffer(
+                CachingReaderChunk::frames2samples(frameIndexRange.length()))
+                .swap(chunk.samples);
+        mixxx::AudioSourceStereoProxy audioSourceProxy(
+                pAudioSource,
+                mixxx::SampleBuffer::WritableSlice(tempReadBuffer));
+        chunk.frameIndexRange =
+                audioSourceProxy
+                        .readSampleFrames(mixxx::WritableSampleFrames(
+                                frameIndexRange,
+                                mixxx::SampleBuffer::WritableSlice(chunk.samples)))
+                        .frameIndexRange();
+        // Incomplete chunks are read again by the CachingReaderWorker
+        // to handle read errors consistently
+        if (chunk.frameIndexRange == frameIndexRange) {
+            pPreloadedTrack->chunks.emplace(chunkIndex, std::move(chunk));
+        }
+    }
+    pPreloadedTrack->pTrack = std::move(pTrack);
+    return pPreloadedTrack;
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <QFuture>
+#include <QList>
+#include <QMutex>
+#include <map>
+#include <memory>
+
+#include "sources/audiosource.h"
+#include "track/track_decl.h"
+#include "util/samplebuffer.h"
+
+// The audio source and the decoded chunks of a track that has been opened
+// in standby before loading it into a deck.
+struct CachingReaderPreloadedTrack {
+    struct Chunk {
+        mixxx::IndexRange frameIndexRange;
+        mixxx::SampleBuffer samples;
+    };
+
+    TrackPointer pTrack;
+    mixxx::AudioSourcePointer pAudioSource;
+    // Decoded stereo samples by chunk index
+    std::map<SINT, Chunk> chunks;
+};
+
+// Opens the track that is going to be loaded next, e.g. by Auto DJ, and
+// decodes the chunks at the start of the track, around the main cue and
+// at the intro, where playback is likely to start. Loading the track into
+// a deck then hands the open audio source and decoded chunks over to its
+// CachingReaderWorker instead of opening the file and decoding the first
+// chunks while the deck is waiting.
+//
+// A single track is kept in standby for all decks. The instance is owned
+// by the PlayerManager and shared with the CachingReaderWorkers of the
+// decks. All functions are thread-safe.
+class CachingReaderPreloader {
+  public:
+    // The number of chunks that are decoded at each position,
+    // i.e. ~1.5 sec at 44.1 kHz.
+    static constexpr SINT kChunksPerPosition = 8;
+
+    CachingReaderPreloader() = default;
+    CachingReaderPreloader(const CachingReaderPreloader&) = delete;
+    CachingReaderPreloader& operator=(const CachingReaderPreloader&) = delete;
+    // Waits until all pending preloads have finished
+    ~CachingReaderPreloader();
+
+    // Starts to open and decode the track on a worker thread. Replaces
+    // the previous track in standby.
+    void preload(TrackPointer pTrack);
+
+    // Returns the track in standby if it matches the given track and
+    // has been preloaded successfully. The track is removed from standby
+    // in any case. Never waits for a preload that is still in progress,
+    // the caller is supposed to open the track itself if nullptr is
+    // returned.
+    std::unique_ptr<CachingReaderPreloadedTrack> take(
+            const TrackPointer& pTrack);
+
+    // Releases the track in standby without waiting for a preload
+    // that is still in progress.
+    void clear();
+
+    // Waits until all pending preloads have finished
+    void waitForFinished();
+
+    // Opens and decodes the track synchronously
+    static std::unique_ptr<CachingReaderPreloadedTrack> preloadTrack(
+            TrackPointer pTrack);
+
+  private:
+    // The unique_ptr is wrapped, because QFuture requires a copyable result
+    typedef std::shared_ptr<std::unique_ptr<CachingReaderPreloadedTrack>> PreloadResult;
+
+    // Removes the track from standby. Its preload is kept with the
+    // replaced preloads until it has finished.
+    void releaseStandbyTrackLocked();
+    void dropFinishedPreloadsLocked();
+
+    QMutex m_mutex;
+    TrackPointer m_pStandbyTrack;
+    QFuture<PreloadResult> m_standbyFuture;
+    // Replaced preloads that might still be running
+    QList<QFuture<PreloadResult>> m_replacedFutures;
+};
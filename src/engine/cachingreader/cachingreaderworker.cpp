@@ -47,10 +47,23 @@ ReaderStatusUpdate CachingReaderWorker::processReadRequest(
         return result;
     }
 
-    // Try to read the data required for the chunk from the audio source
-    const mixxx::IndexRange bufferedFrameIndexRange = pChunk->bufferSampleFrames(
-            m_pAudioSource,
-            mixxx::SampleBuffer::WritableSlice(m_tempReadBuffer));
+    mixxx::IndexRange bufferedFrameIndexRange;
+    const auto preloadedChunk = m_preloadedChunks.find(pChunk->getIndex());
+    if (preloadedChunk != m_preloadedChunks.end() &&
+            preloadedChunk->second.frameIndexRange == chunkFrameIndexRange) {
+        // Copy the samples that have already been decoded in standby
+        bufferedFrameIndexRange = pChunk->copySampleFrames(
+                mixxx::ReadableSampleFrames(
+                        preloadedChunk->second.frameIndexRange,
+                        mixxx::SampleBuffer::ReadableSlice(
+                                preloadedChunk->second.samples.data(),
+                                preloadedChunk->second.samples.size())));
+    } else {
+        // Try to read the data required for the chunk from the audio source
+        bufferedFrameIndexRange = pChunk->bufferSampleFrames(
+                m_pAudioSource,
+                mixxx::SampleBuffer::WritableSlice(m_tempReadBuffer));
+    }
     DEBUG_ASSERT(!m_pAudioSource ||
             bufferedFrameIndexRange.isSubrangeOf(m_pAudioSource->frameIndexRange()));
     // The readable frame range might have changed
@@ -124,6 +137,7 @@ void CachingReaderWorker::loadTrack(const TrackPointer& pTrack) {
 
     // Unload the track
     m_pAudioSource.reset(); // Close open file handles
+    m_preloadedChunks.clear();
 
     if (!pTrack) {
         // If no new track is available then we are done
@@ -149,9 +163,24 @@ void CachingReaderWorker::loadTrack(const TrackPointer& pTrack) {
         return;
     }
 
-    mixxx::AudioSource::OpenParams config;
-    config.setChannelCount(CachingReaderChunk::kChannels);
-    m_pAudioSource = SoundSourceProxy(pTrack).openAudioSource(config);
+    // Adopt the audio source and the decoded chunks if the track
+    // has been preloaded in standby
+    std::unique_ptr<CachingReaderPreloadedTrack> pPreloadedTrack;
+    if (m_pPreloader) {
+        pPreloadedTrack = m_pPreloader->take(pTrack);
+    }
+    if (pPreloadedTrack) {
+        kLogger.debug()
+                << m_group
+                << "Loading preloaded track"
+                << trackLocation;
+        m_pAudioSource = std::move(pPreloadedTrack->pAudioSource);
+        m_preloadedChunks = std::move(pPreloadedTrack->chunks);
+    } else {
+        mixxx::AudioSource::OpenParams config;
+        config.setChannelCount(CachingReaderChunk::kChannels);
+        m_pAudioSource = SoundSourceProxy(pTrack).openAudioSource(config);
+    }
     if (!m_pAudioSource) {
         kLogger.warning()
                 << m_group
@@ -170,6 +199,7 @@ void CachingReaderWorker::loadTrack(const TrackPointer& pTrack) {
     // be decreased to avoid repeated reading of corrupt audio data.
     if (m_pAudioSource->frameIndexRange().empty()) {
         m_pAudioSource.reset(); // Close open file handles
+        m_preloadedChunks.clear();
         kLogger.warning()
                 << m_group
                 << "Failed to open empty file"
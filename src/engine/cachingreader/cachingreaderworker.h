@@ -5,8 +5,11 @@
 #include <QString>
 #include <QThread>
 #include <QtDebug>
+#include <map>
+#include <memory>
 
 #include "engine/cachingreader/cachingreaderchunk.h"
+#include "engine/cachingreader/cachingreaderpreloader.h"
 #include "engine/engineworker.h"
 #include "sources/audiosource.h"
 #include "track/track_decl.h"
@@ -104,6 +107,12 @@ class CachingReaderWorker : public EngineWorker {
     // Request to load a new track. wake() must be called afterwards.
     void newTrack(TrackPointer pTrack);
 
+    // Tracks are loaded from the preloader if available. Must be set
+    // before the first track is loaded.
+    void setPreloader(std::shared_ptr<CachingReaderPreloader> pPreloader) {
+        m_pPreloader = std::move(pPreloader);
+    }
+
     // Run upkeep operations like loading tracks and reading from file. Run by a
     // thread pool via the EngineWorkerScheduler.
     void run() override;
@@ -131,6 +140,8 @@ class CachingReaderWorker : public EngineWorker {
     bool m_newTrackAvailable;
     TrackPointer m_pNewTrack;
 
+    std::shared_ptr<CachingReaderPreloader> m_pPreloader;
+
     // Internal method to load a track. Emits trackLoaded when finished.
     void loadTrack(const TrackPointer& pTrack);
 
@@ -140,6 +151,10 @@ class CachingReaderWorker : public EngineWorker {
     // The current audio source of the track loaded
     mixxx::AudioSourcePointer m_pAudioSource;
 
+    // Chunks of the current track that have already been decoded by
+    // the CachingReaderPreloader before the track has been loaded
+    std::map<SINT, CachingReaderPreloadedTrack::Chunk> m_preloadedChunks;
+
     // Temporary buffer for reading samples from all channels
     // before conversion to a stereo signal.
     mixxx::SampleBuffer m_tempReadBuffer;
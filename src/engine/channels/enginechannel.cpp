@@ -36,6 +36,14 @@ EngineChannel::EngineChannel(const ChannelHandleAndGroup& handleGroup,
     m_pTalkover = new ControlPushButton(ConfigKey(getGroup(), "talkover"));
     m_pTalkover->setButtonMode(ControlPushButton::POWERWINDOW);
 
+    // Fraction of the real-time budget of the audio callback that is spent
+    // in processing this channel.
+    m_pCpuLoad = new ControlObject(ConfigKey(getGroup(), "cpu_load"));
+    m_pCpuLoad->setReadOnly();
+    m_pGuiTick50ms = new ControlProxy(
+            "[Master]", "guiTick50ms", this, ControlFlag::NoAssertIfMissing);
+    m_pGuiTick50ms->connectValueChanged(this, &EngineChannel::slotUpdateCpuLoad);
+
     if (m_pEffectsManager != nullptr) {
         m_pEffectsManager->registerInputChannel(handleGroup);
     }
@@ -50,6 +58,7 @@ EngineChannel::~EngineChannel() {
     delete m_pOrientationCenter;
     delete m_pSampleRate;
     delete m_pTalkover;
+    delete m_pCpuLoad;
 }
 
 void EngineChannel::setPfl(bool enabled) {
@@ -105,3 +114,8 @@ EngineChannel::ChannelOrientation EngineChannel::getOrientation() const {
     }
     return CENTER;
 }
+
+void EngineChannel::slotUpdateCpuLoad(double v) {
+    Q_UNUSED(v);
+    m_pCpuLoad->forceSet(m_cpuLoadMeter.sampleLoad());
+}
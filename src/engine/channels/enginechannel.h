@@ -6,6 +6,7 @@
 #include "engine/channelhandle.h"
 #include "engine/enginevumeter.h"
 #include "preferences/usersettings.h"
+#include "util/cpuloadmeter.h"
 
 class ControlObject;
 class EngineBuffer;
@@ -54,6 +55,12 @@ class EngineChannel : public EngineObject {
     virtual void collectFeatures(GroupFeatureState* pGroupFeatures) const = 0;
     virtual void postProcess(const int iBuffersize) = 0;
 
+    /// Accumulates the time spent in process(), which includes the
+    /// pre-fader effects of the channel.
+    mixxx::CpuLoadMeter& cpuLoadMeter() {
+        return m_cpuLoadMeter;
+    }
+
     // TODO(XXX) This hack needs to be removed.
     virtual EngineBuffer* getEngineBuffer() {
         return NULL;
@@ -75,6 +82,7 @@ class EngineChannel : public EngineObject {
     void slotOrientationLeft(double v);
     void slotOrientationRight(double v);
     void slotOrientationCenter(double v);
+    void slotUpdateCpuLoad(double v);
 
   private:
     ControlPushButton* m_pMaster;
@@ -84,5 +92,8 @@ class EngineChannel : public EngineObject {
     ControlPushButton* m_pOrientationRight;
     ControlPushButton* m_pOrientationCenter;
     ControlPushButton* m_pTalkover;
+    ControlObject* m_pCpuLoad;
+    ControlProxy* m_pGuiTick50ms;
+    mixxx::CpuLoadMeter m_cpuLoadMeter;
     bool m_bIsTalkoverChannel;
 };
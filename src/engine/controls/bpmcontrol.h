@@ -107,6 +107,8 @@ class BpmControl : public EngineControl {
     }
     bool syncTempo();
     double calcSyncAdjustment(bool userTweakingSync);
+    // Replaces the beats of the loaded track with a modified snapshot
+    void setTrackBeats(const mixxx::BeatsPointer& pBeats);
 
     friend class SyncControl;
 
@@ -164,7 +166,7 @@ class BpmControl : public EngineControl {
     bool m_dUserTweakingSync;
 
     // m_pBeats is written from an engine worker thread
-    mixxx::BeatsPointer m_pBeats;
+    ControlValueAtomic<mixxx::BeatsPointer> m_pBeats;
 
     FRIEND_TEST(EngineSyncTest, UserTweakBeatDistance);
     FRIEND_TEST(EngineSyncTest, UserTweakPreservedInSeek);
@@ -27,5 +27,5 @@ class ClockControl: public EngineControl {
     ControlProxy* m_pCOSampleRate;
 
     // m_pBeats is written from an engine worker thread
-    mixxx::BeatsPointer m_pBeats;
+    ControlValueAtomic<mixxx::BeatsPointer> m_pBeats;
 };
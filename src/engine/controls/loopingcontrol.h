@@ -183,7 +183,8 @@ class LoopingControl : public EngineControl {
 
     // objects below are written from an engine worker thread
     TrackPointer m_pTrack;
-    mixxx::BeatsPointer m_pBeats;
+    // m_pBeats is written from an engine worker thread
+    ControlValueAtomic<mixxx::BeatsPointer> m_pBeats;
 };
 
 // Class for handling loop moves of a set size. This allows easy access from
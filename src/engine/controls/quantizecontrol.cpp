@@ -32,13 +32,13 @@ QuantizeControl::~QuantizeControl() {
 
 void QuantizeControl::trackLoaded(TrackPointer pNewTrack) {
     if (pNewTrack) {
-        m_pBeats = pNewTrack->getBeats();
+        m_pBeats.setValue(pNewTrack->getBeats());
         // Initialize prev and next beat as if current position was zero.
         // If there is a cue point, the value will be updated.
         lookupBeatPositions(0.0);
         updateClosestBeat(0.0);
     } else {
-        m_pBeats.clear();
+        m_pBeats.setValue(mixxx::BeatsPointer());
         m_pCOPrevBeat->set(-1);
         m_pCONextBeat->set(-1);
         m_pCOClosestBeat->set(-1);
@@ -46,7 +46,7 @@ void QuantizeControl::trackLoaded(TrackPointer pNewTrack) {
 }
 
 void QuantizeControl::trackBeatsUpdated(mixxx::BeatsPointer pBeats) {
-    m_pBeats = pBeats;
+    m_pBeats.setValue(pBeats);
     double current = getSampleOfTrack().current;
     lookupBeatPositions(current);
     updateClosestBeat(current);
@@ -77,7 +77,7 @@ void QuantizeControl::playPosChanged(double dNewPlaypos) {
 }
 
 void QuantizeControl::lookupBeatPositions(double dCurrentSample) {
-    mixxx::BeatsPointer pBeats = m_pBeats;
+    const mixxx::BeatsPointer pBeats = m_pBeats.getValue();
     if (pBeats) {
         double prevBeat, nextBeat;
         pBeats->findPrevNextBeats(dCurrentSample, &prevBeat, &nextBeat);
@@ -87,7 +87,7 @@ void QuantizeControl::lookupBeatPositions(double dCurrentSample) {
 }
 
 void QuantizeControl::updateClosestBeat(double dCurrentSample) {
-    if (!m_pBeats) {
+    if (!m_pBeats.getValue()) {
         return;
     }
     double prevBeat = m_pCOPrevBeat->get();
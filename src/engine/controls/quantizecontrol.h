@@ -36,5 +36,5 @@ class QuantizeControl : public EngineControl {
     ControlObject* m_pCOClosestBeat;
 
     // m_pBeats is written from an engine worker thread
-    mixxx::BeatsPointer m_pBeats;
+    ControlValueAtomic<mixxx::BeatsPointer> m_pBeats;
 };
@@ -194,6 +194,7 @@ bool EngineEffect::process(const ChannelHandle& inputHandle,
               mixxx::audio::SampleRate(sampleRate),
               numSamples / mixxx::kEngineChannelCount);
 
+        m_cpuLoadMeter.start();
         m_pProcessor->process(inputHandle, outputHandle, pInput, pOutput,
                               bufferParameters,
                               effectiveEffectEnableState, groupFeatures);
@@ -218,6 +219,7 @@ bool EngineEffect::process(const ChannelHandle& inputHandle,
                         numSamples);
             }
         }
+        m_cpuLoadMeter.stop();
     }
 
     // Now that the EffectProcessor has been sent the intermediate enabling/disabling
@@ -15,6 +15,7 @@
 #include "engine/effects/engineeffectparameter.h"
 #include "engine/effects/message.h"
 #include "engine/effects/groupfeaturestate.h"
+#include "util/cpuloadmeter.h"
 
 class EngineEffect : public EffectsRequestHandler {
   public:
@@ -53,6 +54,11 @@ class EngineEffect : public EffectsRequestHandler {
         return m_pManifest;
     }
 
+    /// Accumulates the time spent in process() for all channels.
+    mixxx::CpuLoadMeter& cpuLoadMeter() {
+        return m_cpuLoadMeter;
+    }
+
   private:
     QString debugString() const {
         return QString("EngineEffect(%1)").arg(m_pManifest->name());
@@ -68,5 +74,7 @@ class EngineEffect : public EffectsRequestHandler {
 
     const EffectsManager* m_pEffectsManager;
 
+    mixxx::CpuLoadMeter m_cpuLoadMeter;
+
     DISALLOW_COPY_AND_ASSIGN(EngineEffect);
 };
@@ -257,6 +257,8 @@ bool EngineEffectChain::process(const ChannelHandle& inputHandle,
 
     bool processingOccured = false;
     if (effectiveChainEnableState != EffectEnableState::Disabled) {
+        m_cpuLoadMeter.start();
+
         // Ramping code inside the effects need to access the original samples
         // after writing to the output buffer. This requires not to use the same buffer
         // for in and output: Also, ChannelMixer::applyEffectsAndMixChannels
@@ -335,6 +337,7 @@ bool EngineEffectChain::process(const ChannelHandle& inputHandle,
                         numSamples);
             }
         }
+        m_cpuLoadMeter.stop();
     }
 
     channelStatus.oldMixKnob = currentMixKnob;
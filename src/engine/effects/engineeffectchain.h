@@ -4,6 +4,7 @@
 #include <QList>
 
 #include "util/class.h"
+#include "util/cpuloadmeter.h"
 #include "util/types.h"
 #include "util/samplebuffer.h"
 #include "util/memory.h"
@@ -38,6 +39,12 @@ class EngineEffectChain : public EffectsRequestHandler {
 
     bool enabledForChannel(const ChannelHandle& handle) const;
 
+    /// Accumulates the time spent in process() for all channels, including
+    /// the time spent in the effects of this chain.
+    mixxx::CpuLoadMeter& cpuLoadMeter() {
+        return m_cpuLoadMeter;
+    }
+
     void deleteStatesForInputChannel(const ChannelHandle* channel);
 
   private:
@@ -74,6 +81,7 @@ class EngineEffectChain : public EffectsRequestHandler {
     mixxx::SampleBuffer m_buffer1;
     mixxx::SampleBuffer m_buffer2;
     ChannelHandleMap<ChannelHandleMap<ChannelStatus>> m_chainStatusForChannelMatrix;
+    mixxx::CpuLoadMeter m_cpuLoadMeter;
 
     DISALLOW_COPY_AND_ASSIGN(EngineEffectChain);
 };
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cmath>
+
+/// Per channel copy of an effect parameter, which is updated once per engine
+/// callback from the EffectState of an effect.
+///
+/// Effects that derive filter coefficients from a parameter only need to
+/// redesign their filters when changed() is true. Changes that are smaller
+/// than the threshold are held back while the parameter is moving, so a slow
+/// sweep or a noisy controller does not redesign the filters (and cross fade
+/// between the old and new filter) in every callback. As soon as the
+/// parameter comes to rest the exact value is applied.
+///
+/// Effects that apply a parameter as a gain should ramp it from previous()
+/// to value() over the buffer, e.g. using SampleUtil::copyWithRampingGain(),
+/// to avoid zipper noise.
+class SmoothedParameter {
+  public:
+    enum class Threshold {
+        // The threshold is in the units of the parameter, e.g. dB.
+        Absolute,
+        // The threshold is a fraction of the current value, e.g. for
+        // frequencies.
+        Relative,
+    };
+
+    explicit SmoothedParameter(double initialValue,
+            double threshold = 0.0,
+            Threshold thresholdType = Threshold::Absolute)
+            : m_value(initialValue),
+              m_previous(initialValue),
+              m_target(initialValue),
+              m_threshold(threshold),
+              m_thresholdType(thresholdType),
+              m_changed(false) {
+    }
+
+    /// Applies target if it differs by more than the threshold from the
+    /// current value or if it is the same target as in the previous callback.
+    /// Returns changed().
+    bool update(double target) {
+        const bool settled = target == m_target;
+        m_target = target;
+        const double threshold = m_thresholdType == Threshold::Relative
+                ? m_threshold * std::fabs(m_value)
+                : m_threshold;
+        if (settled || std::fabs(target - m_value) > threshold) {
+            return apply(target);
+        }
+        m_previous = m_value;
+        m_changed = false;
+        return false;
+    }
+
+    /// Applies target regardless of the threshold, e.g. when the effect is
+    /// disabled and needs to ramp to a neutral value within this callback.
+    /// Returns changed().
+    bool force(double target) {
+        m_target = target;
+        return apply(target);
+    }
+
+    /// The value to use in the current callback
+    double value() const {
+        return m_value;
+    }
+
+    /// The value that has been used in the previous callback
+    double previous() const {
+        return m_previous;
+    }
+
+    /// True if value() differs from previous()
+    bool changed() const {
+        return m_changed;
+    }
+
+  private:
+    bool apply(double target) {
+        m_previous = m_value;
+        m_value = target;
+        m_changed = m_value != m_previous;
+        return m_changed;
+    }
+
+    double m_value;
+    double m_previous;
+    // The most recently requested value, which may not have been applied yet
+    double m_target;
+    double m_threshold;
+    Threshold m_thresholdType;
+    bool m_changed;
+};
@@ -325,6 +325,10 @@ void EngineBuffer::bindWorkers(EngineWorkerScheduler* pWorkerScheduler) {
     m_pReader->setScheduler(pWorkerScheduler);
 }
 
+void EngineBuffer::bindPreloader(std::shared_ptr<CachingReaderPreloader> pPreloader) {
+    m_pReader->setPreloader(std::move(pPreloader));
+}
+
 void EngineBuffer::enableIndependentPitchTempoScaling(bool bEnable,
                                                       const int iBufferSize) {
     // MUST ACQUIRE THE PAUSE MUTEX BEFORE CALLING THIS METHOD
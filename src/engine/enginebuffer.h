@@ -94,6 +94,7 @@ class EngineBuffer : public EngineObject {
     virtual ~EngineBuffer();
 
     void bindWorkers(EngineWorkerScheduler* pWorkerScheduler);
+    void bindPreloader(std::shared_ptr<CachingReaderPreloader> pPreloader);
 
     QString getGroup() const;
     // Return the current rate (not thread-safe)
@@ -357,7 +357,9 @@ void EngineMaster::processChannels(int iBufferSize) {
              i < m_activeChannels.size(); ++i) {
         ChannelInfo* pChannelInfo = m_activeChannels[i];
         EngineChannel* pChannel = pChannelInfo->m_pChannel;
+        pChannel->cpuLoadMeter().start();
         pChannel->process(pChannelInfo->m_pBuffer, iBufferSize);
+        pChannel->cpuLoadMeter().stop();
 
         // Collect metadata for effects
         if (m_pEngineEffectsManager) {
@@ -379,6 +381,10 @@ void EngineMaster::processChannels(int iBufferSize) {
             i < m_activeChannels.size(); ++i) {
         m_activeChannels[i]->m_pChannel->postProcess(iBufferSize);
     }
+
+    // Distribute the final beat distance of the master to all followers in
+    // a single pass.
+    m_pMasterSync->onPostProcessEnd();
 }
 
 void EngineMaster::process(const int iBufferSize) {
@@ -7,6 +7,7 @@
 #include <fidlib.h>
 
 #include "engine/engineobject.h"
+#include "engine/filters/stereodouble.h"
 #include "util/sample.h"
 
 // set to 1 to print some analysis data using qDebug()
@@ -83,11 +84,9 @@ class EngineFilterIIR : public EngineFilterIIRBase {
 
     void initBuffers() {
         // Copy the current buffers into the old buffers
-        memcpy(m_oldBuf1, m_buf1, sizeof(m_buf1));
-        memcpy(m_oldBuf2, m_buf2, sizeof(m_buf2));
+        memcpy(m_oldBuf, m_buf, sizeof(m_buf));
         // Set the current buffers to 0
-        memset(m_buf1, 0, sizeof(m_buf1));
-        memset(m_buf2, 0, sizeof(m_buf2));
+        memset(m_buf, 0, sizeof(m_buf));
         m_doRamping = true;
     }
 
@@ -231,10 +230,17 @@ class EngineFilterIIR : public EngineFilterIIRBase {
     virtual void process(const CSAMPLE* pIn, CSAMPLE* pOutput,
                          const int iBufferSize) {
         if (!m_doRamping) {
+            // Work on local copies, so the compiler can keep them in
+            // registers despite the stores to pOutput.
+            double coef[SIZE + 1];
+            StereoDouble buf[SIZE];
+            memcpy(coef, m_coef, sizeof(coef));
+            memcpy(buf, m_buf, sizeof(buf));
             for (int i = 0; i < iBufferSize; i += 2) {
-                pOutput[i] = static_cast<CSAMPLE>(processSample(m_coef, m_buf1, pIn[i]));
-                pOutput[i + 1] = static_cast<CSAMPLE>(processSample(m_coef, m_buf2, pIn[i + 1]));
+                processSample(coef, buf, StereoDouble::load(&pIn[i]))
+                        .store(&pOutput[i]);
             }
+            memcpy(m_buf, buf, sizeof(buf));
         } else {
             double cross_mix = 0.0;
             double cross_inc = 4.0 / static_cast<double>(iBufferSize);
@@ -250,12 +256,14 @@ class EngineFilterIIR : public EngineFilterIIRBase {
                 // of the new filter but it turns out that this produces
                 // a gain drop due to the filter delay which is more
                 // conspicuous than the settling noise.
+                const StereoDouble in = StereoDouble::load(&pIn[i]);
                 double old1;
                 double old2;
                 if (!m_doStart) {
                     // Process old filter, but only if we do not do a fresh start
-                    old1 = static_cast<CSAMPLE>(processSample(m_oldCoef, m_oldBuf1, pIn[i]));
-                    old2 = static_cast<CSAMPLE>(processSample(m_oldCoef, m_oldBuf2, pIn[i + 1]));
+                    const StereoDouble old = processSample(m_oldCoef, m_oldBuf, in);
+                    old1 = static_cast<CSAMPLE>(old.left());
+                    old2 = static_cast<CSAMPLE>(old.right());
                 } else {
                     if (m_startFromDry) {
                         old1 = pIn[i];
@@ -265,8 +273,9 @@ class EngineFilterIIR : public EngineFilterIIRBase {
                         old2 = 0;
                     }
                 }
-                double new1 = static_cast<CSAMPLE>(processSample(m_coef, m_buf1, pIn[i]));
-                double new2 = static_cast<CSAMPLE>(processSample(m_coef, m_buf2, pIn[i + 1]));
+                const StereoDouble out = processSample(m_coef, m_buf, in);
+                double new1 = static_cast<CSAMPLE>(out.left());
+                double new2 = static_cast<CSAMPLE>(out.right());
 
                 if (i < iBufferSize / 2) {
                     pOutput[i] = static_cast<CSAMPLE>(old1);
@@ -284,11 +293,11 @@ class EngineFilterIIR : public EngineFilterIIRBase {
     }
 
   protected:
-    inline double processSample(double* coef, double* buf, double val);
+    // Processes the left and right channel in parallel
+    inline StereoDouble processSample(const double* coef, StereoDouble* buf, StereoDouble val);
     inline void pauseFilterInner() {
         // Set the current buffers to 0
-        memset(m_buf1, 0, sizeof(m_buf1));
-        memset(m_buf2, 0, sizeof(m_buf2));
+        memset(m_buf, 0, sizeof(m_buf));
         m_doRamping = true;
         m_doStart = true;
     }
@@ -297,15 +306,10 @@ class EngineFilterIIR : public EngineFilterIIRBase {
     // Old coefficients needed for ramping
     double m_oldCoef[SIZE + 1];
 
-    // Channel 1 state
-    double m_buf1[SIZE];
-    // Old channel 1 buffer needed for ramping
-    double m_oldBuf1[SIZE];
-
-    // Channel 2 state
-    double m_buf2[SIZE];
-    // Old channel 2 buffer needed for ramping
-    double m_oldBuf2[SIZE];
+    // State of both channels
+    StereoDouble m_buf[SIZE];
+    // Old buffer needed for ramping
+    StereoDouble m_oldBuf[SIZE];
 
     // Flag set to true if ramping needs to be done
     bool m_doRamping;
@@ -316,10 +320,10 @@ class EngineFilterIIR : public EngineFilterIIRBase {
 };
 
 template<>
-inline double EngineFilterIIR<2, IIR_LP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
+inline StereoDouble EngineFilterIIR<2, IIR_LP>::processSample(const double* coef,
+                                                              StereoDouble* buf,
+                                                              StereoDouble val) {
+    StereoDouble tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1];
     iir = val * coef[0];
     iir -= coef[1] * tmp; fir = tmp;
@@ -330,10 +334,10 @@ inline double EngineFilterIIR<2, IIR_LP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<2, IIR_BP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
+inline StereoDouble EngineFilterIIR<2, IIR_BP>::processSample(const double* coef,
+                                                              StereoDouble* buf,
+                                                              StereoDouble val) {
+    StereoDouble tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1];
     iir = val * coef[0];
     iir -= coef[1] * tmp; fir = -tmp;
@@ -344,10 +348,10 @@ inline double EngineFilterIIR<2, IIR_BP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<2, IIR_HP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
+inline StereoDouble EngineFilterIIR<2, IIR_HP>::processSample(const double* coef,
+                                                              StereoDouble* buf,
+                                                              StereoDouble val) {
+    StereoDouble tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1];
     iir = val * coef[0];
     iir -= coef[1] * tmp; fir = tmp;
@@ -358,10 +362,10 @@ inline double EngineFilterIIR<2, IIR_HP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<4, IIR_LP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
+inline StereoDouble EngineFilterIIR<4, IIR_LP>::processSample(const double* coef,
+                                                              StereoDouble* buf,
+                                                              StereoDouble val) {
+    StereoDouble tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
     iir = val * coef[0];
     iir -= coef[1] * tmp; fir = tmp;
@@ -377,10 +381,10 @@ inline double EngineFilterIIR<4, IIR_LP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<8, IIR_BP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
+inline StereoDouble EngineFilterIIR<8, IIR_BP>::processSample(const double* coef,
+                                                              StereoDouble* buf,
+                                                              StereoDouble val) {
+    StereoDouble tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
     buf[3] = buf[4]; buf[4] = buf[5]; buf[5] = buf[6]; buf[6] = buf[7];
     iir = val * coef[0];
@@ -407,10 +411,10 @@ inline double EngineFilterIIR<8, IIR_BP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<4, IIR_HP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
+inline StereoDouble EngineFilterIIR<4, IIR_HP>::processSample(const double* coef,
+                                                              StereoDouble* buf,
+                                                              StereoDouble val) {
+    StereoDouble tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
     iir= val * coef[0];
     iir -= coef[1] * tmp; fir = tmp;
@@ -426,10 +430,10 @@ inline double EngineFilterIIR<4, IIR_HP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<8, IIR_LP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
+inline StereoDouble EngineFilterIIR<8, IIR_LP>::processSample(const double* coef,
+                                                              StereoDouble* buf,
+                                                              StereoDouble val) {
+    StereoDouble tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
     buf[3] = buf[4]; buf[4] = buf[5]; buf[5] = buf[6]; buf[6] = buf[7];
     iir = val * coef[0];
@@ -456,10 +460,10 @@ inline double EngineFilterIIR<8, IIR_LP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<16, IIR_BP>::processSample(double* coef,
-                                                         double* buf,
-                                                         double val) {
-    double tmp, fir, iir;
+inline StereoDouble EngineFilterIIR<16, IIR_BP>::processSample(const double* coef,
+                                                               StereoDouble* buf,
+                                                               StereoDouble val) {
+    StereoDouble tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
     buf[3] = buf[4]; buf[4] = buf[5]; buf[5] = buf[6]; buf[6] = buf[7];
     buf[7] = buf[8]; buf[8] = buf[9]; buf[9] = buf[10]; buf[10] = buf[11];
@@ -508,10 +512,10 @@ inline double EngineFilterIIR<16, IIR_BP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<8, IIR_HP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
+inline StereoDouble EngineFilterIIR<8, IIR_HP>::processSample(const double* coef,
+                                                              StereoDouble* buf,
+                                                              StereoDouble val) {
+    StereoDouble tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
     buf[3] = buf[4]; buf[4] = buf[5]; buf[5] = buf[6]; buf[6] = buf[7];
     iir = val * coef[0];
@@ -539,10 +543,10 @@ inline double EngineFilterIIR<8, IIR_HP>::processSample(double* coef,
 
 // IIR_LP and IIR_HP use the same processSample routine
 template<>
-inline double EngineFilterIIR<5, IIR_BP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
+inline StereoDouble EngineFilterIIR<5, IIR_BP>::processSample(const double* coef,
+                                                              StereoDouble* buf,
+                                                              StereoDouble val) {
+    StereoDouble tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1];
     iir = val * coef[0];
     iir -= coef[1] * tmp; fir = coef[2] * tmp;
@@ -553,10 +557,10 @@ inline double EngineFilterIIR<5, IIR_BP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<4, IIR_LPMO>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-   double tmp, fir, iir;
+inline StereoDouble EngineFilterIIR<4, IIR_LPMO>::processSample(const double* coef,
+                                                              StereoDouble* buf,
+                                                              StereoDouble val) {
+   StereoDouble tmp, fir, iir;
    tmp= buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
    iir= val * coef[0];
    iir -= coef[1]*tmp; fir= tmp;
@@ -579,10 +583,10 @@ inline double EngineFilterIIR<4, IIR_LPMO>::processSample(double* coef,
 
 
 template<>
-inline double EngineFilterIIR<4, IIR_HPMO>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-   double tmp, fir, iir;
+inline StereoDouble EngineFilterIIR<4, IIR_HPMO>::processSample(const double* coef,
+                                                              StereoDouble* buf,
+                                                              StereoDouble val) {
+   StereoDouble tmp, fir, iir;
    tmp= buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
    iir= val * coef[0];
    iir -= coef[1]*tmp; fir= -tmp;
@@ -604,10 +608,10 @@ inline double EngineFilterIIR<4, IIR_HPMO>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<2, IIR_LP2>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
+inline StereoDouble EngineFilterIIR<2, IIR_LP2>::processSample(const double* coef,
+                                                              StereoDouble* buf,
+                                                              StereoDouble val) {
+    StereoDouble tmp, fir, iir;
     tmp = buf[0];
     iir = val * coef[0];
     iir -= coef[1] * tmp; fir = tmp;
@@ -625,10 +629,10 @@ inline double EngineFilterIIR<2, IIR_LP2>::processSample(double* coef,
 
 
 template<>
-inline double EngineFilterIIR<2, IIR_HP2>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
+inline StereoDouble EngineFilterIIR<2, IIR_HP2>::processSample(const double* coef,
+                                                              StereoDouble* buf,
+                                                              StereoDouble val) {
+    StereoDouble tmp, fir, iir;
     tmp = buf[0];
     iir = val * -coef[0]; // swap gain to be in phase with LP2
     iir -= coef[1] * tmp; fir = -tmp;
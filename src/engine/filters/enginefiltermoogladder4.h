@@ -181,6 +181,11 @@ class EngineFilterMoogLadderBase : public EngineObjectConstIn {
         m_buffersClear = false;
     }
 
+    // Unlike EngineFilterIIR, both channels are processed one after the
+    // other instead of in the lanes of a StereoDouble. The ladder is
+    // computed in float precision, and the divisions of tanh_approx()
+    // dominate its cost. Doubles would change the output of the filter,
+    // so it has been left as it is.
     inline CSAMPLE processSample(float input, struct Buffer* pB) {
 
         const float v2 = 2 + kVt;   // twice the 'thermal voltage of a transistor'
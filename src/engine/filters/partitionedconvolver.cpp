@@ -0,0 +1,173 @@
+#include "engine/filters/partitionedconvolver.h"
+
+#include <dsp/transforms/FFT.h>
+
+#include <algorithm>
+
+#include "util/assert.h"
+#include "util/math.h"
+
+namespace {
+
+constexpr SINT kFftSize = 2 * PartitionedConvolver::kPartitionFrames;
+// Only the non-redundant half of the spectrum of a real signal is used
+constexpr SINT kBinCount = PartitionedConvolver::kPartitionFrames + 1;
+
+// LOOP VECTORIZED: The split real/imaginary layout allows the compiler to
+// process multiple bins at once in SSE/AVX registers.
+inline void multiplyAccumulate(
+        double* pAccumulatorReal,
+        double* pAccumulatorImag,
+        const double* pReal1,
+        const double* pImag1,
+        const double* pReal2,
+        const double* pImag2) {
+    for (SINT i = 0; i < kBinCount; ++i) {
+        pAccumulatorReal[i] += pReal1[i] * pReal2[i] - pImag1[i] * pImag2[i];
+        pAccumulatorImag[i] += pReal1[i] * pImag2[i] + pImag1[i] * pReal2[i];
+    }
+}
+
+} // anonymous namespace
+
+PartitionedConvolver::Kernel::Kernel(
+        const CSAMPLE* pImpulseResponse, SINT length, SINT stride)
+        : m_partitionCount(math_max(static_cast<SINT>(1),
+                  (length + kPartitionFrames - 1) / kPartitionFrames)),
+          m_real(m_partitionCount * kBinCount),
+          m_imag(m_partitionCount * kBinCount) {
+    DEBUG_ASSERT(stride > 0);
+    FFTReal fft(kFftSize);
+    // The partitions are zero-padded to the FFT size
+    std::vector<double> time(kFftSize, 0.0);
+    std::vector<double> real(kFftSize);
+    std::vector<double> imag(kFftSize);
+    for (SINT partition = 0; partition < m_partitionCount; ++partition) {
+        const SINT offset = partition * kPartitionFrames;
+        for (SINT i = 0; i < kPartitionFrames; ++i) {
+            time[i] = offset + i < length ? pImpulseResponse[(offset + i) * stride] : 0.0;
+        }
+        fft.forward(time.data(), real.data(), imag.data());
+        std::copy(real.begin(),
+                real.begin() + kBinCount,
+                m_real.begin() + partition * kBinCount);
+        std::copy(imag.begin(),
+                imag.begin() + kBinCount,
+                m_imag.begin() + partition * kBinCount);
+    }
+}
+
+PartitionedConvolver::PartitionedConvolver(KernelPointer pKernel)
+        : m_pKernel(pKernel),
+          m_pFft(std::make_unique<FFTReal>(kFftSize)),
+          m_inputWindow(kFftSize, 0.0),
+          m_inputFrames(0),
+          m_output(kPartitionFrames, 0),
+          m_delayLineReal(pKernel->partitionCount() * kBinCount, 0.0),
+          m_delayLineImag(pKernel->partitionCount() * kBinCount, 0.0),
+          m_delayLineHead(0),
+          m_accumulatorReal(kBinCount, 0.0),
+          m_accumulatorImag(kBinCount, 0.0),
+          m_accumulatedPartitions(1),
+          m_fftReal(kFftSize),
+          m_fftImag(kFftSize),
+          m_fftTime(kFftSize) {
+}
+
+// Required for the forward declared FFTReal in the std::unique_ptr
+PartitionedConvolver::~PartitionedConvolver() = default;
+
+void PartitionedConvolver::clear() {
+    std::fill(m_inputWindow.begin(), m_inputWindow.end(), 0.0);
+    m_inputFrames = 0;
+    std::fill(m_output.begin(), m_output.end(), 0);
+    std::fill(m_delayLineReal.begin(), m_delayLineReal.end(), 0.0);
+    std::fill(m_delayLineImag.begin(), m_delayLineImag.end(), 0.0);
+    std::fill(m_accumulatorReal.begin(), m_accumulatorReal.end(), 0.0);
+    std::fill(m_accumulatorImag.begin(), m_accumulatorImag.end(), 0.0);
+    m_accumulatedPartitions = 1;
+}
+
+void PartitionedConvolver::process(
+        const CSAMPLE* pIn, CSAMPLE* pOut, SINT frames, SINT stride) {
+    const SINT partitionCount = m_pKernel->partitionCount();
+    SINT frame = 0;
+    while (frame < frames) {
+        const SINT chunkFrames = math_min(frames - frame, kPartitionFrames - m_inputFrames);
+        double* pInputPartition = &m_inputWindow[kPartitionFrames + m_inputFrames];
+        const CSAMPLE* pOutputPartition = &m_output[m_inputFrames];
+        for (SINT i = 0; i < chunkFrames; ++i) {
+            const SINT index = (frame + i) * stride;
+            // Read the input before writing the output, the buffers may alias
+            pInputPartition[i] = pIn[index];
+            pOut[index] = pOutputPartition[i];
+        }
+        m_inputFrames += chunkFrames;
+        frame += chunkFrames;
+
+        if (m_inputFrames == kPartitionFrames) {
+            processPartition();
+            m_inputFrames = 0;
+        } else {
+            // Only accumulate the share of the older partitions that
+            // corresponds to the share of the input partition that has been
+            // received so far.
+            accumulatePartitions(
+                    1 + (partitionCount - 1) * m_inputFrames / kPartitionFrames);
+        }
+    }
+}
+
+void PartitionedConvolver::accumulatePartitions(SINT partitionCount) {
+    const SINT delayLineLength = m_pKernel->partitionCount();
+    for (SINT partition = m_accumulatedPartitions; partition < partitionCount; ++partition) {
+        // The input spectrum that is partition - 1 partitions older than the
+        // most recent one, because the current input partition is incomplete.
+        const SINT slot = (m_delayLineHead - (partition - 1) + delayLineLength) %
+                delayLineLength;
+        multiplyAccumulate(m_accumulatorReal.data(),
+                m_accumulatorImag.data(),
+                &m_delayLineReal[slot * kBinCount],
+                &m_delayLineImag[slot * kBinCount],
+                &m_pKernel->m_real[partition * kBinCount],
+                &m_pKernel->m_imag[partition * kBinCount]);
+    }
+    m_accumulatedPartitions = math_max(m_accumulatedPartitions, partitionCount);
+}
+
+void PartitionedConvolver::processPartition() {
+    const SINT partitionCount = m_pKernel->partitionCount();
+    accumulatePartitions(partitionCount);
+
+    // Transform the window of the previous and the current input partition
+    // and push its spectrum into the delay line.
+    m_pFft->forward(m_inputWindow.data(), m_fftReal.data(), m_fftImag.data());
+    m_delayLineHead = (m_delayLineHead + 1) % partitionCount;
+    std::copy(m_fftReal.begin(),
+            m_fftReal.begin() + kBinCount,
+            m_delayLineReal.begin() + m_delayLineHead * kBinCount);
+    std::copy(m_fftImag.begin(),
+            m_fftImag.begin() + kBinCount,
+            m_delayLineImag.begin() + m_delayLineHead * kBinCount);
+
+    multiplyAccumulate(m_accumulatorReal.data(),
+            m_accumulatorImag.data(),
+            &m_delayLineReal[m_delayLineHead * kBinCount],
+            &m_delayLineImag[m_delayLineHead * kBinCount],
+            &m_pKernel->m_real[0],
+            &m_pKernel->m_imag[0]);
+
+    // Overlap-save: Only the second half of the circular convolution is free
+    // of time domain aliasing.
+    m_pFft->inverse(m_accumulatorReal.data(), m_accumulatorImag.data(), m_fftTime.data());
+    for (SINT i = 0; i < kPartitionFrames; ++i) {
+        m_output[i] = static_cast<CSAMPLE>(m_fftTime[kPartitionFrames + i]);
+    }
+
+    std::copy(m_inputWindow.begin() + kPartitionFrames,
+            m_inputWindow.end(),
+            m_inputWindow.begin());
+    std::fill(m_accumulatorReal.begin(), m_accumulatorReal.end(), 0.0);
+    std::fill(m_accumulatorImag.begin(), m_accumulatorImag.end(), 0.0);
+    m_accumulatedPartitions = 1;
+}
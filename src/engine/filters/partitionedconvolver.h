@@ -0,0 +1,96 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "util/class.h"
+#include "util/types.h"
+
+class FFTReal;
+
+/// Mono convolution with a long impulse response using uniformly partitioned
+/// overlap-save convolution in the frequency domain.
+///
+/// The impulse response is split into partitions of kPartitionFrames samples
+/// and their spectra are precomputed once in a Kernel, which is immutable and
+/// can be shared between many convolvers, e.g. for all channels an effect is
+/// routed to. The input spectra are kept in a frequency domain delay line, so
+/// each partition only costs one complex multiply-accumulate per bin instead
+/// of a time domain convolution.
+///
+/// All memory is allocated in the constructor. process() neither allocates
+/// nor locks and can be called with any number of frames per invocation. The
+/// output is delayed by kPartitionFrames frames. The multiply-accumulate work
+/// for the older partitions is spread evenly over all invocations within a
+/// partition, which keeps the cost per engine callback stable even when the
+/// engine buffer is smaller than a partition.
+class PartitionedConvolver {
+  public:
+    static constexpr SINT kPartitionFrames = 256;
+
+    class Kernel {
+      public:
+        /// Reads length samples from pImpulseResponse that are stride samples
+        /// apart. Must not be called from the engine thread.
+        Kernel(const CSAMPLE* pImpulseResponse, SINT length, SINT stride = 1);
+
+        SINT partitionCount() const {
+            return m_partitionCount;
+        }
+
+      private:
+        friend class PartitionedConvolver;
+
+        SINT m_partitionCount;
+        // The first kPartitionFrames + 1 bins of each partition spectrum,
+        // stored as separate real and imaginary arrays for vectorization.
+        std::vector<double> m_real;
+        std::vector<double> m_imag;
+    };
+    typedef std::shared_ptr<const Kernel> KernelPointer;
+
+    /// Must not be called from the engine thread.
+    explicit PartitionedConvolver(KernelPointer pKernel);
+    ~PartitionedConvolver();
+
+    /// Convolves frames samples from pIn that are stride samples apart and
+    /// writes the result to the corresponding samples of pOut. pIn and pOut
+    /// may be the same buffer.
+    void process(const CSAMPLE* pIn, CSAMPLE* pOut, SINT frames, SINT stride = 1);
+
+    /// Discards the input history, i.e. silences the tail of the convolution.
+    void clear();
+
+  private:
+    void accumulatePartitions(SINT partitionCount);
+    void processPartition();
+
+    const KernelPointer m_pKernel;
+    const std::unique_ptr<FFTReal> m_pFft;
+
+    // The previous and the current (partially filled) input partition
+    std::vector<double> m_inputWindow;
+    SINT m_inputFrames;
+    // Output of the last completed partition, delayed by kPartitionFrames
+    std::vector<CSAMPLE> m_output;
+
+    // Frequency domain delay line with the spectra of the most recent input
+    // windows. m_delayLineHead is the index of the most recent spectrum.
+    std::vector<double> m_delayLineReal;
+    std::vector<double> m_delayLineImag;
+    SINT m_delayLineHead;
+
+    // Sum of the products of the older input spectra with the corresponding
+    // kernel partitions. m_accumulatedPartitions is the index of the next
+    // partition that needs to be accumulated for the current output.
+    std::vector<double> m_accumulatorReal;
+    std::vector<double> m_accumulatorImag;
+    SINT m_accumulatedPartitions;
+
+    // Scratch buffers for the transforms
+    std::vector<double> m_fftReal;
+    std::vector<double> m_fftImag;
+    std::vector<double> m_fftTime;
+
+    DISALLOW_COPY_AND_ASSIGN(PartitionedConvolver);
+};
@@ -0,0 +1,116 @@
+#pragma once
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define STEREODOUBLE_SSE2 1
+#include <emmintrin.h>
+#else
+#define STEREODOUBLE_SSE2 0
+#endif
+
+/// A pair of left and right channel values that are processed in parallel.
+///
+/// The IIR filters use it to process both channels in the two lanes of a
+/// single SSE2 register, which is a core part of all x86-64 CPUs and enabled
+/// in our portable x86 builds. Other platforms use two plain doubles, which
+/// gives the compiler the chance to vectorize it for NEON.
+///
+/// Like double, it is a trivial type that is not initialized by default and
+/// can be zeroed with memset().
+class StereoDouble {
+  public:
+    StereoDouble() = default;
+#if STEREODOUBLE_SSE2
+    StereoDouble(double left, double right)
+            : m_value(_mm_set_pd(right, left)) {
+    }
+
+    /// Loads an interleaved stereo frame
+    static StereoDouble load(const float* pFrame) {
+        return StereoDouble(_mm_cvtps_pd(_mm_castsi128_ps(
+                _mm_loadl_epi64(reinterpret_cast<const __m128i*>(pFrame)))));
+    }
+    /// Stores the rounded values as an interleaved stereo frame
+    void store(float* pFrame) const {
+        _mm_storel_pi(reinterpret_cast<__m64*>(pFrame), _mm_cvtpd_ps(m_value));
+    }
+
+    double left() const {
+        return _mm_cvtsd_f64(m_value);
+    }
+    double right() const {
+        return _mm_cvtsd_f64(_mm_unpackhi_pd(m_value, m_value));
+    }
+
+    StereoDouble operator+(StereoDouble other) const {
+        return StereoDouble(_mm_add_pd(m_value, other.m_value));
+    }
+    StereoDouble operator-(StereoDouble other) const {
+        return StereoDouble(_mm_sub_pd(m_value, other.m_value));
+    }
+    StereoDouble operator-() const {
+        // Flip the sign bits, like the negation of a double
+        return StereoDouble(_mm_xor_pd(m_value, _mm_set1_pd(-0.0)));
+    }
+    StereoDouble operator*(double factor) const {
+        return StereoDouble(_mm_mul_pd(m_value, _mm_set1_pd(factor)));
+    }
+#else
+    StereoDouble(double left, double right)
+            : m_left(left),
+              m_right(right) {
+    }
+
+    /// Loads an interleaved stereo frame
+    static StereoDouble load(const float* pFrame) {
+        return StereoDouble(pFrame[0], pFrame[1]);
+    }
+    /// Stores the rounded values as an interleaved stereo frame
+    void store(float* pFrame) const {
+        pFrame[0] = static_cast<float>(m_left);
+        pFrame[1] = static_cast<float>(m_right);
+    }
+
+    double left() const {
+        return m_left;
+    }
+    double right() const {
+        return m_right;
+    }
+
+    StereoDouble operator+(StereoDouble other) const {
+        return StereoDouble(m_left + other.m_left, m_right + other.m_right);
+    }
+    StereoDouble operator-(StereoDouble other) const {
+        return StereoDouble(m_left - other.m_left, m_right - other.m_right);
+    }
+    StereoDouble operator-() const {
+        return StereoDouble(-m_left, -m_right);
+    }
+    StereoDouble operator*(double factor) const {
+        return StereoDouble(m_left * factor, m_right * factor);
+    }
+#endif
+
+    StereoDouble& operator+=(StereoDouble other) {
+        return *this = *this + other;
+    }
+    StereoDouble& operator-=(StereoDouble other) {
+        return *this = *this - other;
+    }
+
+  private:
+#if STEREODOUBLE_SSE2
+    explicit StereoDouble(__m128d value)
+            : m_value(value) {
+    }
+
+    __m128d m_value;
+#else
+    double m_left;
+    double m_right;
+#endif
+};
+
+inline StereoDouble operator*(double factor, StereoDouble value) {
+    return value * factor;
+}
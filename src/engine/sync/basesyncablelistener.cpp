@@ -3,6 +3,7 @@
 #include <QMetaType>
 
 #include "engine/sync/internalclock.h"
+#include "util/assert.h"
 
 namespace {
 
@@ -13,7 +14,12 @@ const QString kInternalClockGroup = QStringLiteral("[InternalClock]");
 BaseSyncableListener::BaseSyncableListener(UserSettingsPointer pConfig)
         : m_pConfig(pConfig),
           m_pInternalClock(new InternalClock(kInternalClockGroup, this)),
-          m_pMasterSyncable(nullptr) {
+          m_pMasterSyncable(nullptr),
+          m_syncedSyncablesDirty(true),
+          m_engineThreadId(std::thread::id()),
+          m_bInCallback(false),
+          m_pPendingBeatDistanceSource(nullptr),
+          m_pendingBeatDistance(0.0) {
     qRegisterMetaType<SyncMode>("SyncMode");
     m_pInternalClock->setMasterBpm(124.0);
 }
@@ -31,9 +37,15 @@ void BaseSyncableListener::addSyncableDeck(Syncable* pSyncable) {
         return;
     }
     m_syncables.append(pSyncable);
+    // Gathering the synced Syncables must not allocate in the engine thread
+    m_syncedSyncables.reserve(m_syncables.size());
+    invalidateSyncedSyncables();
 }
 
 void BaseSyncableListener::onCallbackStart(int sampleRate, int bufferSize) {
+    m_engineThreadId.store(std::this_thread::get_id(), std::memory_order_relaxed);
+    invalidateSyncedSyncables();
+    m_bInCallback = true;
     m_pInternalClock->onCallbackStart(sampleRate, bufferSize);
 }
 
@@ -41,6 +53,65 @@ void BaseSyncableListener::onCallbackEnd(int sampleRate, int bufferSize) {
     m_pInternalClock->onCallbackEnd(sampleRate, bufferSize);
 }
 
+void BaseSyncableListener::onPostProcessEnd() {
+    m_bInCallback = false;
+    Syncable* pSource = m_pPendingBeatDistanceSource;
+    if (!pSource) {
+        return;
+    }
+    m_pPendingBeatDistanceSource = nullptr;
+    // Drop the update if the master has been handed off in the meantime. The
+    // new master has already distributed its params on activation.
+    if (pSource != m_pMasterSyncable) {
+        return;
+    }
+    setMasterBeatDistance(pSource, m_pendingBeatDistance);
+}
+
+void BaseSyncableListener::setSyncMode(Syncable* pSyncable, SyncMode mode) {
+    pSyncable->setSyncMode(mode);
+    invalidateSyncedSyncables();
+}
+
+const std::vector<Syncable*>& BaseSyncableListener::syncedSyncables() {
+    DEBUG_ASSERT(isEngineThread());
+    // Clear the flag before gathering, so a concurrent sync mode change
+    // marks the list as dirty again.
+    if (m_syncedSyncablesDirty.exchange(false, std::memory_order_acquire)) {
+        m_syncedSyncables.clear();
+        for (Syncable* pSyncable : qAsConst(m_syncables)) {
+            if (pSyncable->isSynchronized()) {
+                m_syncedSyncables.push_back(pSyncable);
+            }
+        }
+    }
+    return m_syncedSyncables;
+}
+
+template<typename Func>
+void BaseSyncableListener::forEachSyncedSyncable(Syncable* pSource, Func func) {
+    if (!isEngineThread()) {
+        for (Syncable* pSyncable : qAsConst(m_syncables)) {
+            if (pSyncable == pSource || !pSyncable->isSynchronized()) {
+                continue;
+            }
+            func(pSyncable);
+        }
+        return;
+    }
+    // Indexed, because a Syncable may change sync modes in response, which
+    // gathers the list again. The capacity is reserved, so this never
+    // reallocates.
+    const std::vector<Syncable*>& syncables = syncedSyncables();
+    for (std::size_t i = 0; i < syncables.size(); ++i) {
+        Syncable* pSyncable = syncables[i];
+        if (pSyncable == pSource) {
+            continue;
+        }
+        func(pSyncable);
+    }
+}
+
 EngineChannel* BaseSyncableListener::getMaster() const {
     return m_pMasterSyncable ? m_pMasterSyncable->getChannel() : nullptr;
 }
@@ -89,39 +160,34 @@ void BaseSyncableListener::setMasterBpm(Syncable* pSource, double bpm) {
     if (pSource != m_pInternalClock) {
         m_pInternalClock->setMasterBpm(bpm);
     }
-    foreach (Syncable* pSyncable, m_syncables) {
-        if (pSyncable == pSource ||
-                !pSyncable->isSynchronized()) {
-            continue;
-        }
+    forEachSyncedSyncable(pSource, [bpm](Syncable* pSyncable) {
         pSyncable->setMasterBpm(bpm);
-    }
+    });
 }
 
 void BaseSyncableListener::setMasterInstantaneousBpm(Syncable* pSource, double bpm) {
     if (pSource != m_pInternalClock) {
         m_pInternalClock->setInstantaneousBpm(bpm);
     }
-    foreach (Syncable* pSyncable, m_syncables) {
-        if (pSyncable == pSource ||
-                !pSyncable->isSynchronized()) {
-            continue;
-        }
+    forEachSyncedSyncable(pSource, [bpm](Syncable* pSyncable) {
         pSyncable->setInstantaneousBpm(bpm);
-    }
+    });
 }
 
 void BaseSyncableListener::setMasterBeatDistance(Syncable* pSource, double beat_distance) {
+    if (isEngineThread() && m_bInCallback) {
+        // The followers only need the beat distance after they have been
+        // post-processed, so only the last update is distributed.
+        m_pPendingBeatDistanceSource = pSource;
+        m_pendingBeatDistance = beat_distance;
+        return;
+    }
     if (pSource != m_pInternalClock) {
         m_pInternalClock->setMasterBeatDistance(beat_distance);
     }
-    foreach (Syncable* pSyncable, m_syncables) {
-        if (pSyncable == pSource ||
-                !pSyncable->isSynchronized()) {
-            continue;
-        }
+    forEachSyncedSyncable(pSource, [beat_distance](Syncable* pSyncable) {
         pSyncable->setMasterBeatDistance(beat_distance);
-    }
+    });
 }
 
 void BaseSyncableListener::setMasterParams(Syncable* pSource, double beat_distance,
@@ -130,13 +196,9 @@ void BaseSyncableListener::setMasterParams(Syncable* pSource, double beat_distan
     if (pSource != m_pInternalClock) {
         m_pInternalClock->setMasterParams(beat_distance, base_bpm, bpm);
     }
-    foreach (Syncable* pSyncable, m_syncables) {
-        if (pSyncable == pSource ||
-                !pSyncable->isSynchronized()) {
-            continue;
-        }
+    forEachSyncedSyncable(pSource, [beat_distance, base_bpm, bpm](Syncable* pSyncable) {
         pSyncable->setMasterParams(beat_distance, base_bpm, bpm);
-    }
+    });
 }
 
 void BaseSyncableListener::checkUniquePlayingSyncable() {
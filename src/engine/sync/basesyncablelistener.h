@@ -1,5 +1,9 @@
 #pragma once
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 #include "engine/sync/syncable.h"
 #include "preferences/usersettings.h"
 
@@ -20,6 +24,10 @@ class BaseSyncableListener : public SyncableListener {
     EngineChannel* getMaster() const;
     void onCallbackStart(int sampleRate, int bufferSize);
     void onCallbackEnd(int sampleRate, int bufferSize);
+    // Distributes the beat distance that the master has reported during the
+    // callback to all followers at once. Called after all channels have been
+    // post-processed.
+    void onPostProcessEnd();
 
     // Only for testing. Do not use.
     Syncable* getSyncableForGroup(const QString& group);
@@ -61,6 +69,10 @@ class BaseSyncableListener : public SyncableListener {
     // Check if there is only one playing syncable deck, and notify it if so.
     void checkUniquePlayingSyncable();
 
+    // Changes the sync mode of pSyncable. All sync mode changes must be made
+    // through this function to keep the list of synced Syncables up to date.
+    void setSyncMode(Syncable* pSyncable, SyncMode mode);
+
     UserSettingsPointer m_pConfig;
     // The InternalClock syncable.
     InternalClock* m_pInternalClock;
@@ -69,4 +81,39 @@ class BaseSyncableListener : public SyncableListener {
     // The list of all Syncables registered with BaseSyncableListener via
     // addSyncableDeck.
     QList<Syncable*> m_syncables;
+
+  private:
+    void invalidateSyncedSyncables() {
+        m_syncedSyncablesDirty.store(true, std::memory_order_release);
+    }
+    bool isEngineThread() const {
+        return std::this_thread::get_id() ==
+                m_engineThreadId.load(std::memory_order_relaxed);
+    }
+    const std::vector<Syncable*>& syncedSyncables();
+
+    // Invokes func for every synchronized Syncable except pSource. On the
+    // engine thread the gathered list is used. Sync mode changes of paused
+    // decks are requested from other threads, which must not touch that
+    // list and query the sync mode of every registered Syncable instead.
+    template<typename Func>
+    void forEachSyncedSyncable(Syncable* pSource, Func func);
+
+    // The subset of m_syncables that is synchronized. It is gathered once per
+    // callback and after sync mode changes, so distributing the master params
+    // does not need to query every registered deck and sampler. It is only
+    // ever gathered and read by the engine thread. Other threads just mark
+    // it as dirty.
+    std::vector<Syncable*> m_syncedSyncables;
+    std::atomic<bool> m_syncedSyncablesDirty;
+
+    // The thread that has invoked onCallbackStart()
+    std::atomic<std::thread::id> m_engineThreadId;
+
+    // While a callback is processed, the beat distance updates of the master
+    // are collected and only the last one is distributed by onPostProcessEnd().
+    // Only accessed by the engine thread.
+    bool m_bInCallback;
+    Syncable* m_pPendingBeatDistanceSource;
+    double m_pendingBeatDistance;
 };
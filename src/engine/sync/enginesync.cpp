@@ -100,7 +100,7 @@ void EngineSync::requestSyncMode(Syncable* pSyncable, SyncMode mode) {
         if (m_pMasterSyncable == pSyncable) {
             // This Syncable was master before. Hand off.
             m_pMasterSyncable = nullptr;
-            pSyncable->setSyncMode(SYNC_FOLLOWER);
+            setSyncMode(pSyncable, SYNC_FOLLOWER);
         }
         Syncable* newMaster = pickMaster(pSyncable);
         if (newMaster) {
@@ -222,7 +222,7 @@ void EngineSync::requestEnableSync(Syncable* pSyncable, bool bEnabled) {
     }
 
     if (newMaster != pSyncable) {
-        pSyncable->setSyncMode(SYNC_FOLLOWER);
+        setSyncMode(pSyncable, SYNC_FOLLOWER);
     }
 
     if (pParamsSyncable != nullptr) {
@@ -327,7 +327,7 @@ void EngineSync::activateFollower(Syncable* pSyncable) {
         return;
     }
 
-    pSyncable->setSyncMode(SYNC_FOLLOWER);
+    setSyncMode(pSyncable, SYNC_FOLLOWER);
     pSyncable->setMasterParams(masterBeatDistance(), masterBaseBpm(), masterBpm());
     pSyncable->setInstantaneousBpm(masterBpm());
 }
@@ -347,9 +347,9 @@ void EngineSync::activateMaster(Syncable* pSyncable, bool explicitMaster) {
         // Already master, update the explicit State.
         if (explicitMaster) {
             if (m_pMasterSyncable->getSyncMode() != SYNC_MASTER_EXPLICIT) {
-                m_pMasterSyncable->setSyncMode(SYNC_MASTER_EXPLICIT);
+                setSyncMode(m_pMasterSyncable, SYNC_MASTER_EXPLICIT);
             } else if (m_pMasterSyncable->getSyncMode() != SYNC_MASTER_SOFT) {
-                m_pMasterSyncable->setSyncMode(SYNC_MASTER_SOFT);
+                setSyncMode(m_pMasterSyncable, SYNC_MASTER_SOFT);
             } else {
                 DEBUG_ASSERT(!"Logic Error: m_pMasterSyncable is a syncable that does not think it is master.");
             }
@@ -363,15 +363,15 @@ void EngineSync::activateMaster(Syncable* pSyncable, bool explicitMaster) {
 
     m_pMasterSyncable = nullptr;
     if (pOldChannelMaster) {
-        pOldChannelMaster->setSyncMode(SYNC_FOLLOWER);
+        setSyncMode(pOldChannelMaster, SYNC_FOLLOWER);
     }
 
     //qDebug() << "Setting up master " << pSyncable->getGroup();
     m_pMasterSyncable = pSyncable;
     if (explicitMaster) {
-        pSyncable->setSyncMode(SYNC_MASTER_EXPLICIT);
+        setSyncMode(pSyncable, SYNC_MASTER_EXPLICIT);
     } else {
-        pSyncable->setSyncMode(SYNC_MASTER_SOFT);
+        setSyncMode(pSyncable, SYNC_MASTER_SOFT);
     }
     pSyncable->setMasterParams(masterBeatDistance(), masterBaseBpm(), masterBpm());
     pSyncable->setInstantaneousBpm(masterBpm());
@@ -394,14 +394,14 @@ void EngineSync::deactivateSync(Syncable* pSyncable) {
     }
 
     // Notifications happen after-the-fact.
-    pSyncable->setSyncMode(SYNC_NONE);
+    setSyncMode(pSyncable, SYNC_NONE);
 
     bool bSyncDeckExists = syncDeckExists();
 
     if (pSyncable != m_pInternalClock && !bSyncDeckExists) {
         // Deactivate the internal clock if there are no more sync decks left.
         m_pMasterSyncable = nullptr;
-        m_pInternalClock->setSyncMode(SYNC_NONE);
+        setSyncMode(m_pInternalClock, SYNC_NONE);
     }
 
     Syncable* newMaster = pickMaster(nullptr);
@@ -346,7 +346,7 @@ void SyncControl::trackBeatsUpdated(mixxx::BeatsPointer pBeats) {
         return;
     }
 
-    m_pBeats = pBeats;
+    m_pBeats.setValue(pBeats);
     m_masterBpmAdjustFactor = kBpmUnity;
 
     SyncMode syncMode = getSyncMode();
@@ -496,7 +496,7 @@ void SyncControl::notifySeek(double dNewPlaypos) {
 }
 
 double SyncControl::fileBpm() const {
-    mixxx::BeatsPointer pBeats = m_pBeats;
+    const mixxx::BeatsPointer pBeats = m_pBeats.getValue();
     if (pBeats) {
         return pBeats->getBpm();
     }
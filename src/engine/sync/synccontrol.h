@@ -132,5 +132,5 @@ class SyncControl : public EngineControl, public Syncable {
     ControlProxy* m_pQuantize;
 
     // m_pBeats is written from an engine worker thread
-    mixxx::BeatsPointer m_pBeats;
+    ControlValueAtomic<mixxx::BeatsPointer> m_pBeats;
 };
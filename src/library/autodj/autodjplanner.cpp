@@ -0,0 +1,280 @@
+#include "library/autodj/autodjplanner.h"
+
+#include <QFile>
+#include <QThread>
+#include <QtConcurrentRun>
+
+#include "engine/engine.h"
+#include "moc_autodjplanner.cpp"
+#include "track/cue.h"
+#include "track/track.h"
+#include "util/logger.h"
+#include "util/math.h"
+
+namespace {
+
+const mixxx::Logger kLogger("AutoDJPlanner");
+
+constexpr qint64 kReadAheadChunkBytes = 1024 * 1024;
+
+// The positions of a track in seconds that are relevant for the
+// transitions. Missing cues are substituted like in AutoDJProcessor.
+AutoDJProcessor::TrackSeconds trackSeconds(const Track& track) {
+    AutoDJProcessor::TrackSeconds seconds;
+    seconds.end = track.getDuration();
+    const int sampleRate = track.getSampleRate();
+    if (sampleRate <= 0 || seconds.end <= 0) {
+        seconds.end = 0.0;
+        return seconds;
+    }
+    const auto toSeconds = [sampleRate](double samplePosition) {
+        return samplePosition / mixxx::kEngineChannelCount / sampleRate;
+    };
+
+    seconds.lastSound = seconds.end;
+    CuePointer pAudibleSound = track.findCueByType(mixxx::CueType::AudibleSound);
+    if (pAudibleSound) {
+        const Cue::StartAndEndPositions pos = pAudibleSound->getStartAndEndPosition();
+        if (pos.startPosition > 0.0) {
+            seconds.firstSound = toSeconds(pos.startPosition);
+        }
+        if (pos.endPosition > 0 && (pos.endPosition - pos.startPosition) > 0) {
+            seconds.lastSound = toSeconds(pos.endPosition);
+        }
+    }
+
+    seconds.introStart = seconds.firstSound;
+    seconds.introEnd = seconds.firstSound;
+    CuePointer pIntro = track.findCueByType(mixxx::CueType::Intro);
+    if (pIntro) {
+        const Cue::StartAndEndPositions pos = pIntro->getStartAndEndPosition();
+        if (pos.startPosition != Cue::kNoPosition) {
+            seconds.introStart = toSeconds(pos.startPosition);
+        }
+        seconds.introEnd = pos.endPosition != Cue::kNoPosition
+                ? toSeconds(pos.endPosition)
+                : seconds.introStart;
+    }
+
+    seconds.outroEnd = seconds.lastSound;
+    seconds.outroStart = seconds.lastSound;
+    CuePointer pOutro = track.findCueByType(mixxx::CueType::Outro);
+    if (pOutro) {
+        const Cue::StartAndEndPositions pos = pOutro->getStartAndEndPosition();
+        if (pos.endPosition != Cue::kNoPosition) {
+            seconds.outroEnd = math_min(toSeconds(pos.endPosition), seconds.end);
+        }
+        seconds.outroStart = pos.startPosition != Cue::kNoPosition
+                ? toSeconds(pos.startPosition)
+                : seconds.outroEnd;
+    }
+    return seconds;
+}
+
+// Reads the whole file to move it into the cache of the operating
+// system. Opening a file also reads its metadata and some decoders scan
+// the whole file for seeking, e.g. MP3.
+bool readAhead(const QString& location, const std::atomic<bool>& abort) {
+    QFile file(location);
+    if (!file.open(QIODevice::ReadOnly)) {
+        kLogger.warning() << "Failed to read ahead" << location;
+        return false;
+    }
+    QByteArray buffer(kReadAheadChunkBytes, Qt::Uninitialized);
+    while (!abort.load()) {
+        const qint64 bytesRead = file.read(buffer.data(), buffer.size());
+        if (bytesRead <= 0) {
+            return bytesRead == 0;
+        }
+    }
+    return false;
+}
+
+// Returns the locations of the files that have been read completely
+QStringList readAheadFiles(
+        const QStringList& locations,
+        const std::atomic<bool>* pAbort) {
+    // The thread pool of the planner only reads ahead, so the priority is
+    // never restored. The pool might have replaced an expired thread since
+    // the last time, so it is set for every task.
+    QThread::currentThread()->setPriority(QThread::LowPriority);
+    QStringList readLocations;
+    // The files are read ahead in the order they are loaded into the
+    // decks and only as long as the plan is current.
+    for (const auto& location : locations) {
+        if (pAbort->load()) {
+            break;
+        }
+        if (readAhead(location, *pAbort)) {
+            readLocations.append(location);
+        }
+    }
+    return readLocations;
+}
+
+} // anonymous namespace
+
+AutoDJPlanner::AutoDJPlanner(QObject* pParent, int lookAheadTracks)
+        : QObject(pParent),
+          m_lookAheadTracks(lookAheadTracks),
+          m_abort(false) {
+    // Files are read ahead one after another and must not block the
+    // threads of the global pool, e.g. for analysis or library scans.
+    m_readAheadThreadPool.setMaxThreadCount(1);
+    connect(&m_futureWatcher,
+            &QFutureWatcher<QStringList>::finished,
+            this,
+            &AutoDJPlanner::slotReadAheadFinished);
+}
+
+AutoDJPlanner::~AutoDJPlanner() {
+    m_abort = true;
+    m_future.waitForFinished();
+}
+
+void AutoDJPlanner::planTransitions(
+        const QList<TrackPointer>& tracks,
+        AutoDJProcessor::TransitionMode transitionMode,
+        double transitionTime) {
+    auto timeline = planTimeline(
+            tracks.mid(0, m_lookAheadTracks), transitionMode, transitionTime);
+    QStringList locations;
+    for (auto& plannedTrack : timeline) {
+        // Files that have been read ahead for the previous plan
+        // are still cached
+        for (const auto& previousTrack : qAsConst(m_timeline)) {
+            if (previousTrack.pTrack == plannedTrack.pTrack) {
+                plannedTrack.readAhead = previousTrack.readAhead;
+                break;
+            }
+        }
+        if (!plannedTrack.readAhead) {
+            locations.append(plannedTrack.pTrack->getLocation());
+        }
+    }
+    m_timeline = std::move(timeline);
+    if (kLogger.debugEnabled()) {
+        for (const auto& plannedTrack : qAsConst(m_timeline)) {
+            kLogger.debug()
+                    << "Planned" << plannedTrack.pTrack->getLocation()
+                    << "at" << plannedTrack.timelineSecond
+                    << "start" << plannedTrack.startSecond
+                    << "fade" << plannedTrack.fadeBeginSecond
+                    << plannedTrack.fadeEndSecond;
+        }
+    }
+    emit timelineChanged();
+
+    if (m_future.isRunning()) {
+        m_abort = true;
+        m_pendingLocations = std::move(locations);
+        return;
+    }
+    startReadAhead(locations);
+}
+
+void AutoDJPlanner::clear() {
+    m_abort = true;
+    m_pendingLocations.reset();
+    if (m_timeline.isEmpty()) {
+        return;
+    }
+    m_timeline.clear();
+    emit timelineChanged();
+}
+
+void AutoDJPlanner::startReadAhead(const QStringList& locations) {
+    DEBUG_ASSERT(!m_future.isRunning());
+    if (locations.isEmpty()) {
+        return;
+    }
+    m_abort = false;
+    m_future = QtConcurrent::run(
+            &m_readAheadThreadPool,
+            readAheadFiles,
+            locations,
+            &m_abort);
+    m_futureWatcher.setFuture(m_future);
+}
+
+void AutoDJPlanner::slotReadAheadFinished() {
+    if (m_pendingLocations) {
+        // The files of the outdated plan are not needed anymore
+        const QStringList locations = std::move(*m_pendingLocations);
+        m_pendingLocations.reset();
+        startReadAhead(locations);
+        return;
+    }
+    if (m_abort) {
+        // Cleared while reading ahead
+        return;
+    }
+    const QStringList readLocations = m_future.result();
+    bool changed = false;
+    for (auto& plannedTrack : m_timeline) {
+        if (!plannedTrack.readAhead &&
+                readLocations.contains(plannedTrack.pTrack->getLocation())) {
+            kLogger.debug()
+                    << "Read ahead" << plannedTrack.pTrack->getLocation();
+            plannedTrack.readAhead = true;
+            changed = true;
+        }
+    }
+    if (changed) {
+        emit timelineChanged();
+    }
+}
+
+// static
+QList<AutoDJPlannedTrack> AutoDJPlanner::planTimeline(
+        const QList<TrackPointer>& tracks,
+        AutoDJProcessor::TransitionMode transitionMode,
+        double transitionTime) {
+    QList<AutoDJPlannedTrack> timeline;
+    QList<AutoDJProcessor::TrackSeconds> timelineSeconds;
+    for (const auto& pTrack : tracks) {
+        if (!pTrack) {
+            continue;
+        }
+        const AutoDJProcessor::TrackSeconds seconds = trackSeconds(*pTrack);
+        if (seconds.end <= 0) {
+            // Skipped when loaded into a deck
+            continue;
+        }
+        AutoDJPlannedTrack plannedTrack;
+        plannedTrack.pTrack = pTrack;
+        plannedTrack.bpm = pTrack->getBpm();
+        plannedTrack.key = pTrack->getKey();
+        plannedTrack.replayGain = pTrack->getReplayGain();
+        // The tracks are planned to be cued to their start point when
+        // they are loaded
+        const AutoDJProcessor::FadeSeconds fade =
+                AutoDJProcessor::calculateFadeSeconds(
+                        seconds, 0.0, true, transitionMode);
+        if (timeline.isEmpty()) {
+            plannedTrack.startSecond = fade.start;
+        } else {
+            AutoDJPlannedTrack& from = timeline.last();
+            const AutoDJProcessor::TransitionSeconds transition =
+                    AutoDJProcessor::calculateTransitionSeconds(
+                            timelineSeconds.last(),
+                            from.startSecond,
+                            seconds,
+                            0.0,
+                            true,
+                            transitionMode,
+                            transitionTime);
+            from.fadeBeginSecond = transition.fadeBegin;
+            from.fadeEndSecond = transition.fadeEnd;
+            plannedTrack.startSecond = transition.to.start;
+            plannedTrack.timelineSecond = from.timelineSecond +
+                    math_max(from.fadeBeginSecond - from.startSecond, 0.0);
+        }
+        // Until the next track is known
+        plannedTrack.fadeBeginSecond = fade.fadeBegin;
+        plannedTrack.fadeEndSecond = fade.fadeEnd;
+        timeline.append(std::move(plannedTrack));
+        timelineSeconds.append(seconds);
+    }
+    return timeline;
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <QFuture>
+#include <QFutureWatcher>
+#include <QList>
+#include <QObject>
+#include <QStringList>
+#include <QThreadPool>
+#include <atomic>
+#include <optional>
+
+#include "library/autodj/autodjprocessor.h"
+#include "proto/keys.pb.h"
+#include "track/replaygain.h"
+#include "track/track_decl.h"
+
+/// A track of the Auto DJ queue with its planned transition to the next
+/// queued track. All positions are in seconds at the original tempo of
+/// the track.
+struct AutoDJPlannedTrack {
+    TrackPointer pTrack;
+    // Playback starts at this position when fading in the track
+    double startSecond = 0.0;
+    // Fading out to the next track starts and ends at these positions.
+    // The last planned track is faded out at its outro.
+    double fadeBeginSecond = 0.0;
+    double fadeEndSecond = 0.0;
+    // The time between fading in the first planned track and fading in
+    // this track
+    double timelineSecond = 0.0;
+    double bpm = 0.0;
+    mixxx::track::io::key::ChromaticKey key =
+            mixxx::track::io::key::INVALID;
+    mixxx::ReplayGain replayGain;
+    // The file has been read ahead into the cache of the operating system
+    bool readAhead = false;
+};
+
+/// Plans the transitions between the next tracks of the Auto DJ queue
+/// from their stored cues and analysis results and reads the files ahead
+/// on a dedicated worker thread before they are loaded into a deck.
+/// Reading ahead moves the files into the cache of the operating system
+/// such that opening and seeking them in the CachingReader of the deck
+/// doesn't wait for slow storage when a transition is due.
+///
+/// The planned timeline is informative only. AutoDJProcessor still
+/// calculates the actual transition from the loaded decks, because it
+/// depends on the current play position and tempo.
+class AutoDJPlanner : public QObject {
+    Q_OBJECT
+  public:
+    static constexpr int kDefaultLookAheadTracks = 3;
+
+    AutoDJPlanner(QObject* pParent, int lookAheadTracks);
+    ~AutoDJPlanner() override;
+
+    int getLookAheadTracks() const {
+        return m_lookAheadTracks;
+    }
+
+    const QList<AutoDJPlannedTrack>& getTimeline() const {
+        return m_timeline;
+    }
+
+    /// Plans the transitions between the given tracks and starts to read
+    /// their files ahead in the background. The timeline is updated
+    /// immediately and again when the files have been read ahead.
+    /// Reading ahead for the previous plan is aborted.
+    void planTransitions(
+            const QList<TrackPointer>& tracks,
+            AutoDJProcessor::TransitionMode transitionMode,
+            double transitionTime);
+
+    /// Aborts reading ahead and discards the current timeline.
+    void clear();
+
+    /// Calculates the transitions between consecutive tracks. Tracks
+    /// without a duration are skipped like AutoDJProcessor does.
+    static QList<AutoDJPlannedTrack> planTimeline(
+            const QList<TrackPointer>& tracks,
+            AutoDJProcessor::TransitionMode transitionMode,
+            double transitionTime);
+
+  signals:
+    void timelineChanged();
+
+  private slots:
+    void slotReadAheadFinished();
+
+  private:
+    void startReadAhead(const QStringList& locations);
+
+    const int m_lookAheadTracks;
+
+    QThreadPool m_readAheadThreadPool;
+    QFutureWatcher<QStringList> m_futureWatcher;
+    QFuture<QStringList> m_future;
+    // Stops reading ahead when the plan is outdated
+    std::atomic<bool> m_abort;
+    // Read ahead after reading ahead for the outdated plan has been aborted
+    std::optional<QStringList> m_pendingLocations;
+
+    QList<AutoDJPlannedTrack> m_timeline;
+};
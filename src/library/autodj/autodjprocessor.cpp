@@ -2,7 +2,9 @@
 
 #include "control/controlproxy.h"
 #include "control/controlpushbutton.h"
+#include "engine/cachingreader/cachingreaderpreloader.h"
 #include "engine/engine.h"
+#include "library/autodj/autodjplanner.h"
 #include "library/trackcollection.h"
 #include "mixer/basetrackplayer.h"
 #include "mixer/playermanager.h"
@@ -14,6 +16,7 @@
 namespace {
 const char* kTransitionPreferenceName = "Transition";
 const char* kTransitionModePreferenceName = "TransitionMode";
+const char* kLookAheadTracksPreferenceName = "LookAheadTracks";
 const double kTransitionPreferenceDefault = 10.0;
 const double kKeepPosition = -1.0;
 
@@ -118,6 +121,7 @@ AutoDJProcessor::AutoDJProcessor(
           m_pConfig(pConfig),
           m_pPlayerManager(pPlayerManager),
           m_pAutoDJTableModel(nullptr),
+          m_pPlanner(nullptr),
           m_eState(ADJ_DISABLED),
           m_transitionProgress(0.0),
           m_transitionTime(kTransitionPreferenceDefault) {
@@ -125,6 +129,23 @@ AutoDJProcessor::AutoDJProcessor(
                                                  "mixxx.db.model.autodj");
     m_pAutoDJTableModel->setTableModel(iAutoDJPlaylistId);
     m_pAutoDJTableModel->select();
+    connect(m_pAutoDJTableModel,
+            &PlaylistTableModel::rowsInserted,
+            this,
+            &AutoDJProcessor::queueChanged);
+    connect(m_pAutoDJTableModel,
+            &PlaylistTableModel::rowsRemoved,
+            this,
+            &AutoDJProcessor::queueChanged);
+
+    m_pPlanner = new AutoDJPlanner(this,
+            m_pConfig->getValue(
+                    ConfigKey(kConfigKey, kLookAheadTracksPreferenceName),
+                    AutoDJPlanner::kDefaultLookAheadTracks));
+    connect(m_pPlanner,
+            &AutoDJPlanner::timelineChanged,
+            this,
+            &AutoDJProcessor::preloadNextTrack);
 
     m_pShufflePlaylist = new ControlPushButton(
             ConfigKey("[AutoDJ]", "shuffle_playlist"));
@@ -198,6 +219,7 @@ AutoDJProcessor::~AutoDJProcessor() {
     delete m_pEnabledAutoDJ;
     delete m_pFadeNow;
 
+    delete m_pPlanner;
     delete m_pAutoDJTableModel;
 }
 
@@ -548,6 +570,7 @@ AutoDJProcessor::AutoDJError AutoDJProcessor::toggleAutoDJ(bool enable) {
                 setCrossfader(1.0);
             }
         }
+        planTransitions();
         emitAutoDJStateChanged(m_eState);
     } else {  // Disable Auto DJ
         if (m_pEnabledAutoDJ->get() != 0.0) {
@@ -562,6 +585,11 @@ AutoDJProcessor::AutoDJError AutoDJProcessor::toggleAutoDJ(bool enable) {
         deck1->disconnect(this);
         deck2->disconnect(this);
         m_pCOCrossfader->set(0);
+        m_pPlanner->clear();
+        CachingReaderPreloader* pPreloader = m_pPlayerManager->getCachingReaderPreloader();
+        if (pPreloader) {
+            pPreloader->clear();
+        }
         emitAutoDJStateChanged(m_eState);
     }
     return ADJ_OK;
@@ -934,6 +962,51 @@ bool AutoDJProcessor::removeTrackFromTopOfQueue(TrackPointer pTrack) {
     return true;
 }
 
+void AutoDJProcessor::queueChanged() {
+    planTransitions();
+}
+
+void AutoDJProcessor::preloadNextTrack() {
+    CachingReaderPreloader* pPreloader = m_pPlayerManager->getCachingReaderPreloader();
+    if (!pPreloader) {
+        return;
+    }
+    // The first planned track that is neither loaded nor being loaded
+    // will be loaded into the next deck that becomes available
+    for (const auto& plannedTrack : m_pPlanner->getTimeline()) {
+        bool loaded = false;
+        for (const auto* pDeck : qAsConst(m_decks)) {
+            if (pDeck->getLoadedTrack() == plannedTrack.pTrack ||
+                    pDeck->newTrack == plannedTrack.pTrack) {
+                loaded = true;
+                break;
+            }
+        }
+        if (!loaded) {
+            pPreloader->preload(plannedTrack.pTrack);
+            return;
+        }
+    }
+}
+
+void AutoDJProcessor::planTransitions() {
+    if (m_eState == ADJ_DISABLED) {
+        return;
+    }
+    QList<TrackPointer> tracks;
+    const int rowCount = math_min(
+            m_pAutoDJTableModel->rowCount(),
+            m_pPlanner->getLookAheadTracks());
+    for (int row = 0; row < rowCount; ++row) {
+        TrackPointer pTrack = m_pAutoDJTableModel->getTrack(
+                m_pAutoDJTableModel->index(row, 0));
+        if (pTrack) {
+            tracks.append(pTrack);
+        }
+    }
+    m_pPlanner->planTransitions(tracks, m_transitionMode, m_transitionTime);
+}
+
 void AutoDJProcessor::maybeFillRandomTracks() {
     int minAutoDJCrateTracks = m_pConfig->getValueString(
             ConfigKey(kConfigKey, "RandomQueueMinimumAllowed")).toInt();
@@ -1189,47 +1262,123 @@ void AutoDJProcessor::calculateTransition(DeckAttributes* pFromDeck,
         return;
     }
 
+    const double fromDeckPosition = fromDeckDuration * pFromDeck->playPosition();
+    const double toDeckPositionSeconds = toDeckDuration * pToDeck->playPosition();
+    const TransitionSeconds transition = calculateTransitionSeconds(
+            getTrackSeconds(pFromDeck),
+            fromDeckPosition,
+            getTrackSeconds(pToDeck),
+            toDeckPositionSeconds,
+            seekToStartPoint,
+            m_transitionMode,
+            m_transitionTime);
+
+    // These are expected to be a fraction of the track length.
+    pFromDeck->fadeBeginPos = transition.fadeBegin / fromDeckDuration;
+    pFromDeck->fadeEndPos = transition.fadeEnd / fromDeckDuration;
+    pToDeck->startPos = transition.to.start / toDeckDuration;
+    pToDeck->fadeBeginPos = transition.to.fadeBegin / toDeckDuration;
+    pToDeck->fadeEndPos = transition.to.fadeEnd / toDeckDuration;
+
+    pFromDeck->isFromDeck = true;
+    pToDeck->isFromDeck = false;
+
+    VERIFY_OR_DEBUG_ASSERT(pFromDeck->fadeBeginPos <= 1) {
+        pFromDeck->fadeBeginPos = 1;
+    }
+
+    if (sDebug) {
+        qDebug() << this << "calculateTransition" << pFromDeck->group
+                 << pFromDeck->fadeBeginPos << pFromDeck->fadeEndPos
+                 << pToDeck->startPos;
+    }
+}
+
+AutoDJProcessor::TrackSeconds AutoDJProcessor::getTrackSeconds(DeckAttributes* pDeck) {
+    TrackSeconds seconds;
+    seconds.firstSound = getFirstSoundSecond(pDeck);
+    seconds.lastSound = getLastSoundSecond(pDeck);
+    seconds.introStart = getIntroStartSecond(pDeck);
+    seconds.introEnd = getIntroEndSecond(pDeck);
+    seconds.outroStart = getOutroStartSecond(pDeck);
+    seconds.outroEnd = getOutroEndSecond(pDeck);
+    seconds.end = getEndSecond(pDeck);
+    return seconds;
+}
+
+// static
+AutoDJProcessor::FadeSeconds AutoDJProcessor::calculateFadeSeconds(
+        const TrackSeconds& track,
+        double position,
+        bool seekToStartPoint,
+        TransitionMode transitionMode) {
+    // The fade begin is a possible fade begin for the transition after
+    // next. It is used to check if it will be possible or a re-cue is
+    // required.
+    FadeSeconds fade;
+    fade.fadeEnd = track.outroEnd;
+    double startPoint;
+    switch (transitionMode) {
+    case TransitionMode::FullIntroOutro:
+    case TransitionMode::FadeAtOutroStart:
+        fade.fadeBegin = track.outroStart;
+        startPoint = track.introStart;
+        break;
+    case TransitionMode::FixedSkipSilence:
+        fade.fadeBegin = track.lastSound;
+        startPoint = track.firstSound;
+        break;
+    case TransitionMode::FixedFullTrack:
+    default:
+        fade.fadeBegin = track.end;
+        startPoint = 0.0;
+    }
+    if (seekToStartPoint || position >= fade.fadeBegin) {
+        // position >= fade.fadeBegin happens when the user has seeked or
+        // played the track behind fadeBegin of the fade after the next.
+        // In this case we recue the track just before the transition.
+        fade.start = startPoint;
+    } else {
+        fade.start = position;
+    }
+    return fade;
+}
+
+// static
+AutoDJProcessor::TransitionSeconds AutoDJProcessor::calculateTransitionSeconds(
+        const TrackSeconds& from,
+        double fromPosition,
+        const TrackSeconds& to,
+        double toPosition,
+        bool seekToStartPoint,
+        TransitionMode transitionMode,
+        double transitionTime) {
     // Within this function, the outro refers to the outro of the currently
     // playing track and the intro refers to the intro of the next track.
 
-    double outroEnd = getOutroEndSecond(pFromDeck);
-    double outroStart = getOutroStartSecond(pFromDeck);
-    const double fromDeckPosition = fromDeckDuration * pFromDeck->playPosition();
+    double outroEnd = from.outroEnd;
+    double outroStart = from.outroStart;
 
-    VERIFY_OR_DEBUG_ASSERT(outroEnd <= fromDeckEndPosition) {
-        outroEnd = fromDeckEndPosition;
+    VERIFY_OR_DEBUG_ASSERT(outroEnd <= from.end) {
+        outroEnd = from.end;
     }
 
-    if (fromDeckPosition > outroStart) {
+    if (fromPosition > outroStart) {
         // We have already passed outroStart
         // This can happen if we have just enabled auto DJ
-        outroStart = fromDeckPosition;
-        if (fromDeckPosition > outroEnd) {
-            outroEnd = math_min(outroStart + fabs(m_transitionTime), fromDeckEndPosition);
+        outroStart = fromPosition;
+        if (fromPosition > outroEnd) {
+            outroEnd = math_min(outroStart + fabs(transitionTime), from.end);
         }
     }
     double outroLength = outroEnd - outroStart;
 
-    double toDeckPositionSeconds = toDeckDuration * pToDeck->playPosition();
-    // Store here a possible fadeBeginPos for the transition after next
-    // This is used to check if it will be possible or a re-cue is required.
-    // here it is done for FullIntroOutro and FadeAtOutroStart.
-    // It is adjusted below for the other modes.
-    pToDeck->fadeBeginPos = getOutroStartSecond(pToDeck);
-    pToDeck->fadeEndPos = getOutroEndSecond(pToDeck);
-
-    double introStart;
-    if (seekToStartPoint || toDeckPositionSeconds >= pToDeck->fadeBeginPos) {
-        // toDeckPosition >= pToDeck->fadeBeginPos happens when the
-        // user has seeked or played the to track behind fadeBeginPos of
-        // the fade after the next.
-        // In this case we recue the track just before the transition.
-        introStart = getIntroStartSecond(pToDeck);
-    } else {
-        introStart = toDeckPositionSeconds;
-    }
+    TransitionSeconds transition;
+    transition.to = calculateFadeSeconds(
+            to, toPosition, seekToStartPoint, transitionMode);
+    const double introStart = transition.to.start;
 
-    double introEnd = getIntroEndSecond(pToDeck);
+    double introEnd = to.introEnd;
     if (introEnd < introStart) {
         // introEnd is invalid. Assume a zero length intro.
         // The introStart is automatically placed by AnalyzerSilence, so use
@@ -1239,7 +1388,7 @@ void AutoDJProcessor::calculateTransition(DeckAttributes* pFromDeck,
 
     double introLength = introEnd - introStart;
 
-    switch (m_transitionMode) {
+    switch (transitionMode) {
     case TransitionMode::FullIntroOutro: {
         // Use the outro or intro length for the transition time, whichever is
         // shorter. Let the full outro and intro play; do not cut off any part
@@ -1272,19 +1421,18 @@ void AutoDJProcessor::calculateTransition(DeckAttributes* pFromDeck,
         }
         if (transitionLength > 0) {
             const double transitionEnd = introStart + transitionLength;
-            if (transitionEnd > pToDeck->fadeBeginPos) {
+            if (transitionEnd > transition.to.fadeBegin) {
                 // End intro before next outro starts
-                transitionLength = pToDeck->fadeBeginPos - introStart;
+                transitionLength = transition.to.fadeBegin - introStart;
                 VERIFY_OR_DEBUG_ASSERT(transitionLength > 0) {
                     // We seek to intro start above in this case so this never happens
                     transitionLength = 1;
                 }
             }
-            pFromDeck->fadeBeginPos = outroEnd - transitionLength;
-            pFromDeck->fadeEndPos = outroEnd;
-            pToDeck->startPos = introStart;
+            transition.fadeBegin = outroEnd - transitionLength;
+            transition.fadeEnd = outroEnd;
         } else {
-            useFixedFadeTime(pFromDeck, pToDeck, fromDeckPosition, outroEnd, introStart);
+            useFixedFadeTime(&transition, to, fromPosition, outroEnd, transitionTime);
         }
     } break;
     case TransitionMode::FadeAtOutroStart: {
@@ -1318,118 +1466,74 @@ void AutoDJProcessor::calculateTransition(DeckAttributes* pFromDeck,
                 }
             }
             const double transitionEnd = introStart + transitionLength;
-            if (transitionEnd > pToDeck->fadeBeginPos) {
+            if (transitionEnd > transition.to.fadeBegin) {
                 // End intro before next outro starts
-                transitionLength = pToDeck->fadeBeginPos - introStart;
+                transitionLength = transition.to.fadeBegin - introStart;
                 VERIFY_OR_DEBUG_ASSERT(transitionLength > 0) {
                     // We seek to intro start above in this case so this never happens
                     transitionLength = 1;
                 }
             }
-            pFromDeck->fadeBeginPos = outroStart;
-            pFromDeck->fadeEndPos = outroStart + transitionLength;
-            pToDeck->startPos = introStart;
+            transition.fadeBegin = outroStart;
+            transition.fadeEnd = outroStart + transitionLength;
         } else if (introLength > 0) {
             transitionLength = introLength;
-            pFromDeck->fadeBeginPos = outroEnd - transitionLength;
-            pFromDeck->fadeEndPos = outroEnd;
-            pToDeck->startPos = introStart;
-        } else {
-            useFixedFadeTime(pFromDeck, pToDeck, fromDeckPosition, outroEnd, introStart);
-        }
-    } break;
-    case TransitionMode::FixedSkipSilence: {
-        double startPoint;
-        pToDeck->fadeBeginPos = getLastSoundSecond(pToDeck);
-        if (seekToStartPoint || toDeckPositionSeconds >= pToDeck->fadeBeginPos) {
-            // toDeckPosition >= pToDeck->fadeBeginPos happens when the
-            // user has seeked or played the to track behind fadeBeginPos of
-            // the fade after the next.
-            // In this case we recue the track just before the transition.
-            startPoint = getFirstSoundSecond(pToDeck);
+            transition.fadeBegin = outroEnd - transitionLength;
+            transition.fadeEnd = outroEnd;
         } else {
-            startPoint = toDeckPositionSeconds;
+            useFixedFadeTime(&transition, to, fromPosition, outroEnd, transitionTime);
         }
-        useFixedFadeTime(pFromDeck, pToDeck, fromDeckPosition, getLastSoundSecond(pFromDeck), startPoint);
     } break;
+    case TransitionMode::FixedSkipSilence:
+        useFixedFadeTime(&transition, to, fromPosition, from.lastSound, transitionTime);
+        break;
     case TransitionMode::FixedFullTrack:
-    default: {
-        double startPoint;
-        pToDeck->fadeBeginPos = toDeckEndPosition;
-        if (seekToStartPoint || toDeckPositionSeconds >= pToDeck->fadeBeginPos) {
-            // toDeckPosition >= pToDeck->fadeBeginPos happens when the
-            // user has seeked or played the to track behind fadeBeginPos of
-            // the fade after the next.
-            // In this case we recue the track just before the transition.
-            startPoint = 0.0;
-        } else {
-            startPoint = toDeckPositionSeconds;
-        }
-        useFixedFadeTime(pFromDeck, pToDeck, fromDeckPosition, fromDeckEndPosition, startPoint);
-        }
-    }
-
-    // These are expected to be a fraction of the track length.
-    pFromDeck->fadeBeginPos /= fromDeckDuration;
-    pFromDeck->fadeEndPos /= fromDeckDuration;
-    pToDeck->startPos /= toDeckDuration;
-    pToDeck->fadeBeginPos /= toDeckDuration;
-    pToDeck->fadeEndPos /= toDeckDuration;
-
-    pFromDeck->isFromDeck = true;
-    pToDeck->isFromDeck = false;
-
-    VERIFY_OR_DEBUG_ASSERT(pFromDeck->fadeBeginPos <= 1) {
-        pFromDeck->fadeBeginPos = 1;
-    }
-
-    if (sDebug) {
-        qDebug() << this << "calculateTransition" << pFromDeck->group
-                 << pFromDeck->fadeBeginPos << pFromDeck->fadeEndPos
-                 << pToDeck->startPos;
+    default:
+        useFixedFadeTime(&transition, to, fromPosition, from.end, transitionTime);
     }
+    return transition;
 }
 
+// static
 void AutoDJProcessor::useFixedFadeTime(
-        DeckAttributes* pFromDeck,
-        DeckAttributes* pToDeck,
-        double fromDeckSecond,
+        TransitionSeconds* pTransition,
+        const TrackSeconds& to,
+        double fromSecond,
         double fadeEndSecond,
-        double toDeckStartSecond) {
-    if (m_transitionTime > 0.0) {
+        double transitionTime) {
+    FadeSeconds* pTo = &pTransition->to;
+    if (transitionTime > 0.0) {
         // Guard against the next track being too short. This transition must finish
         // before the next transition starts.
-        double toDeckOutroStart = pToDeck->fadeBeginPos;
-        if (pToDeck->fadeBeginPos >= pToDeck->fadeEndPos) {
-            // no outro defined, the toDeck will also use the transition time
-            toDeckOutroStart -= m_transitionTime;
+        double toOutroStart = pTo->fadeBegin;
+        if (pTo->fadeBegin >= pTo->fadeEnd) {
+            // no outro defined, the next track will also use the transition time
+            toOutroStart -= transitionTime;
         }
-        if (toDeckOutroStart <= toDeckStartSecond) {
+        if (toOutroStart <= pTo->start) {
             // we are already too late
             // Check OutroEnd as alternative, which is for all transition mode
             // better than directly default to duration()
-            double end = getOutroEndSecond(pToDeck);
-            if (end <= toDeckStartSecond) {
-                end = getEndSecond(pToDeck);
-                VERIFY_OR_DEBUG_ASSERT(end > toDeckStartSecond) {
+            double end = to.outroEnd;
+            if (end <= pTo->start) {
+                end = to.end;
+                VERIFY_OR_DEBUG_ASSERT(end > pTo->start) {
                     // as last resort move start point
                     // The caller makes sure that this never happens
-                    toDeckStartSecond = end - 1;
+                    pTo->start = end - 1;
                 }
             }
             // use the remaining time for fading
-            toDeckOutroStart = (end - toDeckStartSecond) / 2 + toDeckStartSecond;
+            toOutroStart = (end - pTo->start) / 2 + pTo->start;
         }
-        double transitionTime = math_min(toDeckOutroStart - toDeckStartSecond,
-                m_transitionTime);
+        const double fadeTime = math_min(toOutroStart - pTo->start, transitionTime);
 
-        pFromDeck->fadeBeginPos = math_max(fadeEndSecond - transitionTime, fromDeckSecond);
-        pFromDeck->fadeEndPos = fadeEndSecond;
-        pToDeck->startPos = toDeckStartSecond;
+        pTransition->fadeBegin = math_max(fadeEndSecond - fadeTime, fromSecond);
+        pTransition->fadeEnd = fadeEndSecond;
     } else {
-        pFromDeck->fadeBeginPos = fadeEndSecond;
-        pFromDeck->fadeEndPos = fadeEndSecond;
-        pToDeck->startPos = toDeckStartSecond + m_transitionTime;
+        pTransition->fadeBegin = fadeEndSecond;
+        pTransition->fadeEnd = fadeEndSecond;
+        pTo->start += transitionTime;
     }
 }
 
@@ -1440,6 +1544,7 @@ void AutoDJProcessor::playerTrackLoaded(DeckAttributes* pDeck, TrackPointer pTra
     }
 
     pDeck->loading = false;
+    pDeck->newTrack.reset();
 
     // Since the end position is measured in seconds from 0:00 it is also
     // the track duration.
@@ -1486,6 +1591,7 @@ void AutoDJProcessor::playerLoadingTrack(DeckAttributes* pDeck,
     }
 
     pDeck->loading = true;
+    pDeck->newTrack = pNewTrack;
 
     // The Deck is loading an new track
 
@@ -1511,6 +1617,7 @@ void AutoDJProcessor::playerEmpty(DeckAttributes* pDeck) {
     if (sDebug) {
         qDebug() << this << "playerEmpty()" << pDeck->group;
     }
+    pDeck->newTrack.reset();
 
     // The Deck has ejected a track and no new one is loaded
     // This happens if loading fails or the user manually ejected the track
@@ -1555,6 +1662,7 @@ void AutoDJProcessor::setTransitionTime(int time) {
     m_pConfig->set(ConfigKey(kConfigKey, kTransitionPreferenceName),
                    ConfigValue(time));
     m_transitionTime = time;
+    planTransitions();
 
     // Then re-calculate fade thresholds for the decks.
     if (m_eState == ADJ_IDLE) {
@@ -1573,6 +1681,7 @@ void AutoDJProcessor::setTransitionMode(TransitionMode newMode) {
     m_pConfig->set(ConfigKey(kConfigKey, kTransitionModePreferenceName),
             ConfigValue(static_cast<int>(newMode)));
     m_transitionMode = newMode;
+    planTransitions();
 
     if (m_eState != ADJ_IDLE) {
         // We don't want to recalculate a running transition
@@ -12,6 +12,7 @@
 #include "track/track_decl.h"
 #include "util/class.h"
 
+class AutoDJPlanner;
 class ControlPushButton;
 class TrackCollectionManager;
 class PlayerManagerInterface;
@@ -123,6 +124,7 @@ class DeckAttributes : public QObject {
     double fadeEndPos;   // set in fromDeck nature
     bool isFromDeck;
     bool loading; // The data is inconsistent during loading a deck
+    TrackPointer newTrack; // The track that is being loaded
 
   private:
     EngineChannel::ChannelOrientation m_orientation;
@@ -167,6 +169,56 @@ class AutoDJProcessor : public QObject {
         FixedSkipSilence
     };
 
+    // The positions of a track in seconds that determine the transitions
+    // from and to it. Missing cues are substituted like in
+    // getIntroStartSecond() and the other getters.
+    struct TrackSeconds {
+        double firstSound = 0.0;
+        double lastSound = 0.0;
+        double introStart = 0.0;
+        double introEnd = 0.0;
+        double outroStart = 0.0;
+        double outroEnd = 0.0;
+        double end = 0.0;
+    };
+
+    // Where a track starts when it is faded in and where it is faded out
+    // when the next track has no intro, in seconds
+    struct FadeSeconds {
+        double start = 0.0;
+        double fadeBegin = 0.0;
+        double fadeEnd = 0.0;
+    };
+
+    // The fade out of the playing track and the fade in of the next track
+    // in seconds
+    struct TransitionSeconds {
+        double fadeBegin = 0.0;
+        double fadeEnd = 0.0;
+        FadeSeconds to;
+    };
+
+    // Calculates where the next track starts and is faded out if it is
+    // faded in at the current position toPosition, or at its start point
+    // if seekToStartPoint is set.
+    static FadeSeconds calculateFadeSeconds(
+            const TrackSeconds& track,
+            double position,
+            bool seekToStartPoint,
+            TransitionMode transitionMode);
+
+    // Calculates the transition from the track that is playing at
+    // fromPosition to the next track. This is shared by the transitions
+    // between the decks and the planned timeline of the queue.
+    static TransitionSeconds calculateTransitionSeconds(
+            const TrackSeconds& from,
+            double fromPosition,
+            const TrackSeconds& to,
+            double toPosition,
+            bool seekToStartPoint,
+            TransitionMode transitionMode,
+            double transitionTime);
+
     AutoDJProcessor(QObject* pParent,
                     UserSettingsPointer pConfig,
                     PlayerManagerInterface* pPlayerManager,
@@ -190,6 +242,12 @@ class AutoDJProcessor : public QObject {
         return m_pAutoDJTableModel;
     }
 
+    // Provides the planned timeline of the next tracks in the queue while
+    // Auto DJ is enabled
+    const AutoDJPlanner* getPlanner() const {
+        return m_pPlanner;
+    }
+
     bool nextTrackLoaded();
 
     void setTransitionTime(int seconds);
@@ -219,6 +277,8 @@ class AutoDJProcessor : public QObject {
     void playerLoadingTrack(DeckAttributes* pDeck, TrackPointer pNewTrack, TrackPointer pOldTrack);
     void playerEmpty(DeckAttributes* pDeck);
     void playerRateChanged(DeckAttributes* pDeck);
+    void queueChanged();
+    void preloadNextTrack();
 
     void controlEnable(double value);
     void controlFadeNow(double value);
@@ -253,18 +313,19 @@ class AutoDJProcessor : public QObject {
     double getLastSoundSecond(DeckAttributes* pDeck);
     double getEndSecond(DeckAttributes* pDeck);
     double samplePositionToSeconds(double samplePosition, DeckAttributes* pDeck);
+    TrackSeconds getTrackSeconds(DeckAttributes* pDeck);
 
     TrackPointer getNextTrackFromQueue();
     bool loadNextTrackFromQueue(const DeckAttributes& pDeck, bool play = false);
     void calculateTransition(DeckAttributes* pFromDeck,
             DeckAttributes* pToDeck,
             bool seekToStartPoint);
-    void useFixedFadeTime(
-            DeckAttributes* pFromDeck,
-            DeckAttributes* pToDeck,
-            double fromDeckSecond,
+    static void useFixedFadeTime(
+            TransitionSeconds* pTransition,
+            const TrackSeconds& to,
+            double fromSecond,
             double fadeEndSecond,
-            double toDeckStartSecond);
+            double transitionTime);
     DeckAttributes* getOtherDeck(const DeckAttributes* pThisDeck);
     DeckAttributes* getFromDeck();
 
@@ -276,9 +337,13 @@ class AutoDJProcessor : public QObject {
     // present.
     bool removeTrackFromTopOfQueue(TrackPointer pTrack);
     void maybeFillRandomTracks();
+    // Plans the transitions between the next tracks in the queue in the
+    // background and reads them ahead before they are loaded.
+    void planTransitions();
     UserSettingsPointer m_pConfig;
     PlayerManagerInterface* m_pPlayerManager;
     PlaylistTableModel* m_pAutoDJTableModel;
+    AutoDJPlanner* m_pPlanner;
 
     AutoDJState m_eState;
     double m_transitionProgress;
@@ -392,6 +392,7 @@ void TrackDAO::addTracksPrepare() {
             "bpm,"
             "replaygain,"
             "replaygain_peak,"
+            "replaygain_version,"
             "wavesummaryhex,"
             "timesplayed,"
             "last_played_at,"
@@ -406,6 +407,7 @@ void TrackDAO::addTracksPrepare() {
             "beats_sub_version,"
             "beats,"
             "bpm_lock,"
+            "fingerprint,"
             "keys_version,"
             "keys_sub_version,"
             "keys,"
@@ -439,6 +441,7 @@ void TrackDAO::addTracksPrepare() {
             ":bpm,"
             ":replaygain,"
             ":replaygain_peak,"
+            ":replaygain_version,"
             ":wavesummaryhex,"
             ":timesplayed,"
             ":last_played_at,"
@@ -453,6 +456,7 @@ void TrackDAO::addTracksPrepare() {
             ":beats_sub_version,"
             ":beats,"
             ":bpm_lock,"
+            ":fingerprint,"
             ":keys_version,"
             ":keys_sub_version,"
             ":keys,"
@@ -538,8 +542,12 @@ void bindTrackLibraryValues(
     pTrackLibraryQuery->bindValue(":rating", track.getRating());
     pTrackLibraryQuery->bindValue(":cuepoint", track.getCuePoint().getPosition());
     pTrackLibraryQuery->bindValue(":bpm_lock", track.getBpmLocked() ? 1 : 0);
+    pTrackLibraryQuery->bindValue(":fingerprint",
+            track.getFingerprint().isEmpty() ? QVariant() : track.getFingerprint());
     pTrackLibraryQuery->bindValue(":replaygain", trackInfo.getReplayGain().getRatio());
     pTrackLibraryQuery->bindValue(":replaygain_peak", trackInfo.getReplayGain().getPeak());
+    pTrackLibraryQuery->bindValue(":replaygain_version",
+            track.getReplayGainVersion().isEmpty() ? QVariant() : track.getReplayGainVersion());
 
     pTrackLibraryQuery->bindValue(":channels",
             static_cast<uint>(trackMetadata.getStreamInfo().getSignalInfo().getChannelCount()));
@@ -1127,6 +1135,12 @@ bool setTrackUrl(const QSqlRecord& record, const int column,
     return false;
 }
 
+bool setTrackFingerprint(const QSqlRecord& record, const int column,
+        TrackPointer pTrack) {
+    pTrack->setFingerprint(record.value(column).toString());
+    return false;
+}
+
 bool setTrackRating(const QSqlRecord& record, const int column,
                     TrackPointer pTrack) {
     pTrack->setRating(record.value(column).toInt());
@@ -1155,6 +1169,12 @@ bool setTrackReplayGainPeak(const QSqlRecord& record, const int column,
     return false;
 }
 
+bool setTrackReplayGainVersion(const QSqlRecord& record, const int column,
+        TrackPointer pTrack) {
+    pTrack->setReplayGainVersion(record.value(column).toString());
+    return false;
+}
+
 bool setTrackTimesPlayed(const QSqlRecord& record, const int column,
                          TrackPointer pTrack) {
     PlayCounter playCounter(pTrack->getPlayCounter());
@@ -1323,9 +1343,11 @@ TrackPointer TrackDAO::getTrackById(TrackId trackId) const {
             {"color", setTrackColor},
             {"comment", setTrackComment},
             {"url", setTrackUrl},
+            {"fingerprint", setTrackFingerprint},
             {"cuepoint", setTrackCuePoint},
             {"replaygain", setTrackReplayGainRatio},
             {"replaygain_peak", setTrackReplayGainPeak},
+            {"replaygain_version", setTrackReplayGainVersion},
             {"timesplayed", setTrackTimesPlayed},
             {"last_played_at", setTrackLastPlayedAt},
             {"played", setTrackPlayed},
@@ -1587,6 +1609,7 @@ bool TrackDAO::updateTrack(Track* pTrack) const {
             "bpm=:bpm,"
             "replaygain=:replaygain,"
             "replaygain_peak=:replaygain_peak,"
+            "replaygain_version=:replaygain_version,"
             "timesplayed=:timesplayed,"
             "last_played_at=:last_played_at,"
             "played=:played,"
@@ -1600,6 +1623,7 @@ bool TrackDAO::updateTrack(Track* pTrack) const {
             "beats_sub_version=:beats_sub_version,"
             "beats=:beats,"
             "bpm_lock=:bpm_lock,"
+            "fingerprint=:fingerprint,"
             "keys_version=:keys_version,"
             "keys_sub_version=:keys_sub_version,"
             "keys=:keys,"
@@ -22,6 +22,7 @@ const QString LIBRARYTABLE_DURATION = QStringLiteral("duration");
 const QString LIBRARYTABLE_BITRATE = QStringLiteral("bitrate");
 const QString LIBRARYTABLE_BPM = QStringLiteral("bpm");
 const QString LIBRARYTABLE_REPLAYGAIN = QStringLiteral("replaygain");
+const QString LIBRARYTABLE_REPLAYGAIN_VERSION = QStringLiteral("replaygain_version");
 const QString LIBRARYTABLE_CUEPOINT = QStringLiteral("cuepoint");
 const QString LIBRARYTABLE_URL = QStringLiteral("url");
 const QString LIBRARYTABLE_SAMPLERATE = QStringLiteral("samplerate");
@@ -37,6 +38,7 @@ const QString LIBRARYTABLE_RATING = QStringLiteral("rating");
 const QString LIBRARYTABLE_KEY = QStringLiteral("key");
 const QString LIBRARYTABLE_KEY_ID = QStringLiteral("key_id");
 const QString LIBRARYTABLE_BPM_LOCK = QStringLiteral("bpm_lock");
+const QString LIBRARYTABLE_FINGERPRINT = QStringLiteral("fingerprint");
 const QString LIBRARYTABLE_PREVIEW = QStringLiteral("preview");
 const QString LIBRARYTABLE_COLOR = QStringLiteral("color");
 const QString LIBRARYTABLE_COVERART = QStringLiteral("coverart");
@@ -0,0 +1,254 @@
+#include "library/duplicates/duplicatefinder.h"
+
+#include <QHash>
+#include <QtConcurrentMap>
+#include <algorithm>
+#include <numeric>
+
+#include "util/assert.h"
+#include "util/math.h"
+
+namespace {
+
+// Only the leading bits of each sub-fingerprint are used as index keys,
+// which tolerates bit errors in the trailing bits.
+constexpr int kIndexKeyBits = 20;
+
+// Consistently sampling 1 out of 2^kIndexSamplingBits keys keeps the index
+// small. Duplicates share the same keys and thus sample the same subset.
+constexpr int kIndexSamplingBits = 2;
+
+// Keys and metadata that occur in more tracks are not discriminative,
+// e.g. digital silence or "Unknown Artist - Track 1". They are skipped
+// to avoid a quadratic number of comparisons.
+constexpr int kMaxBucketSize = 256;
+
+// The number of index keys that two tracks need to share before their
+// fingerprints are compared.
+constexpr int kMinSharedIndexKeys = 3;
+
+// The minimum number of overlapping sub-fingerprints for a comparison
+// unless one of the fingerprints is even shorter.
+constexpr int kMinOverlap = 16;
+
+typedef std::pair<quint32, int> IndexEntry;
+
+quint32 indexKey(quint32 subFingerprint) {
+    return subFingerprint >> (32 - kIndexKeyBits);
+}
+
+bool isIndexKeySampled(quint32 key) {
+    // Multiplicative hashing distributes the keys uniformly
+    return ((key * 0x9E3779B1u) >> (32 - kIndexSamplingBits)) == 0;
+}
+
+std::vector<quint32> sampledIndexKeys(const std::vector<quint32>& fingerprint) {
+    std::vector<quint32> keys;
+    for (const auto subFingerprint : fingerprint) {
+        const quint32 key = indexKey(subFingerprint);
+        if (isIndexKeySampled(key)) {
+            keys.push_back(key);
+        }
+    }
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    return keys;
+}
+
+QString normalizedMetadata(const DuplicateCandidate& candidate) {
+    const QString title = candidate.title.simplified().toCaseFolded();
+    if (title.isEmpty()) {
+        return QString();
+    }
+    return candidate.artist.simplified().toCaseFolded() + QChar('\n') + title;
+}
+
+class DisjointSets {
+  public:
+    explicit DisjointSets(int size)
+            : m_parents(size) {
+        std::iota(m_parents.begin(), m_parents.end(), 0);
+    }
+
+    int find(int element) {
+        while (m_parents[element] != element) {
+            // Path halving
+            m_parents[element] = m_parents[m_parents[element]];
+            element = m_parents[element];
+        }
+        return element;
+    }
+
+    void unite(int first, int second) {
+        first = find(first);
+        second = find(second);
+        if (first != second) {
+            // The smaller index becomes the representative
+            m_parents[math_max(first, second)] = math_min(first, second);
+        }
+    }
+
+  private:
+    std::vector<int> m_parents;
+};
+
+} // anonymous namespace
+
+DuplicateFinder::DuplicateFinder()
+        : m_options(Options()) {
+}
+
+DuplicateFinder::DuplicateFinder(Options options)
+        : m_options(options) {
+}
+
+// static
+double DuplicateFinder::fingerprintSimilarity(
+        const std::vector<quint32>& first,
+        const std::vector<quint32>& second,
+        int maxOffset) {
+    const auto firstSize = static_cast<int>(first.size());
+    const auto secondSize = static_cast<int>(second.size());
+    const int minOverlap = math_max(1, math_min3(kMinOverlap, firstSize, secondSize));
+    double bestSimilarity = 0.0;
+    for (int offset = -maxOffset; offset <= maxOffset; ++offset) {
+        const int firstBegin = math_max(0, offset);
+        const int secondBegin = math_max(0, -offset);
+        const int overlap = math_min(firstSize - firstBegin, secondSize - secondBegin);
+        if (overlap < minOverlap) {
+            continue;
+        }
+        uint bitErrors = 0;
+        for (int i = 0; i < overlap; ++i) {
+            bitErrors += qPopulationCount(
+                    first[firstBegin + i] ^ second[secondBegin + i]);
+        }
+        const double similarity = 1.0 - bitErrors / (32.0 * overlap);
+        bestSimilarity = math_max(bestSimilarity, similarity);
+    }
+    return bestSimilarity;
+}
+
+bool DuplicateFinder::isDurationMatching(
+        const DuplicateCandidate& first,
+        const DuplicateCandidate& second) const {
+    if (first.durationSeconds <= 0.0 || second.durationSeconds <= 0.0) {
+        // Unknown durations don't prevent a match
+        return true;
+    }
+    return fabs(first.durationSeconds - second.durationSeconds) <=
+            m_options.maxDurationDifferenceSeconds;
+}
+
+std::vector<std::vector<int>> DuplicateFinder::findDuplicates(
+        const std::vector<DuplicateCandidate>& candidates) const {
+    const auto candidateCount = static_cast<int>(candidates.size());
+    std::vector<int> indices(candidateCount);
+    std::iota(indices.begin(), indices.end(), 0);
+
+    // 1st step: Extract the sampled index keys of all fingerprints
+    std::vector<std::vector<quint32>> indexKeys(candidateCount);
+    QtConcurrent::blockingMap(indices, [&candidates, &indexKeys](int index) {
+        indexKeys[index] = sampledIndexKeys(candidates[index].fingerprint);
+    });
+
+    // 2nd step: Build the inverted index as a sorted list of
+    // (key, candidate) entries
+    std::size_t indexSize = 0;
+    for (const auto& keys : indexKeys) {
+        indexSize += keys.size();
+    }
+    std::vector<IndexEntry> index;
+    index.reserve(indexSize);
+    for (int i = 0; i < candidateCount; ++i) {
+        for (const auto key : indexKeys[i]) {
+            index.emplace_back(key, i);
+        }
+    }
+    std::sort(index.begin(), index.end());
+
+    // 3rd step: Compare each fingerprint with all fingerprints that share
+    // enough index keys with it. Each pair is only compared once.
+    std::vector<std::vector<int>> matches(candidateCount);
+    QtConcurrent::blockingMap(indices, [&](int i) {
+        std::vector<int> sharingCandidates;
+        for (const auto key : indexKeys[i]) {
+            const auto bucket = std::equal_range(
+                    index.begin(),
+                    index.end(),
+                    IndexEntry(key, i),
+                    [](const IndexEntry& lhs, const IndexEntry& rhs) {
+                        return lhs.first < rhs.first;
+                    });
+            if (bucket.second - bucket.first > kMaxBucketSize) {
+                continue;
+            }
+            for (auto it = bucket.first; it != bucket.second; ++it) {
+                if (it->second > i) {
+                    sharingCandidates.push_back(it->second);
+                }
+            }
+        }
+        std::sort(sharingCandidates.begin(), sharingCandidates.end());
+        for (auto it = sharingCandidates.begin(); it != sharingCandidates.end();) {
+            const int j = *it;
+            const auto next = std::upper_bound(it, sharingCandidates.end(), j);
+            if (next - it >= kMinSharedIndexKeys &&
+                    isDurationMatching(candidates[i], candidates[j]) &&
+                    fingerprintSimilarity(
+                            candidates[i].fingerprint,
+                            candidates[j].fingerprint,
+                            m_options.maxOffset) >= m_options.minSimilarity) {
+                matches[i].push_back(j);
+            }
+            it = next;
+        }
+    });
+
+    // 4th step: Match the metadata if at least one of the tracks has not
+    // been fingerprinted. Otherwise the fingerprints take precedence.
+    QHash<QString, std::vector<int>> metadataBuckets;
+    for (int i = 0; i < candidateCount; ++i) {
+        const QString metadata = normalizedMetadata(candidates[i]);
+        if (!metadata.isEmpty()) {
+            metadataBuckets[metadata].push_back(i);
+        }
+    }
+    for (const auto& bucket : qAsConst(metadataBuckets)) {
+        if (bucket.size() < 2 || bucket.size() > kMaxBucketSize) {
+            continue;
+        }
+        for (std::size_t k = 0; k < bucket.size(); ++k) {
+            const int i = bucket[k];
+            for (std::size_t l = k + 1; l < bucket.size(); ++l) {
+                const int j = bucket[l];
+                if ((candidates[i].fingerprint.empty() ||
+                            candidates[j].fingerprint.empty()) &&
+                        isDurationMatching(candidates[i], candidates[j])) {
+                    matches[i].push_back(j);
+                }
+            }
+        }
+    }
+
+    // 5th step: Merge all matching pairs into groups
+    DisjointSets sets(candidateCount);
+    for (int i = 0; i < candidateCount; ++i) {
+        for (const int j : matches[i]) {
+            sets.unite(i, j);
+        }
+    }
+    std::vector<std::vector<int>> groupByRepresentative(candidateCount);
+    for (int i = 0; i < candidateCount; ++i) {
+        groupByRepresentative[sets.find(i)].push_back(i);
+    }
+    std::vector<std::vector<int>> groups;
+    for (auto& group : groupByRepresentative) {
+        if (group.size() > 1) {
+            // Already sorted, because the indices have been inserted in
+            // ascending order
+            groups.push_back(std::move(group));
+        }
+    }
+    return groups;
+}
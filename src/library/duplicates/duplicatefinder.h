@@ -0,0 +1,65 @@
+#pragma once
+
+#include <QString>
+#include <vector>
+
+#include "track/trackid.h"
+
+/// A track that is checked for duplicates. The fingerprint contains the
+/// decoded Chromaprint sub-fingerprints and is empty if the track has not
+/// been fingerprinted yet.
+struct DuplicateCandidate {
+    TrackId trackId;
+    double durationSeconds = 0.0;
+    QString artist;
+    QString title;
+    std::vector<quint32> fingerprint;
+};
+
+/// Finds groups of duplicate tracks in a collection.
+///
+/// Fingerprinted tracks are matched through a locality-sensitive index
+/// over their sub-fingerprints. Only tracks that share enough index keys
+/// are compared bit-wise, which keeps the runtime close to linear in the
+/// number of tracks. Tracks without a fingerprint fall back to comparing
+/// their normalized artist and title. In both cases the durations must
+/// match approximately.
+class DuplicateFinder {
+  public:
+    /// About 8 sub-fingerprints are generated per second of audio. Comparing
+    /// the first ~30 seconds is sufficient to tell recordings apart and
+    /// bounds the memory needed for very large libraries.
+    static constexpr std::size_t kComparedFingerprintLength = 256;
+
+    struct Options {
+        /// The minimum ratio of equal bits at the best alignment.
+        double minSimilarity = 0.8;
+        /// The maximum alignment offset in sub-fingerprints, i.e. ~2 seconds
+        /// of leading silence or encoder delay.
+        int maxOffset = 16;
+        double maxDurationDifferenceSeconds = 5.0;
+    };
+
+    DuplicateFinder();
+    explicit DuplicateFinder(Options options);
+
+    /// Returns the groups of duplicates as indices into candidates. Each
+    /// group contains at least two tracks and is sorted in ascending order.
+    /// The work is distributed on the global thread pool.
+    std::vector<std::vector<int>> findDuplicates(
+            const std::vector<DuplicateCandidate>& candidates) const;
+
+    /// Returns the ratio of equal bits of both fingerprints at the best
+    /// alignment within +/- maxOffset or 0.0 if they don't overlap.
+    static double fingerprintSimilarity(
+            const std::vector<quint32>& first,
+            const std::vector<quint32>& second,
+            int maxOffset);
+
+  private:
+    bool isDurationMatching(
+            const DuplicateCandidate& first,
+            const DuplicateCandidate& second) const;
+
+    const Options m_options;
+};
@@ -0,0 +1,254 @@
+#include "library/duplicates/duplicatesfeature.h"
+
+#include <QSqlError>
+#include <QSqlQuery>
+#include <QtConcurrentRun>
+#include <QtDebug>
+
+#include "library/dao/trackschema.h"
+#include "library/duplicates/duplicatefinder.h"
+#include "library/duplicates/duplicatestablemodel.h"
+#include "library/library.h"
+#include "library/treeitem.h"
+#include "moc_duplicatesfeature.cpp"
+#include "musicbrainz/chromaprinter.h"
+#include "util/db/dbconnectionpooled.h"
+#include "util/db/dbconnectionpooler.h"
+#include "util/logger.h"
+#include "util/scopedthreadpriority.h"
+#include "util/timer.h"
+#include "widget/wlibrary.h"
+#include "widget/wlibrarytextbrowser.h"
+
+namespace {
+
+const mixxx::Logger kLogger("DuplicatesFeature");
+
+const QString kViewName = QStringLiteral("DUPLICATESHOME");
+
+std::vector<DuplicateCandidate> readCandidates(const QSqlDatabase& database) {
+    std::vector<DuplicateCandidate> candidates;
+    QSqlQuery query(database);
+    query.setForwardOnly(true);
+    query.prepare(
+            "SELECT " +
+            LIBRARYTABLE_ID + "," +
+            LIBRARYTABLE_ARTIST + "," +
+            LIBRARYTABLE_TITLE + "," +
+            LIBRARYTABLE_DURATION + "," +
+            LIBRARYTABLE_FINGERPRINT +
+            " FROM " LIBRARY_TABLE
+            " WHERE " +
+            LIBRARYTABLE_MIXXXDELETED + "=0");
+    if (!query.exec()) {
+        kLogger.warning()
+                << "Failed to read tracks:"
+                << query.lastError();
+        return candidates;
+    }
+    while (query.next()) {
+        DuplicateCandidate candidate;
+        candidate.trackId = TrackId(query.value(0));
+        candidate.artist = query.value(1).toString();
+        candidate.title = query.value(2).toString();
+        candidate.durationSeconds = query.value(3).toDouble();
+        candidate.fingerprint = ChromaPrinter::decodeFingerprint(query.value(4).toString());
+        if (candidate.fingerprint.size() > DuplicateFinder::kComparedFingerprintLength) {
+            candidate.fingerprint.resize(DuplicateFinder::kComparedFingerprintLength);
+            candidate.fingerprint.shrink_to_fit();
+        }
+        candidates.push_back(std::move(candidate));
+    }
+    return candidates;
+}
+
+QList<DuplicatesFeature::Group> findDuplicateGroups(
+        mixxx::DbConnectionPoolPtr dbConnectionPool) {
+    ScopedTimer t("DuplicatesFeature::findDuplicateGroups");
+    // The thread is borrowed from the global thread pool
+    const ScopedThreadPriority priority(QThread::LowPriority);
+
+    std::vector<DuplicateCandidate> candidates;
+    {
+        // The pooler limits the lifetime all thread-local connections,
+        // that should be closed immediately after reading.
+        const mixxx::DbConnectionPooler dbConnectionPooler(dbConnectionPool);
+        QSqlDatabase database = mixxx::DbConnectionPooled(dbConnectionPool);
+        VERIFY_OR_DEBUG_ASSERT(database.isOpen()) {
+            kLogger.warning()
+                    << "Failed to open database for finding duplicates"
+                    << database.lastError();
+            return {};
+        }
+        candidates = readCandidates(database);
+    }
+
+    const auto groupIndices = DuplicateFinder().findDuplicates(candidates);
+
+    QList<DuplicatesFeature::Group> groups;
+    groups.reserve(static_cast<int>(groupIndices.size()));
+    for (const auto& indices : groupIndices) {
+        DuplicatesFeature::Group group;
+        for (const int index : indices) {
+            const DuplicateCandidate& candidate = candidates[index];
+            group.trackIds.append(candidate.trackId);
+            if (group.label.isEmpty() && !candidate.title.isEmpty()) {
+                group.label = candidate.artist.isEmpty()
+                        ? candidate.title
+                        : candidate.artist + QStringLiteral(" - ") + candidate.title;
+            }
+        }
+        groups.append(std::move(group));
+    }
+    kLogger.info()
+            << "Found" << groups.size()
+            << "groups of duplicates among" << candidates.size() << "tracks";
+    return groups;
+}
+
+} // anonymous namespace
+
+DuplicatesFeature::DuplicatesFeature(
+        Library* pLibrary,
+        UserSettingsPointer pConfig)
+        : LibraryFeature(pLibrary, pConfig),
+          m_icon(":/images/library/ic_library_tracks.svg"),
+          m_title(tr("Duplicates")),
+          m_pDuplicatesTableModel(new DuplicatesTableModel(this, pLibrary->trackCollections())),
+          m_searched(false),
+          m_firstGroupId(0) {
+    m_childModel.setRootItem(TreeItem::newRoot(this));
+    connect(&m_futureWatcher,
+            &QFutureWatcher<QList<Group>>::finished,
+            this,
+            &DuplicatesFeature::onDuplicatesFound);
+}
+
+DuplicatesFeature::~DuplicatesFeature() {
+    m_future.waitForFinished();
+}
+
+QVariant DuplicatesFeature::title() {
+    return m_title;
+}
+
+QIcon DuplicatesFeature::getIcon() {
+    return m_icon;
+}
+
+TreeItemModel* DuplicatesFeature::getChildModel() {
+    return &m_childModel;
+}
+
+void DuplicatesFeature::bindLibraryWidget(WLibrary* libraryWidget,
+        KeyboardEventFilter* keyboard) {
+    Q_UNUSED(keyboard);
+    m_pRootView = new WLibraryTextBrowser(libraryWidget);
+    m_pRootView->setHtml(formatRootViewHtml());
+    m_pRootView->setOpenLinks(false);
+    connect(m_pRootView,
+            &WLibraryTextBrowser::anchorClicked,
+            this,
+            &DuplicatesFeature::htmlLinkClicked);
+    libraryWidget->registerView(kViewName, m_pRootView);
+}
+
+QString DuplicatesFeature::formatRootViewHtml() const {
+    QString html;
+    html.append(QString("<h2>%1</h2>").arg(tr("Duplicates")));
+    html.append(QString("<p>%1</p>")
+                        .arg(tr("Finds tracks in the library that contain the same "
+                                "recording by comparing their acoustic fingerprints "
+                                "and durations. Tracks without a fingerprint are "
+                                "compared by artist, title and duration.")));
+    html.append(QString("<p>%1</p>")
+                        .arg(tr("Fingerprints are computed while analyzing tracks "
+                                "if enabled in the library preferences.")));
+    if (m_future.isRunning()) {
+        html.append(QString("<p>%1</p>").arg(tr("Searching for duplicates...")));
+        return html;
+    }
+    if (m_searched) {
+        html.append(QString("<p>%1</p>")
+                            .arg(tr("%n group(s) of duplicates found.", "", m_groups.size())));
+    }
+    //Colorize links in lighter blue, instead of QT default dark blue.
+    //Links are still different from regular text, but readable on dark/light backgrounds.
+    //https://bugs.launchpad.net/mixxx/+bug/1744816
+    html.append(QString("<a style=\"color:#0496FF;\" href=\"find\">%1</a>")
+                        .arg(tr("Find duplicates")));
+    return html;
+}
+
+void DuplicatesFeature::htmlLinkClicked(const QUrl& link) {
+    if (QString(link.path()) == "find") {
+        findDuplicates();
+    } else {
+        qDebug() << "Unknown link clicked" << link;
+    }
+}
+
+void DuplicatesFeature::activate() {
+    emit switchToView(kViewName);
+    emit disableSearch();
+    emit enableCoverArtDisplay(true);
+}
+
+void DuplicatesFeature::activateChild(const QModelIndex& index) {
+    if (!index.isValid()) {
+        return;
+    }
+    const TreeItem* pItem = static_cast<TreeItem*>(index.internalPointer());
+    if (!(pItem && pItem->getData().isValid())) {
+        return;
+    }
+    const int groupIndex = pItem->getData().toInt();
+    VERIFY_OR_DEBUG_ASSERT(groupIndex >= 0 && groupIndex < m_groups.size()) {
+        return;
+    }
+    m_pDuplicatesTableModel->selectGroup(
+            m_firstGroupId + groupIndex,
+            m_groups[groupIndex].trackIds);
+    emit showTrackModel(m_pDuplicatesTableModel);
+    emit enableCoverArtDisplay(true);
+}
+
+void DuplicatesFeature::findDuplicates() {
+    if (m_future.isRunning()) {
+        return;
+    }
+    m_future = QtConcurrent::run(findDuplicateGroups, m_pLibrary->dbConnectionPool());
+    m_futureWatcher.setFuture(m_future);
+    m_title = tr("(searching) Duplicates");
+    //calls a slot in the sidebar model such that 'Duplicates (isLoading)' is displayed.
+    emit featureIsLoading(this, true);
+    if (m_pRootView) {
+        m_pRootView->setHtml(formatRootViewHtml());
+    }
+}
+
+void DuplicatesFeature::onDuplicatesFound() {
+    // The views of the previous search must not be reused
+    m_firstGroupId += m_groups.size();
+    m_groups = m_future.result();
+    m_searched = true;
+
+    std::unique_ptr<TreeItem> pRootItem = TreeItem::newRoot(this);
+    for (int i = 0; i < m_groups.size(); ++i) {
+        const Group& group = m_groups[i];
+        const QString label = group.label.isEmpty()
+                ? tr("Unknown")
+                : group.label;
+        pRootItem->appendChild(
+                QStringLiteral("%1 (%2)").arg(label, QString::number(group.trackIds.size())),
+                i);
+    }
+    m_childModel.setRootItem(std::move(pRootItem));
+
+    // calls a slot in the sidebarmodel such that 'isLoading' is removed from the feature title.
+    m_title = tr("Duplicates");
+    emit featureLoadingFinished(this);
+    if (m_pRootView) {
+        m_pRootView->setHtml(formatRootViewHtml());
+    }
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <QFuture>
+#include <QFutureWatcher>
+#include <QIcon>
+#include <QList>
+#include <QPointer>
+
+#include "library/libraryfeature.h"
+#include "library/treeitemmodel.h"
+#include "track/trackid.h"
+#include "util/db/dbconnectionpool.h"
+
+class DuplicatesTableModel;
+class WLibraryTextBrowser;
+
+/// Finds duplicate tracks in the whole library by comparing the stored
+/// fingerprints, durations and metadata and presents each group of
+/// duplicates as a child item. The search runs on worker threads and is
+/// started explicitly by the user, because it takes a while for large
+/// libraries.
+class DuplicatesFeature final : public LibraryFeature {
+    Q_OBJECT
+
+  public:
+    struct Group {
+        QString label;
+        QList<TrackId> trackIds;
+    };
+
+    DuplicatesFeature(Library* pLibrary, UserSettingsPointer pConfig);
+    ~DuplicatesFeature() override;
+
+    QVariant title() override;
+    QIcon getIcon() override;
+
+    void bindLibraryWidget(WLibrary* libraryWidget,
+            KeyboardEventFilter* keyboard) override;
+
+    TreeItemModel* getChildModel() override;
+
+  public slots:
+    void activate() override;
+    void activateChild(const QModelIndex& index) override;
+
+  private slots:
+    void htmlLinkClicked(const QUrl& link);
+    void onDuplicatesFound();
+
+  private:
+    void findDuplicates();
+    QString formatRootViewHtml() const;
+
+    const QIcon m_icon;
+    QString m_title;
+
+    TreeItemModel m_childModel;
+    DuplicatesTableModel* m_pDuplicatesTableModel;
+    QPointer<WLibraryTextBrowser> m_pRootView;
+
+    QFutureWatcher<QList<Group>> m_futureWatcher;
+    QFuture<QList<Group>> m_future;
+    QList<Group> m_groups;
+    bool m_searched;
+    // Identifies the groups of the current search. Each search starts with
+    // a new range of ids, because the temporary views cannot be updated.
+    int m_firstGroupId;
+};
@@ -0,0 +1,75 @@
+#include "library/duplicates/duplicatestablemodel.h"
+
+#include <QStringList>
+
+#include "library/dao/trackschema.h"
+#include "library/trackcollection.h"
+#include "library/trackcollectionmanager.h"
+#include "moc_duplicatestablemodel.cpp"
+#include "util/db/fwdsqlquery.h"
+
+DuplicatesTableModel::DuplicatesTableModel(
+        QObject* pParent,
+        TrackCollectionManager* pTrackCollectionManager)
+        : TrackSetTableModel(pParent, pTrackCollectionManager, "mixxx.db.model.duplicates") {
+}
+
+void DuplicatesTableModel::selectGroup(int groupId, const QList<TrackId>& trackIds) {
+    const QString tableName = QStringLiteral("duplicates_%1").arg(groupId);
+    QStringList trackIdStrings;
+    trackIdStrings.reserve(trackIds.size());
+    for (const auto& trackId : trackIds) {
+        trackIdStrings.append(trackId.toString());
+    }
+    QStringList columns;
+    columns << LIBRARYTABLE_ID
+            << "'' AS " + LIBRARYTABLE_PREVIEW
+            // For sorting the cover art column we give LIBRARYTABLE_COVERART
+            // the same value as the cover digest.
+            << LIBRARYTABLE_COVERART_DIGEST + " AS " + LIBRARYTABLE_COVERART;
+    // Hidden tracks are removed from the group, e.g. after the user has
+    // decided which of the duplicates to keep.
+    QString queryString =
+            QString("CREATE TEMPORARY VIEW IF NOT EXISTS %1 AS "
+                    "SELECT %2 FROM %3 "
+                    "WHERE %4 IN (%5) "
+                    "AND %6=0")
+                    .arg(tableName,
+                            columns.join(","),
+                            LIBRARY_TABLE,
+                            LIBRARYTABLE_ID,
+                            trackIdStrings.join(","),
+                            LIBRARYTABLE_MIXXXDELETED);
+    FwdSqlQuery(m_database, queryString).execPrepared();
+
+    columns[0] = LIBRARYTABLE_ID;
+    columns[1] = LIBRARYTABLE_PREVIEW;
+    columns[2] = LIBRARYTABLE_COVERART;
+    setTable(tableName,
+            LIBRARYTABLE_ID,
+            columns,
+            m_pTrackCollectionManager->internalCollection()->getTrackSource());
+    setSearch("");
+    setDefaultSort(fieldIndex("artist"), Qt::AscendingOrder);
+
+    // Only a single group is shown at a time. The view of the previous
+    // group is not needed anymore and would otherwise accumulate with
+    // every search until the database connection is closed.
+    if (!m_viewName.isEmpty() && m_viewName != tableName) {
+        FwdSqlQuery(m_database,
+                QStringLiteral("DROP VIEW IF EXISTS %1").arg(m_viewName))
+                .execPrepared();
+    }
+    m_viewName = tableName;
+}
+
+TrackModel::Capabilities DuplicatesTableModel::getCapabilities() const {
+    return Capability::AddToTrackSet |
+            Capability::AddToAutoDJ |
+            Capability::EditMetadata |
+            Capability::LoadToDeck |
+            Capability::LoadToSampler |
+            Capability::LoadToPreviewDeck |
+            Capability::Hide |
+            Capability::ResetPlayed;
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <QList>
+#include <QString>
+
+#include "library/trackset/tracksettablemodel.h"
+#include "track/trackid.h"
+
+/// Shows the tracks of a single group of duplicates.
+class DuplicatesTableModel final : public TrackSetTableModel {
+    Q_OBJECT
+
+  public:
+    DuplicatesTableModel(QObject* parent, TrackCollectionManager* pTrackCollectionManager);
+    ~DuplicatesTableModel() final = default;
+
+    /// The groupId must be unique for the lifetime of the database
+    /// connection, because it identifies the temporary view.
+    void selectGroup(int groupId, const QList<TrackId>& trackIds);
+
+    Capabilities getCapabilities() const final;
+
+  private:
+    // The temporary view of the selected group
+    QString m_viewName;
+};
@@ -12,6 +12,7 @@
 #include "library/autodj/autodjfeature.h"
 #include "library/banshee/bansheefeature.h"
 #include "library/browse/browsefeature.h"
+#include "library/duplicates/duplicatesfeature.h"
 #ifdef __ENGINEPRIME__
 #include "library/export/libraryexporter.h"
 #endif
@@ -161,6 +162,8 @@ Library::Library(
             this,
             &Library::onPlayerManagerTrackAnalyzerIdle);
 
+    addFeature(new DuplicatesFeature(this, m_pConfig));
+
     // iTunes and Rhythmbox should be last until we no longer have an obnoxious
     // messagebox popup when you select them. (This forces you to reach for your
     // mouse or keyboard if you're using MIDI control and you scroll through them...)
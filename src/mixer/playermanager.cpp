@@ -5,6 +5,7 @@
 #include "control/controlobject.h"
 #include "effects/effectrack.h"
 #include "effects/effectsmanager.h"
+#include "engine/cachingreader/cachingreaderpreloader.h"
 #include "engine/channels/enginedeck.h"
 #include "engine/enginemaster.h"
 #include "library/library.h"
@@ -60,7 +61,8 @@ PlayerManager::PlayerManager(UserSettingsPointer pConfig,
                   ConfigKey("[Master]", "num_microphones"), true, true)),
           m_pCONumAuxiliaries(new ControlObject(
                   ConfigKey("[Master]", "num_auxiliaries"), true, true)),
-          m_pTrackAnalysisScheduler(TrackAnalysisScheduler::NullPointer()) {
+          m_pTrackAnalysisScheduler(TrackAnalysisScheduler::NullPointer()),
+          m_pCachingReaderPreloader(std::make_shared<CachingReaderPreloader>()) {
     m_pCONumDecks->connectValueChangeRequest(this,
             &PlayerManager::slotChangeNumDecks, Qt::DirectConnection);
     m_pCONumSamplers->connectValueChangeRequest(this,
@@ -107,6 +109,10 @@ PlayerManager::~PlayerManager() {
         m_pTrackAnalysisScheduler->stop();
         m_pTrackAnalysisScheduler.reset();
     }
+
+    // Release the track in standby before the library is deleted
+    m_pCachingReaderPreloader->clear();
+    m_pCachingReaderPreloader->waitForFinished();
 }
 
 void PlayerManager::bindToLibrary(Library* pLibrary) {
@@ -413,6 +419,8 @@ void PlayerManager::addDeckInner() {
 
     // Register vinyl input signal with deck for passthrough support.
     EngineDeck* pEngineDeck = pDeck->getEngineDeck();
+    // Auto DJ preloads the next track for the decks
+    pEngineDeck->getEngineBuffer()->bindPreloader(m_pCachingReaderPreloader);
     m_pSoundManager->registerInput(
             AudioInput(AudioInput::VINYLCONTROL, 0, 2, deckIndex), pEngineDeck);
 
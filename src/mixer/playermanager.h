@@ -4,6 +4,7 @@
 #include <QMap>
 #include <QMutex>
 #include <QObject>
+#include <memory>
 
 #include "analyzer/trackanalysisscheduler.h"
 #include "engine/channelhandle.h"
@@ -14,6 +15,7 @@
 
 class Auxiliary;
 class BaseTrackPlayer;
+class CachingReaderPreloader;
 class ControlObject;
 class Deck;
 class EffectsManager;
@@ -50,6 +52,10 @@ class PlayerManagerInterface {
     virtual Sampler* getSampler(unsigned int sampler) const = 0;
 
     virtual unsigned int numberOfSamplers() const = 0;
+
+    // Opens the track that is going to be loaded into a deck next.
+    // Might be null if tracks are not preloaded.
+    virtual CachingReaderPreloader* getCachingReaderPreloader() const = 0;
 };
 
 class PlayerManager : public QObject, public PlayerManagerInterface {
@@ -124,6 +130,10 @@ class PlayerManager : public QObject, public PlayerManagerInterface {
         return numSamplers();
     }
 
+    CachingReaderPreloader* getCachingReaderPreloader() const override {
+        return m_pCachingReaderPreloader.get();
+    }
+
     // Get the microphone by its number. Microphones are numbered starting with 1.
     Microphone* getMicrophone(unsigned int microphone) const;
 
@@ -270,6 +280,10 @@ class PlayerManager : public QObject, public PlayerManagerInterface {
 
     TrackAnalysisScheduler::Pointer m_pTrackAnalysisScheduler;
 
+    // Shared with the decks, which are destroyed by the EngineMaster
+    // after this instance
+    std::shared_ptr<CachingReaderPreloader> m_pCachingReaderPreloader;
+
     QList<Deck*> m_decks;
     QList<Sampler*> m_samplers;
     QList<PreviewDeck*> m_previewDecks;
@@ -1,5 +1,6 @@
 #include "mixxx.h"
 
+#include <QAbstractEventDispatcher>
 #include <QDesktopServices>
 #include <QFileDialog>
 #include <QGLFormat>
@@ -27,6 +28,7 @@
 #ifdef __BROADCAST__
 #include "broadcast/broadcastmanager.h"
 #endif
+#include "control/controlchangecoalescer.h"
 #include "control/controlpushbutton.h"
 #include "controllers/controllermanager.h"
 #include "controllers/keyboard/keyboardeventfilter.h"
@@ -53,6 +55,7 @@
 #include "util/debug.h"
 #include "util/experiment.h"
 #include "util/font.h"
+#include "util/frametimeline.h"
 #include "util/logger.h"
 #include "util/math.h"
 #include "util/sandbox.h"
@@ -171,6 +174,13 @@ MixxxMainWindow::MixxxMainWindow(
     WaveformWidgetFactory::createInstance(); // takes a long time
     WaveformWidgetFactory::instance()->setConfig(m_pCoreServices->getSettings());
     WaveformWidgetFactory::instance()->startVSync(m_pGuiTick, m_pVisualsManager);
+    // The GuiTick flushes the coalesced control changes once per frame, so
+    // they can only be enabled once the VSyncThread is running.
+    ControlChangeCoalescer::setEnabled(m_pCoreServices->getSettings()->getValue<bool>(
+            ConfigKey("[Controls]", "CoalesceGuiUpdates"), false));
+    if (FrameTimeline::isEnabled()) {
+        FrameTimeline::instance().watchEventDispatcher(QAbstractEventDispatcher::instance());
+    }
 
     connect(this,
             &MixxxMainWindow::skinLoaded,
@@ -403,6 +413,7 @@ MixxxMainWindow::~MixxxMainWindow() {
 
     delete m_pTouchShift;
 
+    ControlChangeCoalescer::setEnabled(false);
     WaveformWidgetFactory::destroy();
 
     delete m_pGuiTick;
@@ -50,54 +50,19 @@ QString calcFingerprint(
         return QString();
     }
 
-    std::vector<SAMPLE> fingerprintSamples(
-            audioSourceProxy.getSignalInfo().frames2samples(
-                    readableSampleFrames.frameLength()));
-    // Convert floating-point to integer
-    SampleUtil::convertFloat32ToS16(
-            &fingerprintSamples[0],
-            sampleBuffer.data(),
-            fingerprintSamples.size());
-
     qDebug() << "reading file took" << timerReadingFile.elapsed().debugMillisWithUnit();
 
-    ChromaprintContext* ctx = chromaprint_new(CHROMAPRINT_ALGORITHM_DEFAULT);
-    chromaprint_start(
-            ctx,
-            audioSourceProxy.getSignalInfo().getSampleRate(),
-            audioSourceProxy.getSignalInfo().getChannelCount());
-
     PerformanceTimer timerGeneratingFingerprint;
     timerGeneratingFingerprint.start();
-    const int success = chromaprint_feed(
-            ctx,
-            &fingerprintSamples[0],
-            static_cast<int>(fingerprintSamples.size()));
-    chromaprint_finish(ctx);
-    if (!success) {
-        qWarning() << "Failed to generate fingerprint from sample data";
-        chromaprint_free(ctx);
-        return QString();
-    }
-
-    uint32_p fprint = nullptr;
-    int size = 0;
-    int ret = chromaprint_get_raw_fingerprint(ctx, &fprint, &size);
-    QByteArray fingerprint;
-    if (ret == 1) {
-        char_p encoded = nullptr;
-        int encoded_size = 0;
-        chromaprint_encode_fingerprint(fprint, size,
-                                       CHROMAPRINT_ALGORITHM_DEFAULT,
-                                       &encoded,
-                                       &encoded_size, 1);
 
-        fingerprint.append(reinterpret_cast<char*>(encoded), encoded_size);
-
-        chromaprint_dealloc(fprint);
-        chromaprint_dealloc(encoded);
+    ChromaPrintStream stream(
+            audioSourceProxy.getSignalInfo().getSampleRate(),
+            audioSourceProxy.getSignalInfo().getChannelCount());
+    if (!stream.feed(readableSampleFrames.readableData(),
+                readableSampleFrames.readableLength())) {
+        return QString();
     }
-    chromaprint_free(ctx);
+    const QString fingerprint = stream.finish();
 
     qDebug() << "generating fingerprint took"
              << timerGeneratingFingerprint.elapsed().debugMillisWithUnit();
@@ -112,6 +77,11 @@ ChromaPrinter::ChromaPrinter(QObject* parent)
 }
 
 QString ChromaPrinter::getFingerprint(TrackPointer pTrack) {
+    const QString storedFingerprint = pTrack->getFingerprint();
+    if (!storedFingerprint.isEmpty()) {
+        return storedFingerprint;
+    }
+
     mixxx::AudioSource::OpenParams config;
     // always stereo / 2 channels (see below)
     config.setChannelCount(mixxx::audio::ChannelCount(2));
@@ -134,3 +104,88 @@ QString ChromaPrinter::getFingerprint(TrackPointer pTrack) {
 
     return calcFingerprint(audioSourceProxy, fingerprintRange);
 }
+
+// static
+std::vector<quint32> ChromaPrinter::decodeFingerprint(const QString& fingerprint) {
+    QByteArray encoded = fingerprint.toLatin1();
+    if (encoded.isEmpty()) {
+        return {};
+    }
+    uint32_p fprint = nullptr;
+    int size = 0;
+    int algorithm = 0;
+    const int ret = chromaprint_decode_fingerprint(
+            encoded.data(),
+            encoded.size(),
+            &fprint,
+            &size,
+            &algorithm,
+            1);
+    std::vector<quint32> decoded;
+    if (ret == 1) {
+        const auto* pBegin = reinterpret_cast<const quint32*>(fprint);
+        decoded.assign(pBegin, pBegin + size);
+    }
+    chromaprint_dealloc(fprint);
+    return decoded;
+}
+
+ChromaPrintStream::ChromaPrintStream(int sampleRate, int channelCount)
+        : m_pContext(chromaprint_new(CHROMAPRINT_ALGORITHM_DEFAULT)),
+          m_remainingSamples(kFingerprintDuration * sampleRate * channelCount) {
+    chromaprint_start(m_pContext, sampleRate, channelCount);
+}
+
+ChromaPrintStream::~ChromaPrintStream() {
+    chromaprint_free(m_pContext);
+}
+
+bool ChromaPrintStream::feed(const CSAMPLE* pSamples, SINT sampleCount) {
+    const SINT feedCount = math_min(sampleCount, m_remainingSamples);
+    if (feedCount <= 0) {
+        return true;
+    }
+    if (static_cast<SINT>(m_convertBuffer.size()) < feedCount) {
+        m_convertBuffer.resize(feedCount);
+    }
+    // Convert floating-point to integer
+    SampleUtil::convertFloat32ToS16(
+            m_convertBuffer.data(),
+            pSamples,
+            feedCount);
+    if (!chromaprint_feed(
+                m_pContext,
+                m_convertBuffer.data(),
+                static_cast<int>(feedCount))) {
+        qWarning() << "Failed to generate fingerprint from sample data";
+        return false;
+    }
+    m_remainingSamples -= feedCount;
+    return true;
+}
+
+QString ChromaPrintStream::finish() {
+    if (!chromaprint_finish(m_pContext)) {
+        qWarning() << "Failed to generate fingerprint from sample data";
+        return QString();
+    }
+
+    uint32_p fprint = nullptr;
+    int size = 0;
+    int ret = chromaprint_get_raw_fingerprint(m_pContext, &fprint, &size);
+    QByteArray fingerprint;
+    if (ret == 1) {
+        char_p encoded = nullptr;
+        int encoded_size = 0;
+        chromaprint_encode_fingerprint(fprint, size,
+                                       CHROMAPRINT_ALGORITHM_DEFAULT,
+                                       &encoded,
+                                       &encoded_size, 1);
+
+        fingerprint.append(reinterpret_cast<char*>(encoded), encoded_size);
+
+        chromaprint_dealloc(fprint);
+        chromaprint_dealloc(encoded);
+    }
+    return fingerprint;
+}
@@ -1,13 +1,52 @@
 #pragma once
 
+#include <chromaprint.h>
+
 #include <QObject>
+#include <vector>
 
 #include "track/track_decl.h"
+#include "util/types.h"
 
 class ChromaPrinter: public QObject {
   Q_OBJECT
 
 public:
       explicit ChromaPrinter(QObject* parent = NULL);
+
+      // Returns the fingerprint that has been stored while analyzing
+      // the track or decodes the track to calculate it.
       QString getFingerprint(TrackPointer pTrack);
+
+      // Decodes an encoded fingerprint into the raw sub-fingerprints that
+      // can be compared bit-wise. Returns an empty vector on failure.
+      static std::vector<quint32> decodeFingerprint(const QString& fingerprint);
+};
+
+// Calculates a fingerprint incrementally from consecutive chunks of
+// interleaved samples, e.g. while the track is decoded for analysis.
+// Only the first two minutes of audio are fingerprinted.
+class ChromaPrintStream final {
+  public:
+    ChromaPrintStream(int sampleRate, int channelCount);
+    ChromaPrintStream(const ChromaPrintStream&) = delete;
+    ChromaPrintStream& operator=(const ChromaPrintStream&) = delete;
+    ~ChromaPrintStream();
+
+    // Consumes samples until enough audio has been fingerprinted and
+    // ignores the remaining samples. Returns false on failure.
+    bool feed(const CSAMPLE* pSamples, SINT sampleCount);
+
+    // Returns true if no more samples are needed.
+    bool isComplete() const {
+        return m_remainingSamples <= 0;
+    }
+
+    // Returns the encoded fingerprint or an empty string on failure.
+    QString finish();
+
+  private:
+    ChromaprintContext* m_pContext;
+    SINT m_remainingSamples;
+    std::vector<SAMPLE> m_convertBuffer;
 };
@@ -163,6 +163,7 @@ void DlgPrefLibrary::slotResetToDefaults() {
     checkBox_library_scan->setChecked(false);
     checkBox_SyncTrackMetadataExport->setChecked(false);
     checkBox_use_relative_path->setChecked(false);
+    checkBox_AnalyzeFingerprint->setChecked(false);
     checkBox_show_rhythmbox->setChecked(true);
     checkBox_show_banshee->setChecked(true);
     checkBox_show_itunes->setChecked(true);
@@ -184,6 +185,8 @@ void DlgPrefLibrary::slotUpdate() {
             ConfigKey("[Library]","SyncTrackMetadataExport"), false));
     checkBox_use_relative_path->setChecked(m_pConfig->getValue(
             ConfigKey("[Library]","UseRelativePathOnExport"), false));
+    checkBox_AnalyzeFingerprint->setChecked(m_pConfig->getValue(
+            ConfigKey("[Library]", "AnalyzeFingerprint"), false));
     checkBox_show_rhythmbox->setChecked(m_pConfig->getValue(
             ConfigKey("[Library]","ShowRhythmboxLibrary"), true));
     checkBox_show_banshee->setChecked(m_pConfig->getValue(
@@ -330,6 +333,8 @@ void DlgPrefLibrary::slotApply() {
                 ConfigValue((int)checkBox_SyncTrackMetadataExport->isChecked()));
     m_pConfig->set(ConfigKey("[Library]","UseRelativePathOnExport"),
                 ConfigValue((int)checkBox_use_relative_path->isChecked()));
+    m_pConfig->set(ConfigKey("[Library]", "AnalyzeFingerprint"),
+            ConfigValue((int)checkBox_AnalyzeFingerprint->isChecked()));
     m_pConfig->set(ConfigKey("[Library]","ShowRhythmboxLibrary"),
                 ConfigValue((int)checkBox_show_rhythmbox->isChecked()));
     m_pConfig->set(ConfigKey("[Library]","ShowBansheeLibrary"),
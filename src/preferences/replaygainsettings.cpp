@@ -16,6 +16,10 @@ const char* kReplayGainReanalyze = "ReplayGainReanalyze";
 const char* kReplayGainEnabled = "ReplayGainEnabled";
 
 const int kInitialDefaultBoostDefault = -6;
+
+// Must be changed whenever the results of the analyzer change
+const QString kReplayGain1AnalyzerVersionId = QStringLiteral("ReplayGain1");
+const QString kReplayGain2AnalyzerVersionId = QStringLiteral("ReplayGain2:EBU-R128:-18LUFS");
 } // anonymous namespace
 
 ReplayGainSettings::ReplayGainSettings(UserSettingsPointer pConfig)
@@ -92,12 +96,30 @@ bool ReplayGainSettings::isAnalyzerEnabled(int version) const {
 
 bool ReplayGainSettings::isAnalyzerDisabled(int version, TrackPointer tio) const {
     if (isAnalyzerEnabled(version)) {
-        if (getReplayGainReanalyze()) {
-            // ignore stored replay gain
+        if (!tio->getReplayGain().hasRatio()) {
             return false;
         }
-        return tio->getReplayGain().hasRatio();
+        if (getReplayGainReanalyze()) {
+            // Override a stored replay gain that has been imported or
+            // calculated by a different analyzer, but don't calculate
+            // the same value again.
+            return tio->getReplayGainVersion() == getAnalyzerVersionId(version);
+        }
+        return true;
     }
     // not enabled, pretend we have already a stored value.
     return true;
 }
+
+// static
+QString ReplayGainSettings::getAnalyzerVersionId(int version) {
+    switch (version) {
+    case 1:
+        return kReplayGain1AnalyzerVersionId;
+    case 2:
+        return kReplayGain2AnalyzerVersionId;
+    default:
+        DEBUG_ASSERT(!"Unknown ReplayGain analyzer version");
+        return QString();
+    }
+}
@@ -23,6 +23,11 @@ class ReplayGainSettings {
     bool isAnalyzerEnabled(int version) const;
     bool isAnalyzerDisabled(int version, TrackPointer tio) const;
 
+    // Identifies the algorithm and the parameters of the given analyzer
+    // version. Stored with the calculated ReplayGain of a track to avoid
+    // re-analyzing it unless the analyzer changes.
+    static QString getAnalyzerVersionId(int version);
+
   private:
     // Pointer to config object
     UserSettingsPointer m_pConfig;
@@ -84,4 +84,15 @@ TEST_F(AnalyzerWaveformTest, canary) {
     }
 }
 
+// A track with up-to-date waveforms must not be decoded again
+TEST_F(AnalyzerWaveformTest, skipUpToDateTrack) {
+    ASSERT_TRUE(aw.shouldAnalyze(tio));
+    ASSERT_TRUE(aw.initialize(tio, tio->getSampleRate(), BIGBUF_SIZE));
+    aw.processSamples(bigbuf, BIGBUF_SIZE);
+    aw.storeResults(tio);
+    aw.cleanup();
+
+    EXPECT_FALSE(AnalyzerWaveform(config(), QSqlDatabase()).shouldAnalyze(tio));
+}
+
 } // namespace
@@ -0,0 +1,213 @@
+#include "analyzer/analyzerdecimator.h"
+
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+#include <QVector>
+#include <algorithm>
+#include <vector>
+
+#include "analyzer/constants.h"
+#include "analyzer/plugins/analyzerqueenmarybeats.h"
+#include "analyzer/plugins/analyzerqueenmarykey.h"
+#include "util/math.h"
+
+namespace {
+
+constexpr mixxx::audio::ChannelCount kChannelCount = mixxx::kAnalysisChannels;
+
+std::vector<CSAMPLE> generateSine(int sampleRate, double frequency, SINT numFrames) {
+    std::vector<CSAMPLE> samples(numFrames * kChannelCount);
+    for (SINT i = 0; i < numFrames; ++i) {
+        const double phase = 2 * M_PI * frequency * i / sampleRate;
+        samples[i * kChannelCount] = static_cast<CSAMPLE>(0.5 * sin(phase));
+        samples[i * kChannelCount + 1] = samples[i * kChannelCount];
+    }
+    return samples;
+}
+
+// Short noise bursts on each beat over a quiet tone
+std::vector<CSAMPLE> generateClickTrack(int sampleRate, double bpm, double seconds) {
+    const auto numFrames = static_cast<SINT>(seconds * sampleRate);
+    const auto beatLength = static_cast<SINT>(60.0 * sampleRate / bpm);
+    const auto clickLength = sampleRate / 100;
+    std::vector<CSAMPLE> samples = generateSine(sampleRate, 440.0, numFrames);
+    quint32 noise = 1;
+    for (SINT i = 0; i < numFrames; ++i) {
+        samples[i * kChannelCount] *= 0.1f;
+        samples[i * kChannelCount + 1] *= 0.1f;
+        if (i % beatLength < clickLength) {
+            noise = noise * 1664525u + 1013904223u;
+            const CSAMPLE click = (noise >> 8) / static_cast<CSAMPLE>(1 << 24) - 0.5f;
+            samples[i * kChannelCount] += click;
+            samples[i * kChannelCount + 1] += click;
+        }
+    }
+    return samples;
+}
+
+// Decimates the samples in chunks of the given size
+std::vector<CSAMPLE> decimate(
+        const std::vector<CSAMPLE>& samples,
+        int factor,
+        SINT samplesPerChunk = mixxx::kAnalysisSamplesPerChunk) {
+    mixxx::AnalyzerDecimator decimator(factor);
+    std::vector<CSAMPLE> output;
+    for (std::size_t offset = 0; offset < samples.size(); offset += samplesPerChunk) {
+        const auto slice = decimator.process(
+                samples.data() + offset,
+                math_min<SINT>(samplesPerChunk, samples.size() - offset));
+        output.insert(output.end(), slice.data(), slice.data() + slice.length());
+    }
+    const auto slice = decimator.finish();
+    output.insert(output.end(), slice.data(), slice.data() + slice.length());
+    return output;
+}
+
+TEST(AnalyzerDecimatorTest, DecimationFactor) {
+    EXPECT_EQ(1, mixxx::AnalyzerDecimator::decimationFactor(44100, 44100));
+    EXPECT_EQ(1, mixxx::AnalyzerDecimator::decimationFactor(48000, 44100));
+    EXPECT_EQ(1, mixxx::AnalyzerDecimator::decimationFactor(22050, 44100));
+    EXPECT_EQ(2, mixxx::AnalyzerDecimator::decimationFactor(88200, 44100));
+    EXPECT_EQ(2, mixxx::AnalyzerDecimator::decimationFactor(96000, 44100));
+    EXPECT_EQ(4, mixxx::AnalyzerDecimator::decimationFactor(192000, 44100));
+    EXPECT_EQ(1, mixxx::AnalyzerDecimator::decimationFactor(96000, 0));
+}
+
+TEST(AnalyzerDecimatorTest, OutputLength) {
+    for (int factor = 2; factor <= 4; ++factor) {
+        for (SINT numFrames : {1, 10, 1000, 10001}) {
+            const auto output = decimate(
+                    std::vector<CSAMPLE>(numFrames * kChannelCount, 0.1f),
+                    factor);
+            EXPECT_EQ((numFrames + factor - 1) / factor * kChannelCount,
+                    static_cast<SINT>(output.size()))
+                    << "factor" << factor << "frames" << numFrames;
+        }
+    }
+}
+
+TEST(AnalyzerDecimatorTest, ImpulseIsAligned) {
+    constexpr int kFactor = 2;
+    std::vector<CSAMPLE> samples(10000 * kChannelCount, CSAMPLE_ZERO);
+    samples[5000 * kChannelCount] = 1.0f;
+    const auto output = decimate(samples, kFactor);
+
+    std::vector<CSAMPLE> mono;
+    for (std::size_t i = 0; i < output.size(); i += kChannelCount) {
+        mono.push_back(output[i]);
+        // The downmixed signal is duplicated into both channels
+        EXPECT_EQ(output[i], output[i + 1]);
+    }
+    const auto peak = std::max_element(mono.begin(), mono.end());
+    EXPECT_EQ(5000 / kFactor, peak - mono.begin());
+}
+
+TEST(AnalyzerDecimatorTest, PassesLowFrequencies) {
+    constexpr int kFactor = 2;
+    constexpr SINT kFrames = 96000;
+    const auto output = decimate(generateSine(96000, 1000.0, kFrames), kFactor);
+    const auto expected = generateSine(48000, 1000.0, kFrames / kFactor);
+    ASSERT_EQ(expected.size(), output.size());
+    // Skip the transient response at both ends
+    for (std::size_t i = 1000; i < output.size() - 1000; ++i) {
+        EXPECT_NEAR(expected[i], output[i], 1e-3) << i;
+    }
+}
+
+TEST(AnalyzerDecimatorTest, AttenuatesAliasingFrequencies) {
+    for (int factor = 2; factor <= 4; ++factor) {
+        const int sampleRate = 48000 * factor;
+        // Would be mirrored to 10 kHz after decimation
+        const double frequency = 48000 - 10000;
+        const auto output = decimate(generateSine(sampleRate, frequency, sampleRate), factor);
+        for (std::size_t i = 1000; i < output.size() - 1000; ++i) {
+            EXPECT_GT(1e-3, fabs(output[i])) << "factor" << factor << "sample" << i;
+        }
+    }
+}
+
+TEST(AnalyzerDecimatorTest, ChunkSizeDoesNotMatter) {
+    const auto samples = generateClickTrack(96000, 120.0, 1.0);
+    const auto expected = decimate(samples, 2);
+    for (SINT samplesPerChunk : {2, 6, 130, 8192}) {
+        const auto output = decimate(samples, 2, samplesPerChunk);
+        ASSERT_EQ(expected.size(), output.size());
+        for (std::size_t i = 0; i < output.size(); ++i) {
+            EXPECT_FLOAT_EQ(expected[i], output[i]);
+        }
+    }
+}
+
+TEST(AnalyzerDecimatorTest, BeatsOfDecimatedSignal) {
+    constexpr int kSampleRate = 96000;
+    constexpr double kBpm = 120.0;
+    const int factor = mixxx::AnalyzerDecimator::decimationFactor(
+            kSampleRate, mixxx::kAnalysisBandLimitedSampleRate);
+    ASSERT_EQ(2, factor);
+    const auto samples = decimate(generateClickTrack(kSampleRate, kBpm, 30.0), factor);
+
+    mixxx::AnalyzerQueenMaryBeats plugin;
+    ASSERT_TRUE(plugin.initialize(kSampleRate / factor));
+    ASSERT_TRUE(plugin.processSamples(samples.data(), static_cast<int>(samples.size())));
+    ASSERT_TRUE(plugin.finalize());
+
+    // Map the beats onto the original signal like AnalyzerBeats does
+    QVector<double> intervals;
+    const QVector<double> beats = plugin.getBeats();
+    for (int i = 1; i < beats.size(); ++i) {
+        intervals.append((beats[i] - beats[i - 1]) * factor);
+    }
+    ASSERT_FALSE(intervals.isEmpty());
+    std::sort(intervals.begin(), intervals.end());
+    const double medianInterval = intervals[intervals.size() / 2];
+    EXPECT_NEAR(60.0 * kSampleRate / kBpm, medianInterval, 0.02 * kSampleRate);
+}
+
+// Measures the beat and key detection time for 60 seconds of audio with
+// the given sample rate, either decimated or at full rate.
+static void BM_AnalyzeBeatsAndKey(benchmark::State& state) {
+    const auto sampleRate = static_cast<int>(state.range(0));
+    const int factor = state.range(1)
+            ? mixxx::AnalyzerDecimator::decimationFactor(
+                      sampleRate, mixxx::kAnalysisBandLimitedSampleRate)
+            : 1;
+    const auto samples = generateClickTrack(sampleRate, 120.0, 60.0);
+
+    while (state.KeepRunning()) {
+        mixxx::AnalyzerDecimator decimator(factor);
+        mixxx::AnalyzerQueenMaryBeats beatsPlugin;
+        mixxx::AnalyzerQueenMaryKey keyPlugin;
+        beatsPlugin.initialize(sampleRate / factor);
+        keyPlugin.initialize(sampleRate / factor);
+        const auto processSamples = [&](mixxx::SampleBuffer::ReadableSlice slice) {
+            if (!slice.empty()) {
+                beatsPlugin.processSamples(slice.data(), slice.length());
+                keyPlugin.processSamples(slice.data(), slice.length());
+            }
+        };
+        for (std::size_t offset = 0; offset < samples.size();
+                offset += mixxx::kAnalysisSamplesPerChunk) {
+            const auto slice = mixxx::SampleBuffer::ReadableSlice(
+                    samples.data() + offset,
+                    math_min<SINT>(mixxx::kAnalysisSamplesPerChunk,
+                            samples.size() - offset));
+            processSamples(factor > 1
+                            ? decimator.process(slice.data(), slice.length())
+                            : slice);
+        }
+        if (factor > 1) {
+            processSamples(decimator.finish());
+        }
+        beatsPlugin.finalize();
+        keyPlugin.finalize();
+        benchmark::DoNotOptimize(beatsPlugin.getBeats());
+    }
+}
+BENCHMARK(BM_AnalyzeBeatsAndKey)
+        ->Args({44100, 1})
+        ->Args({96000, 0})
+        ->Args({96000, 1})
+        ->Unit(benchmark::kMillisecond);
+
+} // namespace
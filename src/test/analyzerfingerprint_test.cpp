@@ -0,0 +1,97 @@
+#include "analyzer/analyzerfingerprint.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "analyzer/constants.h"
+#include "musicbrainz/chromaprinter.h"
+#include "test/mixxxtest.h"
+#include "track/track.h"
+
+namespace {
+
+constexpr int kSampleRate = 44100;
+constexpr int kTrackLengthSeconds = 30;
+
+class AnalyzerFingerprintTest : public MixxxTest {
+  protected:
+    void SetUp() override {
+        pTrack = Track::newTemporary();
+        // A sweep with some harmonics, so that the fingerprint is not empty
+        const int frames = kTrackLengthSeconds * kSampleRate;
+        samples.resize(frames * mixxx::kAnalysisChannels);
+        double phase = 0.0;
+        for (int i = 0; i < frames; ++i) {
+            const double frequency = 220.0 + 660.0 * i / frames;
+            phase += 2 * M_PI * frequency / kSampleRate;
+            const auto value = static_cast<CSAMPLE>(
+                    0.4 * std::sin(phase) + 0.2 * std::sin(3 * phase));
+            samples[i * mixxx::kAnalysisChannels] = value;
+            samples[i * mixxx::kAnalysisChannels + 1] = value;
+        }
+    }
+
+    // Feeds the samples in chunks like the AnalyzerThread does
+    void analyzeTrack() {
+        const int totalSamples = static_cast<int>(samples.size());
+        if (!analyzer.shouldAnalyze(pTrack) ||
+                !analyzer.initialize(pTrack, kSampleRate, totalSamples)) {
+            return;
+        }
+        for (int offset = 0; offset < totalSamples;
+                offset += mixxx::kAnalysisSamplesPerChunk) {
+            const int length = std::min(
+                    static_cast<int>(mixxx::kAnalysisSamplesPerChunk),
+                    totalSamples - offset);
+            ASSERT_TRUE(analyzer.processSamples(&samples[offset], length));
+        }
+        analyzer.storeResults(pTrack);
+        analyzer.cleanup();
+    }
+
+    AnalyzerFingerprint analyzer;
+    TrackPointer pTrack;
+    std::vector<CSAMPLE> samples;
+};
+
+TEST_F(AnalyzerFingerprintTest, MatchesFingerprintOfSingleDecode) {
+    analyzeTrack();
+    const QString fingerprint = pTrack->getFingerprint();
+    EXPECT_FALSE(fingerprint.isEmpty());
+
+    ChromaPrintStream stream(kSampleRate, mixxx::kAnalysisChannels);
+    ASSERT_TRUE(stream.feed(samples.data(), samples.size()));
+    EXPECT_EQ(stream.finish(), fingerprint);
+}
+
+TEST_F(AnalyzerFingerprintTest, KeepsStoredFingerprint) {
+    const QString storedFingerprint = QStringLiteral("AQAAstored");
+    pTrack->setFingerprint(storedFingerprint);
+    EXPECT_FALSE(analyzer.shouldAnalyze(pTrack));
+    EXPECT_EQ(storedFingerprint, pTrack->getFingerprint());
+}
+
+TEST_F(AnalyzerFingerprintTest, ClearFingerprintOnModifiedFile) {
+    const QString storedFingerprint = QStringLiteral("AQAAstored");
+    pTrack->setFingerprint(storedFingerprint);
+
+    mixxx::TrackMetadata metadata;
+    pTrack->readTrackMetadata(&metadata);
+    pTrack->importMetadata(metadata, QDateTime::currentDateTimeUtc());
+    EXPECT_EQ(storedFingerprint, pTrack->getFingerprint());
+
+    metadata.refTrackInfo().setTitle(QStringLiteral("Modified"));
+    pTrack->importMetadata(metadata, QDateTime::currentDateTimeUtc());
+    EXPECT_TRUE(pTrack->getFingerprint().isEmpty());
+}
+
+TEST_F(AnalyzerFingerprintTest, EnabledByConfig) {
+    EXPECT_FALSE(AnalyzerFingerprint::isEnabled(config()));
+    config()->set(ConfigKey("[Library]", "AnalyzeFingerprint"), ConfigValue(1));
+    EXPECT_TRUE(AnalyzerFingerprint::isEnabled(config()));
+}
+
+} // namespace
@@ -0,0 +1,147 @@
+#include "library/autodj/autodjplanner.h"
+
+#include <gtest/gtest.h>
+
+#include "engine/engine.h"
+#include "track/track.h"
+
+namespace {
+
+constexpr int kSampleRate = 44100;
+
+class AutoDJPlannerTest : public testing::Test {
+  protected:
+    static TrackPointer newTrack(double durationSeconds) {
+        TrackPointer pTrack = Track::newTemporary();
+        pTrack->setAudioProperties(
+                mixxx::audio::ChannelCount(2),
+                mixxx::audio::SampleRate(kSampleRate),
+                mixxx::audio::Bitrate(),
+                mixxx::Duration::fromSeconds(durationSeconds));
+        return pTrack;
+    }
+
+    static double samplePosition(double seconds) {
+        return seconds * kSampleRate * mixxx::kEngineChannelCount;
+    }
+
+    static void addCue(TrackPointer pTrack,
+            mixxx::CueType type,
+            double startSecond,
+            double endSecond) {
+        pTrack->createAndAddCue(type,
+                Cue::kNoHotCue,
+                startSecond == Cue::kNoPosition ? Cue::kNoPosition
+                                                : samplePosition(startSecond),
+                endSecond == Cue::kNoPosition ? Cue::kNoPosition
+                                              : samplePosition(endSecond));
+    }
+};
+
+TEST_F(AutoDJPlannerTest, FixedFullTrack) {
+    const QList<TrackPointer> tracks = {newTrack(180), newTrack(200), newTrack(240)};
+    const auto timeline = AutoDJPlanner::planTimeline(
+            tracks, AutoDJProcessor::TransitionMode::FixedFullTrack, 10.0);
+
+    ASSERT_EQ(3, timeline.size());
+    EXPECT_DOUBLE_EQ(0.0, timeline[0].startSecond);
+    EXPECT_DOUBLE_EQ(170.0, timeline[0].fadeBeginSecond);
+    EXPECT_DOUBLE_EQ(180.0, timeline[0].fadeEndSecond);
+    EXPECT_DOUBLE_EQ(0.0, timeline[0].timelineSecond);
+
+    EXPECT_DOUBLE_EQ(0.0, timeline[1].startSecond);
+    EXPECT_DOUBLE_EQ(190.0, timeline[1].fadeBeginSecond);
+    EXPECT_DOUBLE_EQ(200.0, timeline[1].fadeEndSecond);
+    EXPECT_DOUBLE_EQ(170.0, timeline[1].timelineSecond);
+
+    EXPECT_DOUBLE_EQ(170.0 + 190.0, timeline[2].timelineSecond);
+}
+
+TEST_F(AutoDJPlannerTest, FullIntroOutro) {
+    TrackPointer pFrom = newTrack(180);
+    addCue(pFrom, mixxx::CueType::Outro, 160, 176);
+    TrackPointer pTo = newTrack(200);
+    addCue(pTo, mixxx::CueType::Intro, 2, 10);
+    const auto timeline = AutoDJPlanner::planTimeline(
+            {pFrom, pTo}, AutoDJProcessor::TransitionMode::FullIntroOutro, 10.0);
+
+    ASSERT_EQ(2, timeline.size());
+    // The shorter intro determines the length of the transition
+    EXPECT_DOUBLE_EQ(168.0, timeline[0].fadeBeginSecond);
+    EXPECT_DOUBLE_EQ(176.0, timeline[0].fadeEndSecond);
+    EXPECT_DOUBLE_EQ(2.0, timeline[1].startSecond);
+    EXPECT_DOUBLE_EQ(168.0, timeline[1].timelineSecond);
+}
+
+TEST_F(AutoDJPlannerTest, FadeAtOutroStart) {
+    TrackPointer pFrom = newTrack(180);
+    addCue(pFrom, mixxx::CueType::Outro, 160, 176);
+    TrackPointer pTo = newTrack(200);
+    addCue(pTo, mixxx::CueType::Intro, 2, 10);
+    const auto timeline = AutoDJPlanner::planTimeline(
+            {pFrom, pTo}, AutoDJProcessor::TransitionMode::FadeAtOutroStart, 10.0);
+
+    ASSERT_EQ(2, timeline.size());
+    EXPECT_DOUBLE_EQ(160.0, timeline[0].fadeBeginSecond);
+    EXPECT_DOUBLE_EQ(168.0, timeline[0].fadeEndSecond);
+    EXPECT_DOUBLE_EQ(2.0, timeline[1].startSecond);
+}
+
+TEST_F(AutoDJPlannerTest, FixedSkipSilence) {
+    TrackPointer pFrom = newTrack(180);
+    addCue(pFrom, mixxx::CueType::AudibleSound, 1, 178);
+    TrackPointer pTo = newTrack(200);
+    addCue(pTo, mixxx::CueType::AudibleSound, 3, 199);
+    const auto timeline = AutoDJPlanner::planTimeline(
+            {pFrom, pTo}, AutoDJProcessor::TransitionMode::FixedSkipSilence, 10.0);
+
+    ASSERT_EQ(2, timeline.size());
+    EXPECT_DOUBLE_EQ(1.0, timeline[0].startSecond);
+    EXPECT_DOUBLE_EQ(168.0, timeline[0].fadeBeginSecond);
+    EXPECT_DOUBLE_EQ(178.0, timeline[0].fadeEndSecond);
+    EXPECT_DOUBLE_EQ(3.0, timeline[1].startSecond);
+    EXPECT_DOUBLE_EQ(167.0, timeline[1].timelineSecond);
+}
+
+TEST_F(AutoDJPlannerTest, TransitionAfterOutroHasPassed) {
+    AutoDJProcessor::TrackSeconds from;
+    from.outroStart = 160.0;
+    from.outroEnd = 176.0;
+    from.lastSound = 178.0;
+    from.end = 180.0;
+    AutoDJProcessor::TrackSeconds to;
+    to.introStart = 2.0;
+    to.introEnd = 10.0;
+    to.outroStart = 190.0;
+    to.outroEnd = 200.0;
+    to.lastSound = 200.0;
+    to.end = 200.0;
+
+    // E.g. Auto DJ has just been enabled. The remaining time of the
+    // playing track limits the transition.
+    const auto transition = AutoDJProcessor::calculateTransitionSeconds(
+            from,
+            177.0,
+            to,
+            0.0,
+            true,
+            AutoDJProcessor::TransitionMode::FullIntroOutro,
+            10.0);
+    EXPECT_DOUBLE_EQ(177.0, transition.fadeBegin);
+    EXPECT_DOUBLE_EQ(180.0, transition.fadeEnd);
+    EXPECT_DOUBLE_EQ(2.0, transition.to.start);
+    EXPECT_DOUBLE_EQ(190.0, transition.to.fadeBegin);
+    EXPECT_DOUBLE_EQ(200.0, transition.to.fadeEnd);
+}
+
+TEST_F(AutoDJPlannerTest, SkipTracksWithoutDuration) {
+    const QList<TrackPointer> tracks = {newTrack(180), newTrack(0), newTrack(200)};
+    const auto timeline = AutoDJPlanner::planTimeline(
+            tracks, AutoDJProcessor::TransitionMode::FixedFullTrack, 10.0);
+
+    ASSERT_EQ(2, timeline.size());
+    EXPECT_EQ(tracks[0], timeline[0].pTrack);
+    EXPECT_EQ(tracks[2], timeline[1].pTrack);
+}
+
+} // namespace
@@ -139,6 +139,10 @@ class MockPlayerManager : public PlayerManagerInterface {
         return static_cast<unsigned int>(numPreviewDecks.get());
     }
 
+    CachingReaderPreloader* getCachingReaderPreloader() const {
+        return nullptr;
+    }
+
     ControlObject numDecks;
     ControlObject numSamplers;
     ControlObject numPreviewDecks;
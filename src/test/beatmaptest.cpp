@@ -1,8 +1,11 @@
+#include <benchmark/benchmark.h>
 #include <gtest/gtest.h>
 #include <memory.h>
 
 #include <QtDebug>
+#include <functional>
 
+#include "proto/beats.pb.h"
 #include "track/beatmap.h"
 #include "track/track.h"
 
@@ -55,25 +58,25 @@ TEST_F(BeatMapTest, Scale) {
     const int numBeats = 100;
     // Note beats must be in frames, not samples.
     QVector<double> beats = createBeatVector(startOffsetFrames, numBeats, beatLengthFrames);
-    auto pMap = std::make_unique<BeatMap>(*m_pTrack, 0, beats);
+    BeatsPointer pMap(new BeatMap(*m_pTrack, 0, beats));
 
     EXPECT_DOUBLE_EQ(bpm, pMap->getBpm());
-    pMap->scale(Beats::DOUBLE);
+    pMap = pMap->scale(Beats::DOUBLE);
     EXPECT_DOUBLE_EQ(2 * bpm, pMap->getBpm());
 
-    pMap->scale(Beats::HALVE);
+    pMap = pMap->scale(Beats::HALVE);
     EXPECT_DOUBLE_EQ(bpm, pMap->getBpm());
 
-    pMap->scale(Beats::TWOTHIRDS);
+    pMap = pMap->scale(Beats::TWOTHIRDS);
     EXPECT_DOUBLE_EQ(bpm * 2 / 3, pMap->getBpm());
 
-    pMap->scale(Beats::THREEHALVES);
+    pMap = pMap->scale(Beats::THREEHALVES);
     EXPECT_DOUBLE_EQ(bpm, pMap->getBpm());
 
-    pMap->scale(Beats::THREEFOURTHS);
+    pMap = pMap->scale(Beats::THREEFOURTHS);
     EXPECT_DOUBLE_EQ(bpm * 3 / 4, pMap->getBpm());
 
-    pMap->scale(Beats::FOURTHIRDS);
+    pMap = pMap->scale(Beats::FOURTHIRDS);
     EXPECT_DOUBLE_EQ(bpm, pMap->getBpm());
 }
 
@@ -295,4 +298,131 @@ TEST_F(BeatMapTest, TestBpmAround) {
     EXPECT_DOUBLE_EQ(filebpm, pMap->getBpmAroundPosition(1 * approx_beat_length, 4));
 }
 
+TEST_F(BeatMapTest, DisabledBeatsAreSkippedAndSerialized) {
+    const double bpm = 60.0;
+    m_pTrack->setBpm(bpm);
+    const int beatLengthFrames = static_cast<int>(getBeatLengthFrames(bpm));
+    const double beatLengthSamples = getBeatLengthSamples(bpm);
+
+    // Every third beat is disabled
+    mixxx::track::io::BeatMap map;
+    for (int i = 0; i < 30; ++i) {
+        mixxx::track::io::Beat* pBeat = map.add_beat();
+        pBeat->set_frame_position(i * beatLengthFrames);
+        if (i % 3 == 2) {
+            pBeat->set_enabled(false);
+        }
+    }
+    std::string serialized;
+    map.SerializeToString(&serialized);
+    const QByteArray byteArray(serialized.data(), static_cast<int>(serialized.size()));
+    auto pMap = std::make_unique<BeatMap>(*m_pTrack, 0, byteArray);
+
+    // Beat 2 is disabled, so the next beat from beat 1 is beat 3
+    const double beat1 = 1 * beatLengthSamples;
+    const double beat3 = 3 * beatLengthSamples;
+    EXPECT_EQ(beat3, pMap->findNthBeat(beat1, 2));
+    EXPECT_EQ(beat1, pMap->findNthBeat(beat3, -2));
+    double prevBeat, nextBeat;
+    pMap->findPrevNextBeats(beat1, &prevBeat, &nextBeat);
+    EXPECT_EQ(beat1, prevBeat);
+    EXPECT_EQ(beat3, nextBeat);
+
+    int count = 0;
+    auto pIterator = pMap->findBeats(0, 30 * beatLengthSamples);
+    while (pIterator && pIterator->hasNext()) {
+        pIterator->next();
+        ++count;
+    }
+    EXPECT_EQ(20, count);
+
+    // The disabled beats survive a round trip
+    mixxx::track::io::BeatMap roundTrip;
+    const QByteArray output = pMap->toByteArray();
+    ASSERT_TRUE(roundTrip.ParseFromArray(output.constData(), output.size()));
+    ASSERT_EQ(map.beat_size(), roundTrip.beat_size());
+    for (int i = 0; i < map.beat_size(); ++i) {
+        EXPECT_EQ(map.beat(i).frame_position(), roundTrip.beat(i).frame_position());
+        EXPECT_EQ(map.beat(i).enabled(), roundTrip.beat(i).enabled());
+    }
+}
+
+TEST_F(BeatMapTest, AddRemoveTranslate) {
+    const double bpm = 60.0;
+    m_pTrack->setBpm(bpm);
+    const double beatLengthFrames = getBeatLengthFrames(bpm);
+    const double beatLengthSamples = getBeatLengthSamples(bpm);
+    QVector<double> beats = createBeatVector(0, 10, beatLengthFrames);
+    const BeatsPointer pMap(new BeatMap(*m_pTrack, 0, beats));
+
+    const double halfBeat = 4.5 * beatLengthSamples;
+    const BeatsPointer pAdded = pMap->addBeat(halfBeat);
+    EXPECT_EQ(halfBeat, pAdded->findNthBeat(4 * beatLengthSamples, 2));
+    const BeatsPointer pRemoved = pAdded->removeBeat(halfBeat);
+    EXPECT_EQ(5 * beatLengthSamples, pRemoved->findNthBeat(4 * beatLengthSamples, 2));
+
+    // The first beat is moved before the start of the track and removed
+    const BeatsPointer pTranslated = pMap->translate(-0.5 * beatLengthSamples);
+    EXPECT_EQ(0.5 * beatLengthSamples, pTranslated->findNextBeat(0));
+    EXPECT_DOUBLE_EQ(bpm, pTranslated->getBpm());
+
+    // A snapshot is never modified by the mutations
+    EXPECT_EQ(5 * beatLengthSamples, pMap->findNthBeat(4 * beatLengthSamples, 2));
+    EXPECT_EQ(0, pMap->findNextBeat(0));
+}
+
+static void runBeatMapBenchmark(benchmark::State& state,
+        const std::function<void(const BeatMap&, double)>& query) {
+    const int kSampleRate = 44100;
+    const int kNumBeats = 10000;
+    TrackPointer pTrack = Track::newTemporary();
+    pTrack->setAudioProperties(
+            mixxx::audio::ChannelCount(2),
+            mixxx::audio::SampleRate(kSampleRate),
+            mixxx::audio::Bitrate(),
+            mixxx::Duration::fromSeconds(3600));
+    // A slightly drifting tempo around 128 BPM
+    QVector<double> beats;
+    double beatFrame = 1000;
+    for (int i = 0; i < kNumBeats; ++i) {
+        beats.append(beatFrame);
+        beatFrame += 60.0 * kSampleRate / (128.0 + (i % 7) * 0.01);
+    }
+    const BeatMap map(*pTrack, 0, beats);
+
+    // Walk through the track like a playing deck
+    const double lastSample = beatFrame * 2;
+    const double stepSamples = 1024;
+    double position = 0;
+    while (state.KeepRunning()) {
+        query(map, position);
+        position += stepSamples;
+        if (position > lastSample) {
+            position = 0;
+        }
+    }
+}
+
+static void BM_BeatMapFindNthBeat(benchmark::State& state) {
+    runBeatMapBenchmark(state, [](const BeatMap& map, double position) {
+        benchmark::DoNotOptimize(map.findNthBeat(position, 4));
+    });
+}
+BENCHMARK(BM_BeatMapFindNthBeat);
+
+static void BM_BeatMapFindPrevNextBeats(benchmark::State& state) {
+    runBeatMapBenchmark(state, [](const BeatMap& map, double position) {
+        double prevBeat, nextBeat;
+        benchmark::DoNotOptimize(map.findPrevNextBeats(position, &prevBeat, &nextBeat));
+    });
+}
+BENCHMARK(BM_BeatMapFindPrevNextBeats);
+
+static void BM_BeatMapGetBpmAroundPosition(benchmark::State& state) {
+    runBeatMapBenchmark(state, [](const BeatMap& map, double position) {
+        benchmark::DoNotOptimize(map.getBpmAroundPosition(position, 4));
+    });
+}
+BENCHMARK(BM_BeatMapGetBpmAroundPosition);
+
 }  // namespace
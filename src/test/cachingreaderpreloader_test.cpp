@@ -0,0 +1,103 @@
+#include "engine/cachingreader/cachingreaderpreloader.h"
+
+#include <gtest/gtest.h>
+
+#include <QDir>
+
+#include "engine/cachingreader/cachingreaderchunk.h"
+#include "sources/audiosourcestereoproxy.h"
+#include "sources/soundsourceproxy.h"
+#include "test/mixxxtest.h"
+#include "track/track.h"
+
+namespace {
+
+class CachingReaderPreloaderTest : public MixxxTest {
+  protected:
+    TrackPointer createTestTrack() const {
+        const QString kTrackLocationTest = QDir::currentPath() + "/src/test/sine-30.wav";
+        return Track::newTemporary(kTrackLocationTest, SecurityTokenPointer());
+    }
+
+    // Decodes the chunk from a separate audio source like the
+    // CachingReaderWorker does
+    static mixxx::SampleBuffer readChunk(const TrackPointer& pTrack, SINT chunkIndex) {
+        mixxx::AudioSource::OpenParams config;
+        config.setChannelCount(CachingReaderChunk::kChannels);
+        const auto pAudioSource = SoundSourceProxy(pTrack).openAudioSource(config);
+        const auto frameIndexRange =
+                CachingReaderChunk::frameIndexRange(pAudioSource, chunkIndex);
+        mixxx::SampleBuffer samples(
+                CachingReaderChunk::frames2samples(frameIndexRange.length()));
+        mixxx::AudioSourceStereoProxy(pAudioSource, CachingReaderChunk::kFrames)
+                .readSampleFrames(mixxx::WritableSampleFrames(
+                        frameIndexRange,
+                        mixxx::SampleBuffer::WritableSlice(samples)));
+        return samples;
+    }
+
+    CachingReaderPreloader preloader;
+};
+
+TEST_F(CachingReaderPreloaderTest, PreloadChunksAtCue) {
+    const auto pTrack = createTestTrack();
+    const SINT cueFrame = 10 * 44100;
+    pTrack->setCuePoint(CuePosition(cueFrame * CachingReaderChunk::kChannels));
+
+    const auto pPreloadedTrack = CachingReaderPreloader::preloadTrack(pTrack);
+    ASSERT_NE(nullptr, pPreloadedTrack);
+    ASSERT_NE(nullptr, pPreloadedTrack->pAudioSource);
+    EXPECT_EQ(pTrack, pPreloadedTrack->pTrack);
+
+    const SINT cueChunkIndex = CachingReaderChunk::indexForFrame(cueFrame);
+    for (const SINT chunkIndex : {SINT(0), cueChunkIndex}) {
+        const auto chunk = pPreloadedTrack->chunks.find(chunkIndex);
+        ASSERT_NE(pPreloadedTrack->chunks.end(), chunk) << chunkIndex;
+        EXPECT_EQ(CachingReaderChunk::frameIndexRange(
+                          pPreloadedTrack->pAudioSource, chunkIndex),
+                chunk->second.frameIndexRange);
+        const auto expected = readChunk(pTrack, chunkIndex);
+        ASSERT_EQ(expected.size(), chunk->second.samples.size());
+        for (SINT i = 0; i < expected.size(); ++i) {
+            EXPECT_FLOAT_EQ(expected[i], chunk->second.samples[i]) << i;
+        }
+    }
+    // Only the chunks after the cue are decoded
+    EXPECT_EQ(pPreloadedTrack->chunks.end(),
+            pPreloadedTrack->chunks.find(cueChunkIndex - 1));
+}
+
+TEST_F(CachingReaderPreloaderTest, TakeOnlyPreloadedTrack) {
+    const auto pTrack = createTestTrack();
+    const auto pOtherTrack = createTestTrack();
+    EXPECT_EQ(nullptr, preloader.take(pTrack));
+
+    preloader.preload(pTrack);
+    preloader.waitForFinished();
+    EXPECT_EQ(nullptr, preloader.take(pOtherTrack));
+    const auto pPreloadedTrack = preloader.take(pTrack);
+    ASSERT_NE(nullptr, pPreloadedTrack);
+    EXPECT_EQ(pTrack, pPreloadedTrack->pTrack);
+    EXPECT_FALSE(pPreloadedTrack->chunks.empty());
+
+    // The track has been removed from standby
+    EXPECT_EQ(nullptr, preloader.take(pTrack));
+}
+
+TEST_F(CachingReaderPreloaderTest, ClearReleasesStandbyTrack) {
+    const auto pTrack = createTestTrack();
+    preloader.preload(pTrack);
+    preloader.clear();
+    preloader.waitForFinished();
+    EXPECT_EQ(nullptr, preloader.take(pTrack));
+}
+
+TEST_F(CachingReaderPreloaderTest, PreloadMissingFile) {
+    const auto pTrack = Track::newTemporary(
+            QDir::currentPath() + "/src/test/missing.wav", SecurityTokenPointer());
+    preloader.preload(pTrack);
+    preloader.waitForFinished();
+    EXPECT_EQ(nullptr, preloader.take(pTrack));
+}
+
+} // namespace
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include "control/controlchangecoalescer.h"
+#include "control/controlobject.h"
+#include "control/controlproxy.h"
+#include "test/mixxxtest.h"
+#include "util/memory.h"
+
+namespace {
+
+class CountingSubscriber : public CoalescedControlSubscriber {
+  public:
+    explicit CountingSubscriber(ControlProxy* pProxy)
+            : m_pProxy(pProxy),
+              m_deliveries(0),
+              m_lastValue(0.0) {
+    }
+
+    void deliverCoalescedChange() override {
+        ++m_deliveries;
+        m_lastValue = m_pProxy->get();
+    }
+
+    ControlProxy* m_pProxy;
+    int m_deliveries;
+    double m_lastValue;
+};
+
+class ControlChangeCoalescerTest : public MixxxTest {
+  protected:
+    void SetUp() override {
+        m_pControl = std::make_unique<ControlObject>(ConfigKey("[Test]", "coalesced"));
+        m_pProxy = std::make_unique<ControlProxy>(ConfigKey("[Test]", "coalesced"));
+        m_pSubscriber = std::make_unique<CountingSubscriber>(m_pProxy.get());
+        m_index = coalescer().subscribe(m_pSubscriber.get());
+        ASSERT_NE(ControlChangeCoalescer::kInvalidIndex, m_index);
+        ASSERT_TRUE(m_pProxy->connectValueChangedCoalesced(m_index));
+        // Discard changes of previous tests
+        coalescer().flush();
+    }
+
+    void TearDown() override {
+        coalescer().unsubscribe(m_index);
+    }
+
+    static ControlChangeCoalescer& coalescer() {
+        return ControlChangeCoalescer::instance();
+    }
+
+    std::unique_ptr<ControlObject> m_pControl;
+    std::unique_ptr<ControlProxy> m_pProxy;
+    std::unique_ptr<CountingSubscriber> m_pSubscriber;
+    int m_index;
+};
+
+TEST_F(ControlChangeCoalescerTest, DeliversLatestValueOnce) {
+    for (int i = 1; i <= 1000; ++i) {
+        m_pControl->set(i);
+    }
+    EXPECT_EQ(0, m_pSubscriber->m_deliveries);
+
+    EXPECT_EQ(1, coalescer().flush());
+    EXPECT_EQ(1, m_pSubscriber->m_deliveries);
+    EXPECT_DOUBLE_EQ(1000.0, m_pSubscriber->m_lastValue);
+
+    // Nothing has changed since the last frame
+    EXPECT_EQ(0, coalescer().flush());
+    EXPECT_EQ(1, m_pSubscriber->m_deliveries);
+}
+
+TEST_F(ControlChangeCoalescerTest, IgnoresOwnChanges) {
+    m_pProxy->set(5.0);
+    EXPECT_EQ(0, coalescer().flush());
+    EXPECT_EQ(0, m_pSubscriber->m_deliveries);
+}
+
+TEST_F(ControlChangeCoalescerTest, NoDeliveryAfterUnsubscribe) {
+    m_pControl->set(1.0);
+    coalescer().unsubscribe(m_index);
+    EXPECT_EQ(0, coalescer().flush());
+    EXPECT_EQ(0, m_pSubscriber->m_deliveries);
+    // Reuses the free index
+    EXPECT_EQ(m_index, coalescer().subscribe(m_pSubscriber.get()));
+}
+
+TEST_F(ControlChangeCoalescerTest, ReusesIndices) {
+    const int count = coalescer().subscriberCount();
+    CountingSubscriber other(m_pProxy.get());
+    const int index = coalescer().subscribe(&other);
+    EXPECT_EQ(count + 1, coalescer().subscriberCount());
+    coalescer().unsubscribe(index);
+    EXPECT_EQ(count, coalescer().subscriberCount());
+    EXPECT_EQ(index, coalescer().subscribe(&other));
+    coalescer().unsubscribe(index);
+}
+
+} // namespace
@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+
+#include "controllers/controlleroutputqueue.h"
+
+namespace {
+
+class ControllerOutputQueueTest : public testing::Test {
+  protected:
+    static QByteArray message(char value) {
+        return QByteArray(1, value);
+    }
+
+    static mixxx::Duration millis(qint64 millis) {
+        return mixxx::Duration::fromMillis(millis);
+    }
+};
+
+TEST_F(ControllerOutputQueueTest, CoalescesMessagesWithSameKey) {
+    ControllerOutputQueue queue;
+    queue.enqueue(1, message(1));
+    queue.enqueue(2, message(2));
+    queue.enqueue(1, message(3));
+
+    const auto messages = queue.takeReady(millis(10));
+    ASSERT_EQ(2, messages.size());
+    // In the order in which the keys were first queued
+    EXPECT_EQ(1u, messages[0].key);
+    EXPECT_EQ(message(3), messages[0].data);
+    EXPECT_EQ(2u, messages[1].key);
+    EXPECT_EQ(message(2), messages[1].data);
+    EXPECT_TRUE(queue.isEmpty());
+
+    EXPECT_EQ(2u, queue.sentCount());
+    EXPECT_EQ(1u, queue.suppressedCount());
+}
+
+TEST_F(ControllerOutputQueueTest, SuppressesUnchangedMessages) {
+    ControllerOutputQueue queue;
+    queue.enqueue(1, message(1));
+    EXPECT_EQ(1, queue.takeReady(millis(10)).size());
+
+    queue.enqueue(1, message(1));
+    EXPECT_TRUE(queue.isEmpty());
+
+    // Changed and changed back before the flush
+    queue.enqueue(1, message(2));
+    queue.enqueue(1, message(1));
+    EXPECT_TRUE(queue.takeReady(millis(20)).isEmpty());
+
+    EXPECT_EQ(1u, queue.sentCount());
+    EXPECT_EQ(3u, queue.suppressedCount());
+}
+
+TEST_F(ControllerOutputQueueTest, RecordsUnqueuedMessages) {
+    ControllerOutputQueue queue;
+    queue.enqueue(1, message(1));
+    EXPECT_EQ(1, queue.takeReady(millis(10)).size());
+
+    // A script turned it off without the queue
+    queue.recordSent(1, message(0));
+    // So turning it on again must not be suppressed
+    queue.enqueue(1, message(1));
+    const auto messages = queue.takeReady(millis(20));
+    ASSERT_EQ(1, messages.size());
+    EXPECT_EQ(message(1), messages.first().data);
+}
+
+TEST_F(ControllerOutputQueueTest, UnqueuedMessageReplacesPendingMessage) {
+    ControllerOutputQueue queue;
+    queue.enqueue(1, message(1));
+    queue.enqueue(2, message(2));
+    queue.recordSent(1, message(0));
+
+    // The pending message is older than the one that has been sent
+    const auto messages = queue.takeReady(millis(10));
+    ASSERT_EQ(1, messages.size());
+    EXPECT_EQ(2u, messages.first().key);
+    EXPECT_TRUE(queue.isEmpty());
+
+    // The sent message is known
+    queue.enqueue(1, message(0));
+    EXPECT_TRUE(queue.isEmpty());
+}
+
+TEST_F(ControllerOutputQueueTest, CountsPerQueue) {
+    ControllerOutputQueue queue;
+    ControllerOutputQueue otherQueue;
+    queue.enqueue(1, message(1));
+    queue.takeReady(millis(10));
+    EXPECT_EQ(1u, queue.sentCount());
+    EXPECT_EQ(0u, otherQueue.sentCount());
+}
+
+TEST_F(ControllerOutputQueueTest, ClearForgetsSentMessages) {
+    ControllerOutputQueue queue;
+    queue.enqueue(1, message(1));
+    queue.takeReady(millis(10));
+    queue.enqueue(2, message(2));
+
+    queue.clear();
+    EXPECT_TRUE(queue.isEmpty());
+    queue.enqueue(1, message(1));
+    EXPECT_EQ(1, queue.takeReady(millis(20)).size());
+}
+
+TEST_F(ControllerOutputQueueTest, LimitsRate) {
+    ControllerOutputQueue queue;
+    // Allows bursts of 10 messages
+    queue.setMaxRate(100);
+    for (int i = 0; i < 30; ++i) {
+        queue.enqueue(i, message(1));
+    }
+
+    auto messages = queue.takeReady(millis(1000));
+    ASSERT_EQ(10, messages.size());
+    EXPECT_EQ(0u, messages.first().key);
+    EXPECT_FALSE(queue.isEmpty());
+
+    // 5 messages per 50 ms
+    messages = queue.takeReady(millis(1050));
+    ASSERT_EQ(5, messages.size());
+    EXPECT_EQ(10u, messages.first().key);
+
+    // A pending message is still coalesced
+    queue.enqueue(29, message(2));
+    messages = queue.takeReady(millis(2000));
+    ASSERT_EQ(10, messages.size());
+    EXPECT_EQ(15u, messages.first().key);
+    messages = queue.takeReady(millis(3000));
+    ASSERT_EQ(5, messages.size());
+    EXPECT_EQ(29u, messages.last().key);
+    EXPECT_EQ(message(2), messages.last().data);
+    EXPECT_TRUE(queue.isEmpty());
+}
+
+TEST_F(ControllerOutputQueueTest, TakeAllIgnoresRate) {
+    ControllerOutputQueue queue;
+    queue.setMaxRate(100);
+    for (int i = 0; i < 30; ++i) {
+        queue.enqueue(i, message(1));
+    }
+    ASSERT_EQ(10, queue.takeReady(millis(1000)).size());
+
+    // Unchanged messages are still suppressed
+    queue.enqueue(0, message(1));
+    const auto messages = queue.takeAll();
+    ASSERT_EQ(20, messages.size());
+    EXPECT_EQ(10u, messages.first().key);
+    EXPECT_TRUE(queue.isEmpty());
+}
+
+} // anonymous namespace
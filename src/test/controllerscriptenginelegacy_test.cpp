@@ -1,10 +1,13 @@
 #include "controllers/scripting/legacy/controllerscriptenginelegacy.h"
 
+#include <benchmark/benchmark.h>
+
 #include <QScopedPointer>
 #include <QTemporaryFile>
 #include <QThread>
 #include <QtDebug>
 #include <memory>
+#include <vector>
 
 #include "control/controlobject.h"
 #include "control/controlpotmeter.h"
@@ -258,6 +261,79 @@ TEST_F(ControllerScriptEngineLegacyTest, reset) {
     EXPECT_DOUBLE_EQ(0.0, co->get());
 }
 
+TEST_F(ControllerScriptEngineLegacyTest, getControl) {
+    auto co = std::make_unique<ControlPotmeter>(ConfigKey("[Test]", "co"),
+            -10.0,
+            10.0);
+    EXPECT_TRUE(evaluateAndAssert(
+            "var control = engine.getControl('[Test]', 'co');"
+            "control.set(5.0);"));
+    EXPECT_DOUBLE_EQ(5.0, co->get());
+    EXPECT_DOUBLE_EQ(5.0, evaluate("control.get();").toNumber());
+    EXPECT_DOUBLE_EQ(0.75, evaluate("control.getParameter();").toNumber());
+
+    EXPECT_TRUE(evaluateAndAssert("control.setParameter(0.25);"));
+    EXPECT_DOUBLE_EQ(-5.0, co->get());
+    EXPECT_TRUE(evaluateAndAssert("control.set(NaN);"));
+    EXPECT_DOUBLE_EQ(-5.0, co->get());
+    EXPECT_TRUE(evaluateAndAssert("control.reset();"));
+    EXPECT_DOUBLE_EQ(0.0, co->get());
+
+    EXPECT_EQ("[Test]", evaluate("control.group;").toString());
+    EXPECT_EQ("co", evaluate("control.name;").toString());
+    EXPECT_TRUE(evaluate("control === engine.getControl('[Test]', 'co');").toBool());
+}
+
+TEST_F(ControllerScriptEngineLegacyTest, getControl_InvalidControl) {
+    EXPECT_TRUE(evaluate("engine.getControl('[Nothing]', 'nothing');").isUndefined());
+}
+
+TEST_F(ControllerScriptEngineLegacyTest, getControl_softTakeover) {
+    auto co = std::make_unique<ControlPotmeter>(ConfigKey("[Test]", "co"),
+            -10.0,
+            10.0);
+    co->setParameter(0.0);
+    EXPECT_TRUE(evaluateAndAssert(
+            "engine.softTakeover('[Test]', 'co', true);"
+            "var control = engine.getControl('[Test]', 'co');"
+            "control.set(0.0);"));
+    // The first set after enabling is always ignored.
+    EXPECT_DOUBLE_EQ(-10.0, co->get());
+
+    // Advance time to 2x the threshold.
+    mixxx::Time::setTestElapsedTime(SoftTakeover::TestAccess::getTimeThreshold() * 2);
+
+    // Change the control internally (putting it out of sync with the
+    // ControllerEngine).
+    co->setParameter(0.5);
+
+    // Ignore the change since it occurred after the threshold and is too large.
+    EXPECT_TRUE(evaluateAndAssert("control.set(-10.0);"));
+    EXPECT_DOUBLE_EQ(0.0, co->get());
+}
+
+TEST_F(ControllerScriptEngineLegacyTest, setValues) {
+    auto co1 = std::make_unique<ControlObject>(ConfigKey("[Test]", "co1"));
+    auto co2 = std::make_unique<ControlObject>(ConfigKey("[Test]", "co2"));
+    EXPECT_TRUE(evaluateAndAssert(
+            "var controls = ["
+            "  engine.getControl('[Test]', 'co1'),"
+            "  engine.getControl('[Test]', 'co2'),"
+            "];"
+            "engine.setValues(controls, [1.0, 2.0]);"));
+    EXPECT_DOUBLE_EQ(1.0, co1->get());
+    EXPECT_DOUBLE_EQ(2.0, co2->get());
+
+    // Mismatching arrays are rejected without setting anything
+    EXPECT_FALSE(evaluateAndAssert("engine.setValues(controls, [3.0]);"));
+    EXPECT_FALSE(evaluateAndAssert("engine.setValues(['[Test]', 'co1'], [3.0, 4.0]);"));
+    // Also if the invalid element follows a valid control
+    EXPECT_FALSE(evaluateAndAssert(
+            "engine.setValues([engine.getControl('[Test]', 'co1'), 'x'], [3.0, 4.0]);"));
+    EXPECT_DOUBLE_EQ(1.0, co1->get());
+    EXPECT_DOUBLE_EQ(2.0, co2->get());
+}
+
 TEST_F(ControllerScriptEngineLegacyTest, log) {
     EXPECT_TRUE(evaluateAndAssert("engine.log('Test that logging works.');"));
 }
@@ -631,3 +707,66 @@ TEST_F(ControllerScriptEngineLegacyTest, connectionExecutesWithCorrectThisObject
     // The counter should have been incremented exactly once.
     EXPECT_DOUBLE_EQ(1.0, pass->get());
 }
+
+namespace {
+
+// The LEDs of 16 pads on 4 decks, which a mapping may update on every frame
+constexpr int kPadLedCount = 64;
+
+// Runs the function that the script evaluates to with kPadLedCount controls
+// named [PadN],led
+void runPadLedBenchmark(benchmark::State& state, const QString& script) {
+    ControllerDebug::setTesting(true);
+    ControllerScriptEngineLegacy engine(nullptr);
+    engine.initialize();
+    std::vector<std::unique_ptr<ControlObject>> controls;
+    for (int i = 0; i < kPadLedCount; ++i) {
+        controls.push_back(std::make_unique<ControlObject>(
+                ConfigKey(QStringLiteral("[Pad%1]").arg(i), "led")));
+    }
+    engine.jsEngine()->globalObject().setProperty("padLedCount", kPadLedCount);
+    QJSValue update = engine.jsEngine()->evaluate(script);
+    while (state.KeepRunning()) {
+        update.call();
+    }
+}
+
+void BM_ScriptSetValueByName(benchmark::State& state) {
+    runPadLedBenchmark(state,
+            "(function () {"
+            "  for (var i = 0; i < padLedCount; ++i) {"
+            "    engine.setValue('[Pad' + i + ']', 'led', i);"
+            "  }"
+            "})");
+}
+BENCHMARK(BM_ScriptSetValueByName);
+
+void BM_ScriptSetValueByControl(benchmark::State& state) {
+    runPadLedBenchmark(state,
+            "var leds = [];"
+            "for (var i = 0; i < padLedCount; ++i) {"
+            "  leds.push(engine.getControl('[Pad' + i + ']', 'led'));"
+            "}"
+            "(function () {"
+            "  for (var i = 0; i < leds.length; ++i) {"
+            "    leds[i].set(i);"
+            "  }"
+            "})");
+}
+BENCHMARK(BM_ScriptSetValueByControl);
+
+void BM_ScriptSetValues(benchmark::State& state) {
+    runPadLedBenchmark(state,
+            "var leds = [];"
+            "var values = [];"
+            "for (var i = 0; i < padLedCount; ++i) {"
+            "  leds.push(engine.getControl('[Pad' + i + ']', 'led'));"
+            "  values.push(i);"
+            "}"
+            "(function () {"
+            "  engine.setValues(leds, values);"
+            "})");
+}
+BENCHMARK(BM_ScriptSetValues);
+
+} // anonymous namespace
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include "controllers/scripting/controllerscriptwatchdog.h"
+#include "util/time.h"
+
+namespace {
+
+class ControllerScriptWatchdogTest : public testing::Test {
+  protected:
+    void SetUp() override {
+        mixxx::Time::setTestMode(true);
+        mixxx::Time::setTestElapsedTime(mixxx::Duration::fromMillis(100));
+        watchdog().setTimeBudget(mixxx::Duration::fromMillis(20));
+    }
+
+    void TearDown() override {
+        watchdog().setTimeBudget(ControllerScriptWatchdog::kDefaultTimeBudget);
+        mixxx::Time::setTestMode(false);
+    }
+
+    static ControllerScriptWatchdog& watchdog() {
+        return ControllerScriptWatchdog::instance();
+    }
+
+    static void advance(qint64 millis) {
+        mixxx::Time::setTestElapsedTime(
+                mixxx::Time::elapsed() + mixxx::Duration::fromMillis(millis));
+    }
+};
+
+TEST_F(ControllerScriptWatchdogTest, CallWithinBudget) {
+    ControllerScriptWatchdog::Entry entry("Test");
+    const int exceeded = watchdog().exceededCount();
+    {
+        ControllerScriptWatchdog::Scope scope(&entry);
+        advance(10);
+        EXPECT_EQ(0, watchdog().check());
+    }
+    EXPECT_EQ(exceeded, watchdog().exceededCount());
+}
+
+TEST_F(ControllerScriptWatchdogTest, CallExceedingBudget) {
+    ControllerScriptWatchdog::Entry entry("Test");
+    const int exceeded = watchdog().exceededCount();
+    {
+        ControllerScriptWatchdog::Scope scope(&entry);
+        advance(30);
+    }
+    EXPECT_EQ(exceeded + 1, watchdog().exceededCount());
+    // Not running anymore
+    EXPECT_EQ(0, watchdog().check());
+}
+
+TEST_F(ControllerScriptWatchdogTest, RunningCallIsReportedOnce) {
+    ControllerScriptWatchdog::Entry entry("Test");
+    const int exceeded = watchdog().exceededCount();
+    {
+        ControllerScriptWatchdog::Scope scope(&entry);
+        advance(30);
+        EXPECT_EQ(1, watchdog().check());
+        advance(30);
+        EXPECT_EQ(0, watchdog().check());
+    }
+    EXPECT_EQ(exceeded + 1, watchdog().exceededCount());
+}
+
+TEST_F(ControllerScriptWatchdogTest, NestedCallsAreTimedAsOne) {
+    ControllerScriptWatchdog::Entry entry("Test");
+    const int exceeded = watchdog().exceededCount();
+    {
+        ControllerScriptWatchdog::Scope outerScope(&entry);
+        advance(15);
+        {
+            ControllerScriptWatchdog::Scope innerScope(&entry);
+            advance(1);
+        }
+        EXPECT_EQ(exceeded, watchdog().exceededCount());
+        advance(15);
+    }
+    EXPECT_EQ(exceeded + 1, watchdog().exceededCount());
+}
+
+} // anonymous namespace
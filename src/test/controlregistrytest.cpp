@@ -0,0 +1,175 @@
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+#include <QtDebug>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "control/control.h"
+#include "control/controlobject.h"
+#include "control/controlregistry.h"
+#include "test/mixxxtest.h"
+#include "util/memory.h"
+
+namespace {
+
+class ControlRegistryTest : public MixxxTest {
+};
+
+TEST_F(ControlRegistryTest, LookupByHandle) {
+    const ConfigKey key("[Test]", "registry");
+    EXPECT_EQ(kInvalidControlHandle,
+            ControlDoublePrivate::getHandle(ConfigKey("[Test]", "never_created")));
+
+    auto pControl = std::make_unique<ControlObject>(key);
+    const ControlHandle handle = ControlDoublePrivate::getHandle(key);
+    ASSERT_NE(kInvalidControlHandle, handle);
+
+    const auto pPrivate = ControlDoublePrivate::getControl(handle);
+    ASSERT_TRUE(pPrivate);
+    EXPECT_EQ(pControl.get(), pPrivate->getCreatorCO());
+    EXPECT_EQ(pPrivate, ControlDoublePrivate::getControl(key));
+}
+
+TEST_F(ControlRegistryTest, HandleIsStableWhenControlIsRecreated) {
+    const ConfigKey key("[Test]", "recreated");
+    auto pControl = std::make_unique<ControlObject>(key);
+    const ControlHandle handle = ControlDoublePrivate::getHandle(key);
+
+    pControl.reset();
+    EXPECT_FALSE(ControlDoublePrivate::getControl(handle));
+    EXPECT_EQ(handle, ControlDoublePrivate::getHandle(key));
+
+    pControl = std::make_unique<ControlObject>(key);
+    EXPECT_EQ(handle, ControlDoublePrivate::getHandle(key));
+    const auto pPrivate = ControlDoublePrivate::getControl(handle);
+    ASSERT_TRUE(pPrivate);
+    EXPECT_EQ(pControl.get(), pPrivate->getCreatorCO());
+}
+
+TEST_F(ControlRegistryTest, AliasHasOwnHandle) {
+    const ConfigKey key("[Microphone1]", "registry_volume");
+    const ConfigKey alias("[Microphone]", "registry_volume");
+    auto pControl = std::make_unique<ControlObject>(key);
+    ControlDoublePrivate::insertAlias(alias, key);
+
+    const ControlHandle handle = ControlDoublePrivate::getHandle(key);
+    const ControlHandle aliasHandle = ControlDoublePrivate::getHandle(alias);
+    ASSERT_NE(kInvalidControlHandle, aliasHandle);
+    EXPECT_NE(handle, aliasHandle);
+    EXPECT_EQ(ControlDoublePrivate::getControl(handle),
+            ControlDoublePrivate::getControl(aliasHandle));
+}
+
+TEST_F(ControlRegistryTest, ManyControls) {
+    // Enough controls to grow the hash index several times
+    const int kCount = 20000;
+    std::vector<std::unique_ptr<ControlObject>> controls;
+    controls.reserve(kCount);
+    for (int i = 0; i < kCount; ++i) {
+        controls.push_back(std::make_unique<ControlObject>(
+                ConfigKey(QStringLiteral("[Many%1]").arg(i % 100),
+                        QStringLiteral("control%1").arg(i))));
+    }
+    for (int i = 0; i < kCount; ++i) {
+        const ConfigKey& key = controls[i]->getKey();
+        const ControlHandle handle = ControlDoublePrivate::getHandle(key);
+        ASSERT_NE(kInvalidControlHandle, handle);
+        const auto pPrivate = ControlDoublePrivate::getControl(handle);
+        ASSERT_TRUE(pPrivate);
+        EXPECT_EQ(controls[i].get(), pPrivate->getCreatorCO());
+    }
+}
+
+TEST_F(ControlRegistryTest, ConcurrentLookupsWhileCreating) {
+    const ConfigKey key("[Test]", "concurrent");
+    auto pControl = std::make_unique<ControlObject>(key);
+
+    std::atomic<bool> done(false);
+    std::atomic<int> failures(0);
+    std::thread reader([&] {
+        while (!done.load()) {
+            const auto pPrivate = ControlDoublePrivate::getControl(key);
+            if (!pPrivate || pPrivate->getCreatorCO() != pControl.get()) {
+                failures.fetch_add(1);
+            }
+        }
+    });
+
+    // Growing the registry must not disturb readers
+    std::vector<std::unique_ptr<ControlObject>> controls;
+    for (int i = 0; i < 10000; ++i) {
+        controls.push_back(std::make_unique<ControlObject>(
+                ConfigKey("[Concurrent]", QStringLiteral("control%1").arg(i))));
+    }
+    done.store(true);
+    reader.join();
+    EXPECT_EQ(0, failures.load());
+}
+
+TEST_F(ControlRegistryTest, ReclaimsRetiredMemory) {
+    ControlRegistry registry;
+    const ConfigKey key("[Test]", "reclaimed");
+    // Replacing the record of a key over and over again, like a control
+    // that is deleted and created again, must not accumulate memory.
+    for (int i = 0; i < 1000; ++i) {
+        registry.insert(key, QSharedPointer<ControlDoublePrivate>());
+    }
+    // Enough keys to replace the hash index several times
+    for (int i = 0; i < 10000; ++i) {
+        registry.insert(ConfigKey("[Reclaimed]", QStringLiteral("control%1").arg(i)),
+                QSharedPointer<ControlDoublePrivate>());
+    }
+    EXPECT_EQ(0, registry.retiredCount());
+}
+
+TEST_F(ControlRegistryTest, ReclaimsRetiredMemoryAfterConcurrentLookups) {
+    ControlRegistry registry;
+    const ConfigKey key("[Test]", "reclaimed");
+    registry.insert(key, QSharedPointer<ControlDoublePrivate>());
+
+    std::atomic<bool> done(false);
+    std::atomic<int> failures(0);
+    std::thread reader([&] {
+        while (!done.load()) {
+            if (registry.findHandle(key) == kInvalidControlHandle ||
+                    registry.lookup(key)) {
+                failures.fetch_add(1);
+            }
+        }
+    });
+    for (int i = 0; i < 10000; ++i) {
+        registry.insert(key, QSharedPointer<ControlDoublePrivate>());
+    }
+    done.store(true);
+    reader.join();
+    EXPECT_EQ(0, failures.load());
+
+    // The next write after the reader has finished releases everything
+    registry.insert(key, QSharedPointer<ControlDoublePrivate>());
+    EXPECT_EQ(0, registry.retiredCount());
+}
+
+static void BM_ControlLookupByKey(benchmark::State& state) {
+    const ConfigKey key("[Channel1]", "benchmark_lookup");
+    ControlObject control(key);
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(ControlDoublePrivate::getControl(
+                ConfigKey(QStringLiteral("[Channel1]"),
+                        QStringLiteral("benchmark_lookup"))));
+    }
+}
+BENCHMARK(BM_ControlLookupByKey);
+
+static void BM_ControlLookupByHandle(benchmark::State& state) {
+    const ConfigKey key("[Channel1]", "benchmark_lookup");
+    ControlObject control(key);
+    const ControlHandle handle = ControlDoublePrivate::getHandle(key);
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(ControlDoublePrivate::getControl(handle));
+    }
+}
+BENCHMARK(BM_ControlLookupByHandle);
+
+} // namespace
@@ -0,0 +1,90 @@
+#include "util/cpuloadmeter.h"
+
+#include <gtest/gtest.h>
+
+#include <QThread>
+
+namespace {
+
+// The meters are sampled every 50 ms by the GUI tick
+constexpr qint64 kSamplePeriodNanos = 50 * 1000 * 1000;
+
+qint64 busyNanos(double load) {
+    return static_cast<qint64>(load * kSamplePeriodNanos);
+}
+
+class CpuLoadMeterTest : public ::testing::Test {
+  protected:
+    mixxx::CpuLoadMeter meter;
+};
+
+TEST_F(CpuLoadMeterTest, SmoothBusyAndIdleSequence) {
+    // The smoothed load approaches a constant load exponentially with the
+    // smoothing factor 0.3 of the most recent sample period.
+    double expectedLoad = 0.0;
+    for (int i = 0; i < 10; ++i) {
+        expectedLoad += 0.3 * (0.5 - expectedLoad);
+        EXPECT_NEAR(expectedLoad,
+                meter.updateLoad(busyNanos(0.5), kSamplePeriodNanos),
+                1e-9);
+        EXPECT_FALSE(meter.isOverloaded());
+    }
+    EXPECT_NEAR(0.5, expectedLoad, 0.02);
+
+    // Idle periods let the load decay towards zero
+    for (int i = 0; i < 10; ++i) {
+        expectedLoad *= 0.7;
+        EXPECT_NEAR(expectedLoad,
+                meter.updateLoad(0, kSamplePeriodNanos),
+                1e-9);
+        EXPECT_FALSE(meter.isOverloaded());
+    }
+    EXPECT_LT(expectedLoad, 0.02);
+}
+
+TEST_F(CpuLoadMeterTest, ReportSingleOverload) {
+    meter.updateLoad(busyNanos(0.1), kSamplePeriodNanos);
+    EXPECT_FALSE(meter.isOverloaded());
+
+    // A single period that exceeds the budget is reported immediately
+    // although the smoothed load stays below the threshold.
+    const double load = meter.updateLoad(busyNanos(0.95), kSamplePeriodNanos);
+    EXPECT_TRUE(meter.isOverloaded());
+    EXPECT_LT(load, mixxx::CpuLoadMeter::kOverloadThreshold);
+
+    meter.updateLoad(busyNanos(0.1), kSamplePeriodNanos);
+    EXPECT_FALSE(meter.isOverloaded());
+}
+
+TEST_F(CpuLoadMeterTest, ClampLoad) {
+    // Preemption within the section might count more busy time
+    // than wall clock time that passed between the samples
+    double load = 0.0;
+    for (int i = 0; i < 50; ++i) {
+        load = meter.updateLoad(2 * kSamplePeriodNanos, kSamplePeriodNanos);
+    }
+    EXPECT_NEAR(1.0, load, 1e-6);
+    EXPECT_LE(load, 1.0);
+    EXPECT_TRUE(meter.isOverloaded());
+
+    // Empty sample periods don't change the load
+    EXPECT_DOUBLE_EQ(load, meter.updateLoad(0, 0));
+}
+
+TEST_F(CpuLoadMeterTest, MeasureSection) {
+    meter.sampleLoad();
+    for (int i = 0; i < 3; ++i) {
+        meter.start();
+        QThread::msleep(20);
+        meter.stop();
+        QThread::msleep(20);
+    }
+    // The smoothed load of the first sample period is 0.3 * 0.5. Only
+    // check for a far lower bound to tolerate scheduling delays on
+    // loaded machines.
+    const double load = meter.sampleLoad();
+    EXPECT_GT(load, 0.05);
+    EXPECT_LE(load, 1.0);
+}
+
+} // namespace
@@ -0,0 +1,148 @@
+#include "library/duplicates/duplicatefinder.h"
+
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t kFingerprintLength = DuplicateFinder::kComparedFingerprintLength;
+
+class DuplicateFinderTest : public testing::Test {
+  protected:
+    DuplicateFinderTest()
+            : m_random(42) {
+    }
+
+    std::vector<quint32> randomFingerprint() {
+        std::vector<quint32> fingerprint(kFingerprintLength);
+        for (auto& subFingerprint : fingerprint) {
+            subFingerprint = m_random();
+        }
+        return fingerprint;
+    }
+
+    // Simulates a different encoding of the same recording by flipping
+    // random bits and skipping some leading sub-fingerprints.
+    std::vector<quint32> reencoded(const std::vector<quint32>& fingerprint,
+            double bitErrorRate,
+            int offset) {
+        std::bernoulli_distribution flipBit(bitErrorRate);
+        std::vector<quint32> result;
+        for (std::size_t i = offset; i < fingerprint.size(); ++i) {
+            quint32 subFingerprint = fingerprint[i];
+            for (int bit = 0; bit < 32; ++bit) {
+                if (flipBit(m_random)) {
+                    subFingerprint ^= 1u << bit;
+                }
+            }
+            result.push_back(subFingerprint);
+        }
+        return result;
+    }
+
+    void addCandidate(std::vector<quint32> fingerprint,
+            double durationSeconds,
+            const QString& artist = QString(),
+            const QString& title = QString()) {
+        DuplicateCandidate candidate;
+        candidate.trackId = TrackId(static_cast<int>(m_candidates.size()) + 1);
+        candidate.durationSeconds = durationSeconds;
+        candidate.artist = artist;
+        candidate.title = title;
+        candidate.fingerprint = std::move(fingerprint);
+        m_candidates.push_back(std::move(candidate));
+    }
+
+    std::vector<std::vector<int>> findDuplicates() const {
+        return DuplicateFinder().findDuplicates(m_candidates);
+    }
+
+    std::mt19937 m_random;
+    std::vector<DuplicateCandidate> m_candidates;
+};
+
+TEST_F(DuplicateFinderTest, FingerprintSimilarity) {
+    const auto fingerprint = randomFingerprint();
+    EXPECT_DOUBLE_EQ(1.0,
+            DuplicateFinder::fingerprintSimilarity(fingerprint, fingerprint, 0));
+
+    const auto shifted = reencoded(fingerprint, 0.0, 5);
+    EXPECT_DOUBLE_EQ(1.0,
+            DuplicateFinder::fingerprintSimilarity(fingerprint, shifted, 8));
+    EXPECT_GT(0.6,
+            DuplicateFinder::fingerprintSimilarity(fingerprint, shifted, 4));
+
+    EXPECT_GT(0.6,
+            DuplicateFinder::fingerprintSimilarity(
+                    fingerprint, randomFingerprint(), 16));
+    EXPECT_DOUBLE_EQ(0.0,
+            DuplicateFinder::fingerprintSimilarity(
+                    fingerprint, std::vector<quint32>(), 16));
+}
+
+TEST_F(DuplicateFinderTest, FindsReencodedDuplicates) {
+    for (int i = 0; i < 100; ++i) {
+        addCandidate(randomFingerprint(), 180.0 + i);
+    }
+    const auto original = m_candidates[10].fingerprint;
+    addCandidate(reencoded(original, 0.05, 3), 181.0 + 10);
+    addCandidate(reencoded(original, 0.05, 0), 179.0 + 10);
+    addCandidate(reencoded(m_candidates[50].fingerprint, 0.05, 1), 180.0 + 50);
+
+    const auto groups = findDuplicates();
+    ASSERT_EQ(2u, groups.size());
+    EXPECT_EQ((std::vector<int>{10, 100, 101}), groups[0]);
+    EXPECT_EQ((std::vector<int>{50, 102}), groups[1]);
+}
+
+TEST_F(DuplicateFinderTest, DurationMustMatch) {
+    const auto fingerprint = randomFingerprint();
+    addCandidate(fingerprint, 180.0);
+    // e.g. the radio edit of an extended mix
+    addCandidate(reencoded(fingerprint, 0.02, 0), 240.0);
+
+    EXPECT_TRUE(findDuplicates().empty());
+}
+
+TEST_F(DuplicateFinderTest, MetadataWithoutFingerprint) {
+    addCandidate(randomFingerprint(), 200.0, "Artist", "Title");
+    addCandidate({}, 201.0, " artist", "TITLE ");
+    addCandidate({}, 200.0, "Artist", "Title (Extended Mix)");
+    addCandidate({}, 400.0, "Artist", "Title");
+
+    const auto groups = findDuplicates();
+    ASSERT_EQ(1u, groups.size());
+    EXPECT_EQ((std::vector<int>{0, 1}), groups[0]);
+}
+
+TEST_F(DuplicateFinderTest, FingerprintsTakePrecedenceOverMetadata) {
+    // Different recordings with the same metadata, e.g. a live version
+    addCandidate(randomFingerprint(), 200.0, "Artist", "Title");
+    addCandidate(randomFingerprint(), 200.0, "Artist", "Title");
+
+    EXPECT_TRUE(findDuplicates().empty());
+}
+
+static void BM_FindDuplicates(benchmark::State& state) {
+    std::mt19937 random(42);
+    std::vector<DuplicateCandidate> candidates(state.range(0));
+    for (std::size_t i = 0; i < candidates.size(); ++i) {
+        candidates[i].trackId = TrackId(static_cast<int>(i) + 1);
+        candidates[i].durationSeconds = 120.0 + i % 300;
+        candidates[i].fingerprint.resize(kFingerprintLength);
+        for (auto& subFingerprint : candidates[i].fingerprint) {
+            subFingerprint = random();
+        }
+    }
+    const DuplicateFinder finder;
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(finder.findDuplicates(candidates));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FindDuplicates)->Arg(1000)->Arg(10000)->Arg(200000);
+
+} // namespace
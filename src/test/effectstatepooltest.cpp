@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "effects/effectprocessor.h"
+#include "effects/effectstatepool.h"
+
+namespace {
+
+class ClearableState : public EffectState {
+  public:
+    ClearableState(const mixxx::EngineParameters& bufferParameters)
+            : EffectState(bufferParameters),
+              value(0) {
+    }
+
+    void clear() {
+        value = 0;
+    }
+
+    int value;
+};
+
+class ResourceState : public EffectState {
+  public:
+    ResourceState(const mixxx::EngineParameters& bufferParameters)
+            : EffectState(bufferParameters) {
+        acquireResources();
+    }
+
+    void clear() {
+    }
+
+    void releaseResources() {
+        pResource.reset();
+    }
+
+    void acquireResources() {
+        pResource = s_pResource;
+    }
+
+    static std::shared_ptr<int> s_pResource;
+    std::shared_ptr<int> pResource;
+};
+
+std::shared_ptr<int> ResourceState::s_pResource;
+
+class PlainState : public EffectState {
+  public:
+    PlainState(const mixxx::EngineParameters& bufferParameters)
+            : EffectState(bufferParameters) {
+    }
+};
+
+class EffectStatePoolTest : public testing::Test {
+  protected:
+    EffectStatePoolTest()
+            : m_bufferParameters(mixxx::audio::SampleRate(96000), 1024) {
+    }
+
+    const mixxx::EngineParameters m_bufferParameters;
+};
+
+TEST_F(EffectStatePoolTest, RecyclesClearableStates) {
+    auto& pool = EffectStatePool<ClearableState>::instance();
+    const int hits = pool.hits();
+
+    ClearableState* pState = pool.acquire(m_bufferParameters);
+    pState->value = 42;
+    pool.release(pState);
+    EXPECT_EQ(1, pool.size());
+
+    ClearableState* pRecycled = pool.acquire(m_bufferParameters);
+    EXPECT_EQ(pState, pRecycled);
+    EXPECT_EQ(0, pRecycled->value);
+    EXPECT_EQ(hits + 1, pool.hits());
+    EXPECT_EQ(0, pool.size());
+    delete pRecycled;
+}
+
+TEST_F(EffectStatePoolTest, ReleasesResourcesOfPooledStates) {
+    auto& pool = EffectStatePool<ResourceState>::instance();
+    ResourceState::s_pResource = std::make_shared<int>(1);
+    ResourceState* pState = pool.acquire(m_bufferParameters);
+    EXPECT_EQ(ResourceState::s_pResource, pState->pResource);
+
+    pool.release(pState);
+    EXPECT_EQ(nullptr, pState->pResource);
+
+    // The recycled state fetches the current resource
+    ResourceState::s_pResource = std::make_shared<int>(2);
+    ResourceState* pRecycled = pool.acquire(m_bufferParameters);
+    EXPECT_EQ(pState, pRecycled);
+    EXPECT_EQ(ResourceState::s_pResource, pRecycled->pResource);
+    delete pRecycled;
+    ResourceState::s_pResource.reset();
+}
+
+TEST_F(EffectStatePoolTest, DoesNotRecycleOtherStates) {
+    auto& pool = EffectStatePool<PlainState>::instance();
+    EXPECT_FALSE(EffectStatePool<PlainState>::kRecyclable);
+
+    pool.release(pool.acquire(m_bufferParameters));
+    EXPECT_EQ(0, pool.size());
+    EXPECT_EQ(0, pool.hits());
+}
+
+TEST_F(EffectStatePoolTest, LimitsPooledStates) {
+    auto& pool = EffectStatePool<ClearableState>::instance();
+    std::vector<ClearableState*> states;
+    for (int i = 0; i < EffectStatePool<ClearableState>::kMaxPooledStates + 2; ++i) {
+        states.push_back(pool.acquire(m_bufferParameters));
+    }
+    for (ClearableState* pState : states) {
+        pool.release(pState);
+    }
+    EXPECT_EQ(EffectStatePool<ClearableState>::kMaxPooledStates, pool.size());
+}
+
+TEST_F(EffectStatePoolTest, DeletesStatesWithLastProcessor) {
+    auto& pool = EffectStatePool<ClearableState>::instance();
+    pool.addProcessor();
+    pool.addProcessor();
+    pool.release(pool.acquire(m_bufferParameters));
+    ASSERT_LT(0, pool.size());
+
+    pool.removeProcessor();
+    EXPECT_LT(0, pool.size());
+    // The effect has been unloaded everywhere
+    pool.removeProcessor();
+    EXPECT_EQ(0, pool.size());
+}
+
+TEST_F(EffectStatePoolTest, DiscardsStatesWithOtherParameters) {
+    auto& pool = EffectStatePool<ClearableState>::instance();
+    pool.release(pool.acquire(m_bufferParameters));
+    ASSERT_LT(0, pool.size());
+
+    const mixxx::EngineParameters otherParameters(mixxx::audio::SampleRate(44100), 1024);
+    const int misses = pool.misses();
+    ClearableState* pState = pool.acquire(otherParameters);
+    EXPECT_EQ(misses + 1, pool.misses());
+    EXPECT_EQ(0, pool.size());
+    pool.release(pState);
+}
+
+} // namespace
@@ -1,6 +1,12 @@
+#include <benchmark/benchmark.h>
 #include <gtest/gtest.h>
 
+#include <vector>
+
+#include "engine/filters/enginefilterbessel4.h"
+#include "engine/filters/enginefilterbessel8.h"
 #include "engine/filters/enginefilterbiquad1.h"
+#include "engine/filters/enginefilterlinkwitzriley8.h"
 
 namespace {
 
@@ -19,4 +25,58 @@ TEST_F(EngineFilterBiquadTest, fidspecLengthIsLongEnough) {
     ASSERT_TRUE(FIDSPEC_LENGTH > strlen("LsBq/1.2200000000/-12.0000000000"));
 }
 
+TEST_F(EngineFilterBiquadTest, channelsAreIndependent) {
+    // Both channels are processed in parallel, but must not affect each other
+    constexpr int kSamples = 512;
+    std::vector<CSAMPLE> stereo(kSamples);
+    std::vector<CSAMPLE> left(kSamples);
+    std::vector<CSAMPLE> right(kSamples);
+    for (int i = 0; i < kSamples; i += 2) {
+        stereo[i] = left[i] = left[i + 1] = (i % 14) / 7.0f - 1.0f;
+        stereo[i + 1] = right[i] = right[i + 1] = (i % 30) / 15.0f - 1.0f;
+    }
+
+    EngineFilterBiquad1Peaking stereoFilter(44100, 1000, 1.0);
+    EngineFilterBiquad1Peaking leftFilter(44100, 1000, 1.0);
+    EngineFilterBiquad1Peaking rightFilter(44100, 1000, 1.0);
+    for (auto* pFilter : {&stereoFilter, &leftFilter, &rightFilter}) {
+        pFilter->setFrequencyCorners(44100, 1000, 1.0, 6.0);
+        pFilter->assumeSettled();
+    }
+    stereoFilter.process(stereo.data(), stereo.data(), kSamples);
+    leftFilter.process(left.data(), left.data(), kSamples);
+    rightFilter.process(right.data(), right.data(), kSamples);
+
+    for (int i = 0; i < kSamples; i += 2) {
+        EXPECT_FLOAT_EQ(left[i], stereo[i]);
+        EXPECT_FLOAT_EQ(right[i], stereo[i + 1]);
+    }
+}
+
+template<typename Filter>
+static void BM_EngineFilterIIR(benchmark::State& state) {
+    const int samples = static_cast<int>(state.range(0));
+    std::vector<CSAMPLE> buffer(samples, 0.1f);
+    Filter filter(44100, 1000);
+    filter.assumeSettled();
+    while (state.KeepRunning()) {
+        filter.process(buffer.data(), buffer.data(), samples);
+    }
+}
+BENCHMARK_TEMPLATE(BM_EngineFilterIIR, EngineFilterBessel4Low)->Range(64, 4096);
+BENCHMARK_TEMPLATE(BM_EngineFilterIIR, EngineFilterBessel8Low)->Range(64, 4096);
+BENCHMARK_TEMPLATE(BM_EngineFilterIIR, EngineFilterLinkwitzRiley8High)->Range(64, 4096);
+
+static void BM_EngineFilterBiquad1Peaking(benchmark::State& state) {
+    const int samples = static_cast<int>(state.range(0));
+    std::vector<CSAMPLE> buffer(samples, 0.1f);
+    EngineFilterBiquad1Peaking filter(44100, 1000, 1.0);
+    filter.setFrequencyCorners(44100, 1000, 1.0, 6.0);
+    filter.assumeSettled();
+    while (state.KeepRunning()) {
+        filter.process(buffer.data(), buffer.data(), samples);
+    }
+}
+BENCHMARK(BM_EngineFilterBiquad1Peaking)->Range(64, 4096);
+
 } // namespace
@@ -1,7 +1,9 @@
+#include <benchmark/benchmark.h>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include <string>
+#include <vector>
 
 #include "control/controlobject.h"
 #include "engine/controls/bpmcontrol.h"
@@ -2402,8 +2404,8 @@ TEST_F(EngineSyncTest, BeatMapQantizePlay) {
 
     mixxx::BeatsPointer pBeats2 = mixxx::BeatsPointer(new mixxx::BeatMap(*m_pTrack2, 44100));
     // Add two beats at 120 Bpm
-    pBeats2->addBeat(44100 / 2);
-    pBeats2->addBeat(44100);
+    pBeats2 = pBeats2->addBeat(44100 / 2);
+    pBeats2 = pBeats2->addBeat(44100);
     m_pTrack2->setBeats(pBeats2);
 
     ControlObject::set(ConfigKey(m_sGroup1, "quantize"), 1.0);
@@ -2464,3 +2466,167 @@ TEST_F(EngineSyncTest, BpmAdjustFactor) {
     ASSERT_TRUE(isFollower(m_sGroup2));
     ASSERT_TRUE(isSoftMaster(m_sInternalClockGroup));
 }
+
+TEST_F(EngineSyncTest, MasterBeatDistanceDistributedAfterPostProcess) {
+    mixxx::BeatsPointer pBeats1 = BeatFactory::makeBeatGrid(*m_pTrack1, 128, 0.0);
+    m_pTrack1->setBeats(pBeats1);
+    mixxx::BeatsPointer pBeats2 = BeatFactory::makeBeatGrid(*m_pTrack2, 130, 0.0);
+    m_pTrack2->setBeats(pBeats2);
+    mixxx::BeatsPointer pBeats3 = BeatFactory::makeBeatGrid(*m_pTrack3, 120, 0.0);
+    m_pTrack3->setBeats(pBeats3);
+
+    ControlObject::set(ConfigKey(m_sGroup1, "sync_mode"), SYNC_MASTER_EXPLICIT);
+    ControlObject::set(ConfigKey(m_sGroup2, "sync_mode"), SYNC_FOLLOWER);
+    ControlObject::set(ConfigKey(m_sGroup3, "sync_mode"), SYNC_FOLLOWER);
+    ControlObject::set(ConfigKey(m_sGroup1, "play"), 1.0);
+    ControlObject::set(ConfigKey(m_sGroup2, "play"), 1.0);
+    ControlObject::set(ConfigKey(m_sGroup3, "play"), 1.0);
+
+    for (int i = 0; i < 20; ++i) {
+        ProcessBuffer();
+        // The internal clock and all followers receive the beat distance the
+        // master has reached at the end of the callback.
+        const double masterBeatDistance =
+                ControlObject::get(ConfigKey(m_sGroup1, "beat_distance"));
+        ASSERT_DOUBLE_EQ(masterBeatDistance,
+                ControlObject::get(ConfigKey(m_sInternalClockGroup, "beat_distance")));
+        ASSERT_NEAR(masterBeatDistance,
+                ControlObject::get(ConfigKey(m_sGroup2, "beat_distance")),
+                kMaxBeatDistanceEpsilon);
+        ASSERT_NEAR(masterBeatDistance,
+                ControlObject::get(ConfigKey(m_sGroup3, "beat_distance")),
+                kMaxBeatDistanceEpsilon);
+    }
+    EXPECT_GT(ControlObject::get(ConfigKey(m_sGroup1, "beat_distance")), 0.0);
+}
+
+TEST_F(EngineSyncTest, DisabledFollowerIsNotUpdated) {
+    mixxx::BeatsPointer pBeats1 = BeatFactory::makeBeatGrid(*m_pTrack1, 128, 0.0);
+    m_pTrack1->setBeats(pBeats1);
+    mixxx::BeatsPointer pBeats2 = BeatFactory::makeBeatGrid(*m_pTrack2, 130, 0.0);
+    m_pTrack2->setBeats(pBeats2);
+    mixxx::BeatsPointer pBeats3 = BeatFactory::makeBeatGrid(*m_pTrack3, 120, 0.0);
+    m_pTrack3->setBeats(pBeats3);
+
+    ControlObject::set(ConfigKey(m_sGroup1, "sync_mode"), SYNC_MASTER_EXPLICIT);
+    ControlObject::set(ConfigKey(m_sGroup2, "sync_mode"), SYNC_FOLLOWER);
+    ControlObject::set(ConfigKey(m_sGroup3, "sync_mode"), SYNC_FOLLOWER);
+    ControlObject::set(ConfigKey(m_sGroup1, "play"), 1.0);
+    ControlObject::set(ConfigKey(m_sGroup2, "play"), 1.0);
+    ControlObject::set(ConfigKey(m_sGroup3, "play"), 1.0);
+    ProcessBuffer();
+    EXPECT_DOUBLE_EQ(128.0, ControlObject::get(ConfigKey(m_sGroup3, "bpm")));
+
+    // Disabling sync is queued while playing and handled within the callback
+    ControlObject::set(ConfigKey(m_sGroup3, "sync_enabled"), 0.0);
+    ProcessBuffer();
+    assertSyncOff(m_sGroup3);
+
+    ControlObject::set(ConfigKey(m_sGroup1, "rate_ratio"), 1.25);
+    ProcessBuffer();
+    EXPECT_DOUBLE_EQ(160.0, ControlObject::get(ConfigKey(m_sGroup1, "bpm")));
+    EXPECT_DOUBLE_EQ(160.0, ControlObject::get(ConfigKey(m_sGroup2, "bpm")));
+    EXPECT_DOUBLE_EQ(128.0, ControlObject::get(ConfigKey(m_sGroup3, "bpm")));
+}
+
+namespace {
+
+// A minimal Syncable to measure the sync pass without running the decks.
+class BenchmarkSyncable : public Syncable {
+  public:
+    BenchmarkSyncable(const QString& group, SyncMode mode)
+            : m_group(group),
+              m_mode(mode),
+              m_masterBeatDistance(0.0),
+              m_masterBpm(0.0),
+              m_instantaneousBpm(0.0) {
+    }
+
+    const QString& getGroup() const override {
+        return m_group;
+    }
+    EngineChannel* getChannel() const override {
+        return nullptr;
+    }
+    void setSyncMode(SyncMode mode) override {
+        m_mode = mode;
+    }
+    void notifyOnlyPlayingSyncable() override {
+    }
+    void requestSync() override {
+    }
+    SyncMode getSyncMode() const override {
+        return m_mode;
+    }
+    bool isPlaying() const override {
+        return true;
+    }
+    double getBpm() const override {
+        return 124.0;
+    }
+    double getBeatDistance() const override {
+        return 0.0;
+    }
+    double getBaseBpm() const override {
+        return 124.0;
+    }
+    void setMasterBeatDistance(double beatDistance) override {
+        m_masterBeatDistance = beatDistance;
+    }
+    void setMasterBpm(double bpm) override {
+        m_masterBpm = bpm;
+    }
+    void setMasterParams(double beatDistance, double baseBpm, double bpm) override {
+        Q_UNUSED(baseBpm);
+        m_masterBeatDistance = beatDistance;
+        m_masterBpm = bpm;
+    }
+    void setInstantaneousBpm(double bpm) override {
+        m_instantaneousBpm = bpm;
+    }
+
+  private:
+    const QString m_group;
+    SyncMode m_mode;
+    double m_masterBeatDistance;
+    double m_masterBpm;
+    double m_instantaneousBpm;
+};
+
+// One callback with the internal clock as master and state.range(0) synced
+// decks, next to samplers that are not synced.
+static void BM_EngineSyncCallback(benchmark::State& state) {
+    const int kNumSamplers = 16;
+    const int kSampleRate = 44100;
+    const int kBufferSize = 1024;
+    EngineSync engineSync(UserSettingsPointer(new UserSettings("")));
+    std::vector<std::unique_ptr<BenchmarkSyncable>> syncables;
+    for (int i = 0; i < state.range(0); ++i) {
+        syncables.push_back(std::make_unique<BenchmarkSyncable>(
+                QStringLiteral("[Channel%1]").arg(i + 1), SYNC_FOLLOWER));
+    }
+    for (int i = 0; i < kNumSamplers; ++i) {
+        syncables.push_back(std::make_unique<BenchmarkSyncable>(
+                QStringLiteral("[Sampler%1]").arg(i + 1), SYNC_NONE));
+    }
+    for (const auto& pSyncable : syncables) {
+        engineSync.addSyncableDeck(pSyncable.get());
+    }
+    ControlObject::set(ConfigKey("[InternalClock]", "sync_master"), 1.0);
+
+    while (state.KeepRunning()) {
+        engineSync.onCallbackStart(kSampleRate, kBufferSize);
+        // Every deck reports its state like EngineBuffer does
+        for (const auto& pSyncable : syncables) {
+            engineSync.notifyInstantaneousBpmChanged(pSyncable.get(), 124.0);
+        }
+        engineSync.onCallbackEnd(kSampleRate, kBufferSize);
+        for (const auto& pSyncable : syncables) {
+            engineSync.notifyBeatDistanceChanged(pSyncable.get(), 0.5);
+        }
+        engineSync.onPostProcessEnd();
+    }
+}
+BENCHMARK(BM_EngineSyncCallback)->Arg(4)->Arg(8)->Arg(16)->Arg(64);
+
+} // namespace
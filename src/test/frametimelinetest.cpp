@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTemporaryDir>
+#include <thread>
+#include <vector>
+
+#include "util/frametimeline.h"
+#include "util/time.h"
+
+namespace {
+
+class FrameTimelineTest : public testing::Test {
+  protected:
+    void SetUp() override {
+        timeline().clear();
+        FrameTimeline::setEnabled(true);
+        mixxx::Time::setTestMode(true);
+        mixxx::Time::setTestElapsedTime(mixxx::Duration::fromMillis(1));
+    }
+
+    void TearDown() override {
+        FrameTimeline::setEnabled(false);
+        mixxx::Time::setTestMode(false);
+        timeline().clear();
+    }
+
+    static FrameTimeline& timeline() {
+        return FrameTimeline::instance();
+    }
+};
+
+TEST_F(FrameTimelineTest, RecordsEventsOrderedByStartTime) {
+    timeline().record("second",
+            mixxx::Duration::fromMicros(200),
+            mixxx::Duration::fromMicros(50),
+            1);
+    timeline().record("first",
+            mixxx::Duration::fromMicros(100),
+            mixxx::Duration::fromMicros(30));
+
+    const auto events = timeline().events();
+    ASSERT_EQ(2u, events.size());
+    EXPECT_STREQ("first", events[0].name);
+    EXPECT_EQ(100000, events[0].startNanos);
+    EXPECT_EQ(30000, events[0].durationNanos);
+    EXPECT_EQ(-1, events[0].arg);
+    EXPECT_STREQ("second", events[1].name);
+    EXPECT_EQ(1, events[1].arg);
+}
+
+TEST_F(FrameTimelineTest, ScopeRecordsOnlyIfEnabled) {
+    {
+        FrameTimeline::Scope scope("enabled", 3);
+        mixxx::Time::setTestElapsedTime(mixxx::Duration::fromMillis(5));
+    }
+    FrameTimeline::setEnabled(false);
+    {
+        FrameTimeline::Scope scope("disabled");
+    }
+
+    const auto events = timeline().events();
+    ASSERT_EQ(1u, events.size());
+    EXPECT_STREQ("enabled", events[0].name);
+    EXPECT_EQ(1000000, events[0].startNanos);
+    EXPECT_EQ(4000000, events[0].durationNanos);
+    EXPECT_EQ(3, events[0].arg);
+}
+
+TEST_F(FrameTimelineTest, KeepsMostRecentEvents) {
+    const int count = FrameTimeline::kCapacity + 100;
+    for (int i = 0; i < count; ++i) {
+        timeline().record("event",
+                mixxx::Duration::fromMicros(i),
+                mixxx::Duration::fromMicros(1),
+                i);
+    }
+
+    const auto events = timeline().events();
+    ASSERT_EQ(static_cast<size_t>(FrameTimeline::kCapacity), events.size());
+    EXPECT_EQ(100, events.front().arg);
+    EXPECT_EQ(count - 1, events.back().arg);
+}
+
+TEST_F(FrameTimelineTest, ConcurrentWriters) {
+    const int kThreads = 4;
+    const int kEventsPerThread = 1000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([t] {
+            for (int i = 0; i < kEventsPerThread; ++i) {
+                FrameTimeline::instance().record("event",
+                        mixxx::Duration::fromMicros(i),
+                        mixxx::Duration::fromMicros(1),
+                        t);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const auto events = timeline().events();
+    ASSERT_EQ(static_cast<size_t>(kThreads * kEventsPerThread), events.size());
+    std::vector<int> eventsPerThread(kThreads, 0);
+    for (const auto& event : events) {
+        ASSERT_GE(event.arg, 0);
+        ASSERT_LT(event.arg, kThreads);
+        ++eventsPerThread[event.arg];
+    }
+    for (int t = 0; t < kThreads; ++t) {
+        EXPECT_EQ(kEventsPerThread, eventsPerThread[t]);
+    }
+}
+
+TEST_F(FrameTimelineTest, WritesTraceEvents) {
+    timeline().record("render",
+            mixxx::Duration::fromMicros(1500),
+            mixxx::Duration::fromMicros(250),
+            2);
+    timeline().recordInstant("VSync missed");
+
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+    const QString filename = dir.filePath("frames.json");
+    ASSERT_TRUE(timeline().writeTraceEvents(filename));
+
+    QFile file(filename);
+    ASSERT_TRUE(file.open(QIODevice::ReadOnly));
+    const QJsonArray traceEvents =
+            QJsonDocument::fromJson(file.readAll()).object().value("traceEvents").toArray();
+    ASSERT_EQ(2, traceEvents.size());
+
+    // The instant event has been recorded at 1 ms
+    const QJsonObject instant = traceEvents.at(0).toObject();
+    EXPECT_EQ("VSync missed", instant.value("name").toString());
+    EXPECT_EQ("i", instant.value("ph").toString());
+    EXPECT_DOUBLE_EQ(1000.0, instant.value("ts").toDouble());
+
+    const QJsonObject complete = traceEvents.at(1).toObject();
+    EXPECT_EQ("render", complete.value("name").toString());
+    EXPECT_EQ("X", complete.value("ph").toString());
+    EXPECT_DOUBLE_EQ(1500.0, complete.value("ts").toDouble());
+    EXPECT_DOUBLE_EQ(250.0, complete.value("dur").toDouble());
+    EXPECT_EQ(2, complete.value("args").toObject().value("index").toInt());
+}
+
+} // anonymous namespace
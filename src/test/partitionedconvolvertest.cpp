@@ -0,0 +1,127 @@
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "engine/filters/partitionedconvolver.h"
+
+namespace {
+
+constexpr SINT kPartitionFrames = PartitionedConvolver::kPartitionFrames;
+
+// Deterministic pseudo random samples in the range [-1, 1)
+std::vector<CSAMPLE> noise(SINT length, unsigned int seed) {
+    std::vector<CSAMPLE> samples(length);
+    for (auto& sample : samples) {
+        seed = seed * 1664525 + 1013904223;
+        sample = static_cast<CSAMPLE>(seed >> 8) / (1 << 23) - 1.0f;
+    }
+    return samples;
+}
+
+// Direct convolution including the latency of the PartitionedConvolver
+CSAMPLE expectedOutput(const std::vector<CSAMPLE>& input,
+        const std::vector<CSAMPLE>& impulseResponse,
+        SINT frame) {
+    double sum = 0.0;
+    for (SINT i = 0; i < static_cast<SINT>(impulseResponse.size()); ++i) {
+        SINT inputFrame = frame - kPartitionFrames - i;
+        if (inputFrame >= 0) {
+            sum += impulseResponse[i] * input[inputFrame];
+        }
+    }
+    return static_cast<CSAMPLE>(sum);
+}
+
+class PartitionedConvolverTest : public testing::Test {
+  protected:
+    void assertConvolution(SINT impulseResponseLength, SINT framesPerBuffer) {
+        const std::vector<CSAMPLE> impulseResponse = noise(impulseResponseLength, 1);
+        const std::vector<CSAMPLE> input = noise(8 * kPartitionFrames + 17, 2);
+        PartitionedConvolver convolver(std::make_shared<PartitionedConvolver::Kernel>(
+                impulseResponse.data(), impulseResponseLength));
+
+        std::vector<CSAMPLE> output(input.size());
+        for (SINT frame = 0; frame < static_cast<SINT>(input.size());
+                frame += framesPerBuffer) {
+            const SINT frames = std::min(framesPerBuffer,
+                    static_cast<SINT>(input.size()) - frame);
+            convolver.process(&input[frame], &output[frame], frames);
+        }
+
+        for (SINT frame = 0; frame < static_cast<SINT>(input.size()); ++frame) {
+            ASSERT_NEAR(expectedOutput(input, impulseResponse, frame), output[frame], 1e-3)
+                    << "frame " << frame;
+        }
+    }
+};
+
+TEST_F(PartitionedConvolverTest, SinglePartition) {
+    assertConvolution(kPartitionFrames / 2, 64);
+}
+
+TEST_F(PartitionedConvolverTest, MultiplePartitions) {
+    assertConvolution(5 * kPartitionFrames + 3, 64);
+}
+
+TEST_F(PartitionedConvolverTest, OddBufferSizes) {
+    assertConvolution(3 * kPartitionFrames, 37);
+    assertConvolution(3 * kPartitionFrames, kPartitionFrames + 5);
+}
+
+TEST_F(PartitionedConvolverTest, InterleavedInPlace) {
+    const std::vector<CSAMPLE> impulseResponse = noise(2 * kPartitionFrames, 3);
+    const std::vector<CSAMPLE> input = noise(4 * kPartitionFrames, 4);
+    PartitionedConvolver convolver(std::make_shared<PartitionedConvolver::Kernel>(
+            impulseResponse.data(), impulseResponse.size()));
+
+    // The convolution is applied to the first of two interleaved channels
+    std::vector<CSAMPLE> buffer(2 * input.size(), 0.5f);
+    for (SINT frame = 0; frame < static_cast<SINT>(input.size()); ++frame) {
+        buffer[2 * frame] = input[frame];
+    }
+    convolver.process(buffer.data(), buffer.data(), input.size(), 2);
+
+    for (SINT frame = 0; frame < static_cast<SINT>(input.size()); ++frame) {
+        ASSERT_NEAR(expectedOutput(input, impulseResponse, frame), buffer[2 * frame], 1e-3);
+        ASSERT_FLOAT_EQ(0.5f, buffer[2 * frame + 1]);
+    }
+}
+
+TEST_F(PartitionedConvolverTest, Clear) {
+    const std::vector<CSAMPLE> impulseResponse = noise(3 * kPartitionFrames, 5);
+    const std::vector<CSAMPLE> input = noise(4 * kPartitionFrames, 6);
+    PartitionedConvolver convolver(std::make_shared<PartitionedConvolver::Kernel>(
+            impulseResponse.data(), impulseResponse.size()));
+
+    std::vector<CSAMPLE> output(input.size());
+    convolver.process(input.data(), output.data(), input.size());
+    convolver.clear();
+
+    const std::vector<CSAMPLE> silence(input.size(), 0);
+    convolver.process(silence.data(), output.data(), silence.size());
+    for (CSAMPLE sample : output) {
+        ASSERT_FLOAT_EQ(0, sample);
+    }
+}
+
+// Cost of a single stereo engine callback of 64 frames at 44.1 kHz for an
+// impulse response of state.range(0) seconds.
+static void BM_PartitionedConvolver(benchmark::State& state) {
+    constexpr SINT kFramesPerBuffer = 64;
+    const SINT impulseResponseFrames = state.range(0) * 44100;
+    const std::vector<CSAMPLE> impulseResponse = noise(2 * impulseResponseFrames, 7);
+    PartitionedConvolver left(std::make_shared<PartitionedConvolver::Kernel>(
+            impulseResponse.data(), impulseResponseFrames, 2));
+    PartitionedConvolver right(std::make_shared<PartitionedConvolver::Kernel>(
+            impulseResponse.data() + 1, impulseResponseFrames, 2));
+    std::vector<CSAMPLE> buffer = noise(2 * kFramesPerBuffer, 8);
+
+    while (state.KeepRunning()) {
+        left.process(buffer.data(), buffer.data(), kFramesPerBuffer, 2);
+        right.process(buffer.data() + 1, buffer.data() + 1, kFramesPerBuffer, 2);
+    }
+}
+BENCHMARK(BM_PartitionedConvolver)->Arg(1)->Arg(2)->Arg(4)->Arg(8);
+
+} // namespace
@@ -8,6 +8,7 @@
 #include "test/mixxxtest.h"
 
 using ::testing::_;
+using ::testing::Invoke;
 using ::testing::NotNull;
 using ::testing::Return;
 using ::testing::Sequence;
@@ -35,6 +36,14 @@ class MockPortMidiController : public PortMidiController {
         PortMidiController::sendSysexMsg(data, length);
     }
 
+    void sendOutput(const QVector<ControllerOutputQueue::Message>& messages) override {
+        PortMidiController::sendOutput(messages);
+    }
+
+    void queueShortMsg(unsigned char status, unsigned char byte1, unsigned char byte2) {
+        PortMidiController::queueShortMsg(status, byte1, byte2);
+    }
+
     MOCK_METHOD4(receivedShortMessage,
             void(unsigned char, unsigned char, unsigned char, mixxx::Duration));
     MOCK_METHOD2(receive, void(const QByteArray&, mixxx::Duration));
@@ -57,6 +66,7 @@ class MockPortMidiDevice : public PortMidiDevice {
     MOCK_METHOD0(poll, PmError());
     MOCK_METHOD2(read, int(PmEvent*, int32_t));
     MOCK_METHOD1(writeShort, PmError(int32_t));
+    MOCK_METHOD2(write, PmError(PmEvent*, int32_t));
     MOCK_METHOD1(writeSysEx, PmError(unsigned char*));
 };
 
@@ -173,6 +183,60 @@ TEST_F(PortMidiControllerTest, WriteShort) {
     m_pController->sendShortMsg(0x80, 0x3C, 0x40);
 };
 
+TEST_F(PortMidiControllerTest, WriteQueuedShortMessages) {
+    ControllerOutputQueue queue;
+    queue.enqueue(0x903C, QByteArray("\x90\x3C\x40", 3));
+    queue.enqueue(0xB010, QByteArray("\xB0\x10\x7F", 3));
+
+    EXPECT_CALL(*m_mockOutput, isOpen())
+            .WillRepeatedly(Return(true));
+    EXPECT_CALL(*m_mockOutput, writeShort(_))
+            .Times(0);
+    // All messages are written at once
+    EXPECT_CALL(*m_mockOutput, write(NotNull(), 2))
+            .WillOnce(Invoke([](PmEvent* events, int32_t length) {
+                Q_UNUSED(length);
+                EXPECT_EQ(0x403C90, events[0].message);
+                EXPECT_EQ(0x7F10B0, events[1].message);
+                return pmNoError;
+            }));
+    m_pController->sendOutput(queue.takeReady(mixxx::Duration::fromMillis(10)));
+};
+
+TEST_F(PortMidiControllerTest, FlushQueuedOutputOnClose) {
+    ON_CALL(*m_mockInput, isOpen())
+            .WillByDefault(Return(false));
+    EXPECT_CALL(*m_mockInput, openInput(MIXXX_PORTMIDI_BUFFER_LEN))
+            .WillOnce(Return(pmNoError));
+
+    Sequence output;
+    EXPECT_CALL(*m_mockOutput, isOpen())
+            .WillRepeatedly(Return(true));
+    EXPECT_CALL(*m_mockOutput, openOutput())
+            .WillOnce(Return(pmNoError));
+    // The messages queued by the shutdown scripts exceed the rate limit,
+    // but are all written before the device is closed.
+    EXPECT_CALL(*m_mockOutput, write(NotNull(), 3))
+            .InSequence(output)
+            .WillOnce(Invoke([](PmEvent* events, int32_t length) {
+                Q_UNUSED(length);
+                EXPECT_EQ(0x000090, events[0].message);
+                EXPECT_EQ(0x000190, events[1].message);
+                EXPECT_EQ(0x000290, events[2].message);
+                return pmNoError;
+            }));
+    EXPECT_CALL(*m_mockOutput, close())
+            .InSequence(output)
+            .WillOnce(Return(pmNoError));
+
+    openDevice();
+    m_pController->setMaxOutputRate(1);
+    m_pController->queueShortMsg(0x90, 0x00, 0x00);
+    m_pController->queueShortMsg(0x90, 0x01, 0x00);
+    m_pController->queueShortMsg(0x90, 0x02, 0x00);
+    closeDevice();
+};
+
 TEST_F(PortMidiControllerTest, WriteSysex) {
     QList<int> sysex;
     sysex.append(0xF0);
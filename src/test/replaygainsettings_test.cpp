@@ -0,0 +1,62 @@
+#include "preferences/replaygainsettings.h"
+
+#include <gtest/gtest.h>
+
+#include "test/mixxxtest.h"
+#include "track/track.h"
+
+namespace {
+
+class ReplayGainSettingsTest : public MixxxTest {
+  protected:
+    ReplayGainSettingsTest()
+            : m_rgSettings(config()),
+              m_pTrack(Track::newTemporary()) {
+        m_rgSettings.setReplayGainAnalyzerEnabled(true);
+        m_rgSettings.setReplayGainAnalyzerVersion(2);
+    }
+
+    void setReplayGain(const QString& version) {
+        mixxx::ReplayGain replayGain;
+        replayGain.setRatio(0.5);
+        m_pTrack->setReplayGain(replayGain);
+        m_pTrack->setReplayGainVersion(version);
+    }
+
+    ReplayGainSettings m_rgSettings;
+    TrackPointer m_pTrack;
+};
+
+TEST_F(ReplayGainSettingsTest, AnalyzeTrackWithoutReplayGain) {
+    EXPECT_FALSE(m_rgSettings.isAnalyzerDisabled(2, m_pTrack));
+    EXPECT_TRUE(m_rgSettings.isAnalyzerDisabled(1, m_pTrack));
+
+    m_rgSettings.setReplayGainAnalyzerEnabled(false);
+    EXPECT_TRUE(m_rgSettings.isAnalyzerDisabled(2, m_pTrack));
+}
+
+TEST_F(ReplayGainSettingsTest, KeepExistingReplayGain) {
+    setReplayGain(QString());
+    EXPECT_TRUE(m_rgSettings.isAnalyzerDisabled(2, m_pTrack));
+
+    setReplayGain(ReplayGainSettings::getAnalyzerVersionId(1));
+    EXPECT_TRUE(m_rgSettings.isAnalyzerDisabled(2, m_pTrack));
+}
+
+TEST_F(ReplayGainSettingsTest, ReanalyzeOnlyOutdatedReplayGain) {
+    m_rgSettings.setReplayGainReanalyze(true);
+
+    // Imported from file tags
+    setReplayGain(QString());
+    EXPECT_FALSE(m_rgSettings.isAnalyzerDisabled(2, m_pTrack));
+
+    // Calculated by a different analyzer
+    setReplayGain(ReplayGainSettings::getAnalyzerVersionId(1));
+    EXPECT_FALSE(m_rgSettings.isAnalyzerDisabled(2, m_pTrack));
+
+    // Already up-to-date
+    setReplayGain(ReplayGainSettings::getAnalyzerVersionId(2));
+    EXPECT_TRUE(m_rgSettings.isAnalyzerDisabled(2, m_pTrack));
+}
+
+} // namespace
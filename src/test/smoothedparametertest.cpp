@@ -0,0 +1,91 @@
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "engine/effects/smoothedparameter.h"
+#include "engine/filters/enginefilterbiquad1.h"
+
+namespace {
+
+class SmoothedParameterTest : public testing::Test {
+};
+
+TEST_F(SmoothedParameterTest, UnchangedValue) {
+    SmoothedParameter parameter(1.0, 0.1);
+    EXPECT_FALSE(parameter.update(1.0));
+    EXPECT_FALSE(parameter.changed());
+    EXPECT_DOUBLE_EQ(1.0, parameter.value());
+    EXPECT_DOUBLE_EQ(1.0, parameter.previous());
+}
+
+TEST_F(SmoothedParameterTest, ChangeAboveThreshold) {
+    SmoothedParameter parameter(1.0, 0.1);
+    EXPECT_TRUE(parameter.update(1.5));
+    EXPECT_DOUBLE_EQ(1.5, parameter.value());
+    EXPECT_DOUBLE_EQ(1.0, parameter.previous());
+
+    EXPECT_FALSE(parameter.update(1.5));
+    EXPECT_DOUBLE_EQ(1.5, parameter.value());
+    EXPECT_DOUBLE_EQ(1.5, parameter.previous());
+}
+
+TEST_F(SmoothedParameterTest, SmallChangesWhileMoving) {
+    SmoothedParameter parameter(1.0, 0.1);
+    EXPECT_FALSE(parameter.update(1.05));
+    EXPECT_DOUBLE_EQ(1.0, parameter.value());
+    EXPECT_FALSE(parameter.update(1.08));
+    EXPECT_DOUBLE_EQ(1.0, parameter.value());
+    EXPECT_TRUE(parameter.update(1.11));
+    EXPECT_DOUBLE_EQ(1.11, parameter.value());
+    EXPECT_DOUBLE_EQ(1.0, parameter.previous());
+}
+
+TEST_F(SmoothedParameterTest, SettlesOnExactValue) {
+    SmoothedParameter parameter(1.0, 0.1);
+    EXPECT_FALSE(parameter.update(1.05));
+    EXPECT_DOUBLE_EQ(1.0, parameter.value());
+    // The parameter has come to rest
+    EXPECT_TRUE(parameter.update(1.05));
+    EXPECT_DOUBLE_EQ(1.05, parameter.value());
+    EXPECT_FALSE(parameter.update(1.05));
+}
+
+TEST_F(SmoothedParameterTest, RelativeThreshold) {
+    SmoothedParameter parameter(1000.0, 0.01, SmoothedParameter::Threshold::Relative);
+    EXPECT_FALSE(parameter.update(1009.0));
+    EXPECT_TRUE(parameter.update(1011.0));
+    EXPECT_DOUBLE_EQ(1011.0, parameter.value());
+}
+
+TEST_F(SmoothedParameterTest, Force) {
+    SmoothedParameter parameter(1.0, 0.1);
+    EXPECT_TRUE(parameter.force(1.01));
+    EXPECT_DOUBLE_EQ(1.01, parameter.value());
+    EXPECT_DOUBLE_EQ(1.0, parameter.previous());
+    EXPECT_FALSE(parameter.force(1.01));
+}
+
+// Cost of an EQ band while its gain is swept slowly over 10 s in callbacks of
+// 1024 frames at 44.1 kHz. With a threshold of 0 the filter is redesigned in
+// every callback like before the SmoothedParameter was introduced.
+static void BM_SmoothedParameterGainSweep(benchmark::State& state) {
+    constexpr int kSamplesPerBuffer = 2048;
+    constexpr int kCallbacks = 10 * 44100 / (kSamplesPerBuffer / 2);
+    std::vector<CSAMPLE> buffer(kSamplesPerBuffer, 0.1f);
+    EngineFilterBiquad1Peaking filter(44100, 1100, 0.3);
+    SmoothedParameter gainDb(0, state.range(0) / 100.0);
+
+    int callback = 0;
+    while (state.KeepRunning()) {
+        const double target = 12.0 * (callback % kCallbacks) / kCallbacks;
+        if (gainDb.update(target)) {
+            filter.setFrequencyCorners(44100, 1100, 0.3, gainDb.value());
+        }
+        filter.process(buffer.data(), buffer.data(), kSamplesPerBuffer);
+        ++callback;
+    }
+}
+BENCHMARK(BM_SmoothedParameterGainSweep)->Arg(0)->Arg(10);
+
+} // namespace
@@ -0,0 +1,131 @@
+#ifdef __VINYLCONTROL__
+
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "vinylcontrol/vinylcontrolxwax.h"
+
+// Offline harness for the timecode decoder that runs in the vinyl control
+// worker threads. The carrier of the timecode is synthesized, so that the
+// decoded pitch can be compared against a known reference.
+
+namespace {
+
+constexpr unsigned int kSampleRate = 44100;
+constexpr unsigned int kChunkFrames = 256;
+constexpr double kCarrierFrequency = 1000.0;
+constexpr double kAmplitude = 16384.0;
+
+// Generates a stereo carrier at the given frequency. The secondary (left)
+// channel leads the primary (right) channel when playing forwards.
+std::vector<short> generateCarrier(double frequency, double seconds, bool forwards) {
+    const auto frames = static_cast<std::size_t>(seconds * kSampleRate);
+    std::vector<short> pcm(frames * 2);
+    for (std::size_t i = 0; i < frames; ++i) {
+        const double phase = 2 * M_PI * frequency * i / kSampleRate;
+        const double left = forwards ? -std::cos(phase) : std::cos(phase);
+        pcm[2 * i] = static_cast<short>(kAmplitude * left);
+        pcm[2 * i + 1] = static_cast<short>(kAmplitude * std::sin(phase));
+    }
+    return pcm;
+}
+
+class VinylControlTimecodeTest : public testing::Test {
+  protected:
+    static void SetUpTestSuite() {
+        s_pDefinition = timecoder_find_definition("serato_2a");
+    }
+
+    static void TearDownTestSuite() {
+        timecoder_free_lookup();
+        s_pDefinition = nullptr;
+    }
+
+    void SetUp() override {
+        ASSERT_NE(nullptr, s_pDefinition);
+        timecoder_init(&m_timecoder, s_pDefinition, 1.0, kSampleRate, false);
+    }
+
+    void TearDown() override {
+        timecoder_clear(&m_timecoder);
+    }
+
+    // Submits pcm in chunks like the audio callback does and returns the
+    // average pitch of the chunks after the warm up time, when the pitch
+    // filter has settled.
+    double decodePitch(std::vector<short>* pPcm, double warmUpSeconds) {
+        const std::size_t frames = pPcm->size() / 2;
+        const auto warmUpFrames = static_cast<std::size_t>(warmUpSeconds * kSampleRate);
+        double pitchSum = 0.0;
+        int pitchCount = 0;
+        for (std::size_t offset = 0; offset + kChunkFrames <= frames;
+                offset += kChunkFrames) {
+            timecoder_submit(&m_timecoder, pPcm->data() + 2 * offset, kChunkFrames);
+            if (offset >= warmUpFrames) {
+                pitchSum += timecoder_get_pitch(&m_timecoder);
+                ++pitchCount;
+            }
+        }
+        return pitchCount > 0 ? pitchSum / pitchCount : 0.0;
+    }
+
+    static struct timecode_def* s_pDefinition;
+    struct timecoder m_timecoder;
+};
+
+struct timecode_def* VinylControlTimecodeTest::s_pDefinition = nullptr;
+
+TEST_F(VinylControlTimecodeTest, ForwardsAtReferenceSpeed) {
+    auto pcm = generateCarrier(kCarrierFrequency, 3.0, true);
+    EXPECT_NEAR(1.0, decodePitch(&pcm, 2.0), 0.01);
+}
+
+TEST_F(VinylControlTimecodeTest, Backwards) {
+    auto pcm = generateCarrier(kCarrierFrequency, 3.0, false);
+    EXPECT_NEAR(-1.0, decodePitch(&pcm, 2.0), 0.01);
+}
+
+TEST_F(VinylControlTimecodeTest, Faster) {
+    auto pcm = generateCarrier(1.1 * kCarrierFrequency, 3.0, true);
+    EXPECT_NEAR(1.1, decodePitch(&pcm, 2.0), 0.011);
+}
+
+TEST_F(VinylControlTimecodeTest, Slower) {
+    auto pcm = generateCarrier(0.9 * kCarrierFrequency, 3.0, true);
+    EXPECT_NEAR(0.9, decodePitch(&pcm, 2.0), 0.009);
+}
+
+TEST_F(VinylControlTimecodeTest, HalfSpeed) {
+    auto pcm = generateCarrier(0.5 * kCarrierFrequency, 3.0, true);
+    EXPECT_NEAR(0.5, decodePitch(&pcm, 2.0), 0.005);
+}
+
+// The time it takes to decode one callback worth of samples bounds the
+// latency that the worker threads add per deck.
+static void BM_DecodeTimecodeChunk(benchmark::State& state) {
+    struct timecode_def* pDefinition = timecoder_find_definition("serato_2a");
+    struct timecoder timecoder;
+    timecoder_init(&timecoder, pDefinition, 1.0, kSampleRate, false);
+    auto pcm = generateCarrier(kCarrierFrequency, 1.0, true);
+    const std::size_t chunkFrames = state.range(0);
+    const std::size_t frames = pcm.size() / 2;
+    std::size_t offset = 0;
+    while (state.KeepRunning()) {
+        if (offset + chunkFrames > frames) {
+            offset = 0;
+        }
+        timecoder_submit(&timecoder, pcm.data() + 2 * offset, chunkFrames);
+        benchmark::DoNotOptimize(timecoder_get_pitch(&timecoder));
+        offset += chunkFrames;
+    }
+    state.SetItemsProcessed(state.iterations() * chunkFrames);
+    timecoder_clear(&timecoder);
+}
+BENCHMARK(BM_DecodeTimecodeChunk)->Arg(64)->Arg(256)->Arg(1024);
+
+} // namespace
+
+#endif // __VINYLCONTROL__
@@ -0,0 +1,133 @@
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+#include "util/math.h"
+#include "waveform/waveform.h"
+
+namespace {
+
+class WaveformPyramidTest : public testing::Test {
+  protected:
+    static void fill(Waveform* pWaveform, int first, int last) {
+        WaveformData* pData = pWaveform->data();
+        for (int i = first; i < last; ++i) {
+            pData[i].filtered.low = static_cast<unsigned char>((i * 37) % 251);
+            pData[i].filtered.mid = static_cast<unsigned char>((i * 101) % 239);
+            pData[i].filtered.high = static_cast<unsigned char>((i * 13) % 229);
+            pData[i].filtered.all = static_cast<unsigned char>((i * 7) % 255);
+        }
+    }
+
+    static void expectPeaksOfScan(
+            const Waveform& waveform, int firstFrame, int lastFrame) {
+        WaveformPeak peaks[ChannelCount];
+        waveform.getPeaks(firstFrame, lastFrame + 1, peaks);
+        for (int channel = 0; channel < ChannelCount; ++channel) {
+            WaveformPeak expected = WaveformPeak::fromData(
+                    waveform.get(firstFrame * ChannelCount + channel));
+            for (int frame = firstFrame + 1; frame <= lastFrame; ++frame) {
+                expected.merge(WaveformPeak::fromData(
+                        waveform.get(frame * ChannelCount + channel)));
+            }
+            EXPECT_EQ(expected.low, peaks[channel].low);
+            EXPECT_EQ(expected.mid, peaks[channel].mid);
+            EXPECT_EQ(expected.high, peaks[channel].high);
+            EXPECT_EQ(expected.all, peaks[channel].all);
+            EXPECT_EQ(expected.energy, peaks[channel].energy);
+        }
+    }
+};
+
+TEST_F(WaveformPyramidTest, PeaksMatchScan) {
+    // 1000 visual frames, which is not a power of 2
+    Waveform waveform(44100, 44100 * 10, 200, -1);
+    const int frames = waveform.getDataSize() / ChannelCount;
+    fill(&waveform, 0, waveform.getDataSize());
+    waveform.setCompletion(waveform.getDataSize());
+
+    for (int first = 0; first < frames; first += 97) {
+        for (int last = first; last < frames; last += 31) {
+            expectPeaksOfScan(waveform, first, last);
+        }
+        expectPeaksOfScan(waveform, first, frames - 1);
+    }
+}
+
+TEST_F(WaveformPyramidTest, IncrementalCompletion) {
+    Waveform waveform(44100, 44100 * 10, 200, -1);
+    const int dataSize = waveform.getDataSize();
+    const int frames = dataSize / ChannelCount;
+    // Like AnalyzerWaveform, which completes one stride at a time
+    for (int completion = 0; completion < dataSize; completion += ChannelCount) {
+        fill(&waveform, completion, completion + ChannelCount);
+        waveform.setCompletion(completion + ChannelCount);
+    }
+    expectPeaksOfScan(waveform, 0, frames - 1);
+    expectPeaksOfScan(waveform, 3, frames / 2 + 5);
+}
+
+TEST_F(WaveformPyramidTest, ExcludesEndFrame) {
+    Waveform waveform(44100, 44100, 200, -1);
+    WaveformData* pData = waveform.data();
+    for (int i = 0; i < waveform.getDataSize(); ++i) {
+        pData[i].filtered.all = 1;
+    }
+    // A single loud frame right behind the range
+    pData[20 * ChannelCount].filtered.all = 200;
+    pData[20 * ChannelCount + 1].filtered.all = 200;
+    waveform.setCompletion(waveform.getDataSize());
+
+    WaveformPeak peaks[ChannelCount];
+    waveform.getPeaks(10, 20, peaks);
+    EXPECT_EQ(1, peaks[0].all);
+    EXPECT_EQ(1, peaks[1].all);
+    waveform.getPeaks(10, 21, peaks);
+    EXPECT_EQ(200, peaks[0].all);
+    EXPECT_EQ(200, peaks[1].all);
+    // Empty range
+    waveform.getPeaks(20, 20, peaks);
+    EXPECT_EQ(0, peaks[0].all);
+}
+
+TEST_F(WaveformPyramidTest, ClampsRange) {
+    Waveform waveform(44100, 44100, 200, -1);
+    const int frames = waveform.getDataSize() / ChannelCount;
+    fill(&waveform, 0, waveform.getDataSize());
+    waveform.setCompletion(waveform.getDataSize());
+
+    WaveformPeak peaks[ChannelCount];
+    waveform.getPeaks(-10, frames + 10, peaks);
+    WaveformPeak expected[ChannelCount];
+    waveform.getPeaks(0, frames, expected);
+    for (int channel = 0; channel < ChannelCount; ++channel) {
+        EXPECT_EQ(expected[channel].energy, peaks[channel].energy);
+        EXPECT_EQ(expected[channel].all, peaks[channel].all);
+    }
+}
+
+// The peaks of a 1000 pixel wide zoomed out view on a 10 minute track with
+// the given number of visual frames per pixel
+static void BM_WaveformPeaksPerPixel(benchmark::State& state) {
+    Waveform waveform(44100, 44100 * 600, 441, -1);
+    WaveformData* pData = waveform.data();
+    for (int i = 0; i < waveform.getDataSize(); ++i) {
+        pData[i].m_i = static_cast<int>(i * 2654435761u);
+    }
+    waveform.setCompletion(waveform.getDataSize());
+    const int framesPerPixel = static_cast<int>(state.range(0));
+    const int frames = waveform.getDataSize() / ChannelCount;
+
+    while (state.KeepRunning()) {
+        WaveformPeak peaks[ChannelCount];
+        for (int x = 0; x < 1000; ++x) {
+            const int firstFrame = math_min(x * framesPerPixel, frames - 1);
+            waveform.getPeaks(firstFrame,
+                    math_min(firstFrame + framesPerPixel, frames),
+                    peaks);
+            benchmark::DoNotOptimize(peaks);
+        }
+    }
+}
+BENCHMARK(BM_WaveformPeaksPerPixel)->Range(1, 256);
+
+} // namespace
@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include "proto/waveform.pb.h"
+#include "waveform/waveform.h"
+#include "waveform/waveformfactory.h"
+
+using namespace mixxx::track;
+
+namespace {
+
+class WaveformTest : public testing::Test {
+  protected:
+    static void fill(Waveform* pWaveform) {
+        WaveformData* pData = pWaveform->data();
+        for (int i = 0; i < pWaveform->getDataSize(); ++i) {
+            pData[i].filtered.low = static_cast<unsigned char>(i % 251);
+            pData[i].filtered.mid = static_cast<unsigned char>((i * 3) % 241);
+            pData[i].filtered.high = static_cast<unsigned char>((i * 5) % 239);
+            pData[i].filtered.all = static_cast<unsigned char>((i * 7) % 233);
+        }
+        pWaveform->setCompletion(pWaveform->getDataSize());
+    }
+
+    static QByteArray toProtobuf(const Waveform& waveform) {
+        io::Waveform proto;
+        proto.set_visual_sample_rate(441);
+        proto.set_audio_visual_ratio(waveform.getAudioVisualRatio());
+        io::Waveform::Signal* pAll = proto.mutable_signal_all();
+        io::Waveform::FilteredSignal* pFiltered = proto.mutable_signal_filtered();
+        io::Waveform::Signal* pLow = pFiltered->mutable_low();
+        io::Waveform::Signal* pMid = pFiltered->mutable_mid();
+        io::Waveform::Signal* pHigh = pFiltered->mutable_high();
+        for (int i = 0; i < waveform.getDataSize(); ++i) {
+            pAll->add_value(waveform.getAll(i));
+            pLow->add_value(waveform.getLow(i));
+            pMid->add_value(waveform.getMid(i));
+            pHigh->add_value(waveform.getHigh(i));
+        }
+        std::string serialized;
+        proto.SerializeToString(&serialized);
+        return QByteArray(serialized.data(), static_cast<int>(serialized.size()));
+    }
+
+    static void expectEqualData(const Waveform& expected, const Waveform& actual) {
+        ASSERT_EQ(expected.getDataSize(), actual.getDataSize());
+        EXPECT_DOUBLE_EQ(expected.getAudioVisualRatio(), actual.getAudioVisualRatio());
+        for (int i = 0; i < expected.getDataSize(); ++i) {
+            ASSERT_EQ(expected.get(i).m_i, actual.get(i).m_i) << "at " << i;
+        }
+    }
+};
+
+TEST_F(WaveformTest, BinaryRoundTrip) {
+    Waveform waveform(44100, 44100 * 10, 441, -1);
+    fill(&waveform);
+
+    const QByteArray data = waveform.toByteArray();
+    EXPECT_TRUE(data.startsWith("MXWF"));
+    EXPECT_EQ(4 * waveform.getDataSize(), data.size() - 28);
+
+    Waveform loaded(data);
+    EXPECT_TRUE(loaded.isValid());
+    EXPECT_EQ(loaded.getDataSize(), loaded.getCompletion());
+    EXPECT_EQ(Waveform::SaveState::Saved, loaded.saveState());
+    expectEqualData(waveform, loaded);
+}
+
+TEST_F(WaveformTest, TruncatedBinary) {
+    Waveform waveform(44100, 44100, 441, -1);
+    fill(&waveform);
+
+    QByteArray data = waveform.toByteArray();
+    data.chop(1);
+    EXPECT_FALSE(Waveform(data).isValid());
+    EXPECT_FALSE(Waveform(data.left(10)).isValid());
+}
+
+TEST_F(WaveformTest, ReadsLegacyProtobuf) {
+    Waveform waveform(44100, 44100, 441, -1);
+    fill(&waveform);
+
+    Waveform loaded(toProtobuf(waveform));
+    expectEqualData(waveform, loaded);
+    // Rewritten in the binary format when the track is saved
+    EXPECT_EQ(Waveform::SaveState::SavePending, loaded.saveState());
+}
+
+TEST_F(WaveformTest, ClassifyVersions) {
+    EXPECT_EQ(WaveformFactory::VC_USE,
+            WaveformFactory::waveformVersionToVersionClass(WAVEFORM_6_VERSION));
+    EXPECT_EQ(WaveformFactory::VC_USE,
+            WaveformFactory::waveformSummaryVersionToVersionClass(
+                    WAVEFORMSUMMARY_6_VERSION));
+    // Legacy protobuf rows are still used and migrated
+    EXPECT_EQ(WaveformFactory::VC_USE,
+            WaveformFactory::waveformVersionToVersionClass(WAVEFORM_5_VERSION));
+    EXPECT_EQ(WaveformFactory::VC_USE,
+            WaveformFactory::waveformSummaryVersionToVersionClass(
+                    WAVEFORMSUMMARY_5_VERSION));
+    EXPECT_EQ(WaveformFactory::VC_KEEP,
+            WaveformFactory::waveformVersionToVersionClass(WAVEFORM_2_VERSION));
+}
+
+TEST_F(WaveformTest, MigrateLegacyAnalysis) {
+    Waveform waveform(44100, 44100, 441, -1);
+    fill(&waveform);
+
+    AnalysisDao::AnalysisInfo analysis;
+    analysis.analysisId = 1;
+    analysis.type = AnalysisDao::TYPE_WAVEFORM;
+    analysis.version = WAVEFORM_5_VERSION;
+    analysis.description = WAVEFORM_5_DESCRIPTION;
+    analysis.data = toProtobuf(waveform);
+    std::unique_ptr<Waveform> pLegacy(
+            WaveformFactory::loadWaveformFromAnalysis(analysis));
+    expectEqualData(waveform, *pLegacy);
+    // Saved with the version of the format it is rewritten in
+    EXPECT_EQ(Waveform::SaveState::SavePending, pLegacy->saveState());
+    EXPECT_EQ(WaveformFactory::currentWaveformVersion(), pLegacy->getVersion());
+
+    analysis.version = WAVEFORM_6_VERSION;
+    analysis.description = WAVEFORM_6_DESCRIPTION;
+    analysis.data = waveform.toByteArray();
+    std::unique_ptr<Waveform> pCurrent(
+            WaveformFactory::loadWaveformFromAnalysis(analysis));
+    expectEqualData(waveform, *pCurrent);
+    EXPECT_EQ(Waveform::SaveState::Saved, pCurrent->saveState());
+    EXPECT_EQ(QStringLiteral(WAVEFORM_6_VERSION), pCurrent->getVersion());
+}
+
+} // namespace
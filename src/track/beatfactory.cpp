@@ -15,12 +15,12 @@ mixxx::BeatsPointer BeatFactory::loadBeatsFromByteArray(const Track& track,
         mixxx::BeatGrid* pGrid = new mixxx::BeatGrid(track, 0, beatsSerialized);
         pGrid->setSubVersion(beatsSubVersion);
         qDebug() << "Successfully deserialized BeatGrid";
-        return mixxx::BeatsPointer(pGrid, &BeatFactory::deleteBeats);
+        return mixxx::BeatsPointer(pGrid);
     } else if (beatsVersion == BEAT_MAP_VERSION) {
         mixxx::BeatMap* pMap = new mixxx::BeatMap(track, 0, beatsSerialized);
         pMap->setSubVersion(beatsSubVersion);
         qDebug() << "Successfully deserialized BeatMap";
-        return mixxx::BeatsPointer(pMap, &BeatFactory::deleteBeats);
+        return mixxx::BeatsPointer(pMap);
     }
     qDebug() << "BeatFactory::loadBeatsFromByteArray could not parse serialized beats.";
     return mixxx::BeatsPointer();
@@ -30,7 +30,7 @@ mixxx::BeatsPointer BeatFactory::makeBeatGrid(
         const Track& track, double dBpm, double dFirstBeatSample) {
     mixxx::BeatGrid* pGrid = new mixxx::BeatGrid(track, 0);
     pGrid->setGrid(dBpm, dFirstBeatSample);
-    return mixxx::BeatsPointer(pGrid, &BeatFactory::deleteBeats);
+    return mixxx::BeatsPointer(pGrid);
 }
 
 // static
@@ -117,22 +117,13 @@ mixxx::BeatsPointer BeatFactory::makePreferredBeats(const Track& track,
         // firstBeat is in frames here and setGrid() takes samples.
         pGrid->setGrid(globalBpm, firstBeat * 2);
         pGrid->setSubVersion(subVersion);
-        return mixxx::BeatsPointer(pGrid, &BeatFactory::deleteBeats);
+        return mixxx::BeatsPointer(pGrid);
     } else if (version == BEAT_MAP_VERSION) {
         mixxx::BeatMap* pBeatMap = new mixxx::BeatMap(track, iSampleRate, beats);
         pBeatMap->setSubVersion(subVersion);
-        return mixxx::BeatsPointer(pBeatMap, &BeatFactory::deleteBeats);
+        return mixxx::BeatsPointer(pBeatMap);
     } else {
         qDebug() << "ERROR: Could not determine what type of beatgrid to create.";
         return mixxx::BeatsPointer();
     }
 }
-
-void BeatFactory::deleteBeats(mixxx::Beats* pBeats) {
-    // BeatGrid/BeatMap objects have no parent and live in the same thread as
-    // their associated TIO. QObject::deleteLater does not have the desired
-    // effect when the QObject's thread does not have an event loop (i.e. when
-    // the main thread has already shut down) so we delete the BeatMap/BeatGrid
-    // directly when its reference count drops to zero.
-    delete pBeats;
-}
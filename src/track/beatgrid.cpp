@@ -1,6 +1,5 @@
 #include "track/beatgrid.h"
 
-#include <QMutexLocker>
 #include <QtDebug>
 
 #include "track/track.h"
@@ -42,12 +41,8 @@ class BeatGridIterator : public BeatIterator {
 BeatGrid::BeatGrid(
         const Track& track,
         SINT iSampleRate)
-        : m_mutex(QMutex::Recursive),
-          m_iSampleRate(iSampleRate > 0 ? iSampleRate : track.getSampleRate()),
+        : m_iSampleRate(iSampleRate > 0 ? iSampleRate : track.getSampleRate()),
           m_dBeatLength(0.0) {
-    // BeatGrid should live in the same thread as the track it is associated
-    // with.
-    moveToThread(track.thread());
 }
 
 BeatGrid::BeatGrid(
@@ -59,12 +54,10 @@ BeatGrid::BeatGrid(
 }
 
 BeatGrid::BeatGrid(const BeatGrid& other)
-        : m_mutex(QMutex::Recursive),
-          m_subVersion(other.m_subVersion),
+        : m_subVersion(other.m_subVersion),
           m_iSampleRate(other.m_iSampleRate),
           m_grid(other.m_grid),
           m_dBeatLength(other.m_dBeatLength) {
-    moveToThread(other.thread());
 }
 
 void BeatGrid::setGrid(double dBpm, double dFirstBeatSample) {
@@ -72,7 +65,6 @@ void BeatGrid::setGrid(double dBpm, double dFirstBeatSample) {
         dBpm = 0.0;
     }
 
-    QMutexLocker lock(&m_mutex);
     m_grid.mutable_bpm()->set_bpm(dBpm);
     m_grid.mutable_first_beat()->set_frame_position(
             static_cast<google::protobuf::int32>(dFirstBeatSample / kFrameSize));
@@ -81,18 +73,11 @@ void BeatGrid::setGrid(double dBpm, double dFirstBeatSample) {
 }
 
 QByteArray BeatGrid::toByteArray() const {
-    QMutexLocker locker(&m_mutex);
     std::string output;
     m_grid.SerializeToString(&output);
     return QByteArray(output.data(), static_cast<int>(output.length()));
 }
 
-BeatsPointer BeatGrid::clone() const {
-    QMutexLocker locker(&m_mutex);
-    BeatsPointer other(new BeatGrid(*this));
-    return other;
-}
-
 void BeatGrid::readByteArray(const QByteArray& byteArray) {
     mixxx::track::io::BeatGrid grid;
     if (grid.ParseFromArray(byteArray.constData(), byteArray.length())) {
@@ -120,12 +105,10 @@ double BeatGrid::bpm() const {
 }
 
 QString BeatGrid::getVersion() const {
-    QMutexLocker locker(&m_mutex);
     return BEAT_GRID_2_VERSION;
 }
 
 QString BeatGrid::getSubVersion() const {
-    QMutexLocker locker(&m_mutex);
     return m_subVersion;
 }
 
@@ -152,7 +135,6 @@ double BeatGrid::findPrevBeat(double dSamples) const {
 
 // This is an internal call. This could be implemented in the Beats Class itself.
 double BeatGrid::findClosestBeat(double dSamples) const {
-    QMutexLocker locker(&m_mutex);
     if (!isValid()) {
         return -1;
     }
@@ -169,7 +151,6 @@ double BeatGrid::findClosestBeat(double dSamples) const {
 }
 
 double BeatGrid::findNthBeat(double dSamples, int n) const {
-    QMutexLocker locker(&m_mutex);
     if (!isValid() || n == 0) {
         return -1;
     }
@@ -216,18 +197,13 @@ double BeatGrid::findNthBeat(double dSamples, int n) const {
 bool BeatGrid::findPrevNextBeats(double dSamples,
                                  double* dpPrevBeatSamples,
                                  double* dpNextBeatSamples) const {
-    double dFirstBeatSample;
-    double dBeatLength;
-    {
-        QMutexLocker locker(&m_mutex);
-        if (!isValid()) {
-            *dpPrevBeatSamples = -1.0;
-            *dpNextBeatSamples = -1.0;
-            return false;
-        }
-        dFirstBeatSample = firstBeatSample();
-        dBeatLength = m_dBeatLength;
+    if (!isValid()) {
+        *dpPrevBeatSamples = -1.0;
+        *dpNextBeatSamples = -1.0;
+        return false;
     }
+    const double dFirstBeatSample = firstBeatSample();
+    const double dBeatLength = m_dBeatLength;
 
     double beatFraction = (dSamples - dFirstBeatSample) / dBeatLength;
     double prevBeat = floor(beatFraction);
@@ -253,7 +229,6 @@ bool BeatGrid::findPrevNextBeats(double dSamples,
 
 
 std::unique_ptr<BeatIterator> BeatGrid::findBeats(double startSample, double stopSample) const {
-    QMutexLocker locker(&m_mutex);
     if (!isValid() || startSample > stopSample) {
         return std::unique_ptr<BeatIterator>();
     }
@@ -267,7 +242,6 @@ std::unique_ptr<BeatIterator> BeatGrid::findBeats(double startSample, double sto
 }
 
 bool BeatGrid::hasBeatInRange(double startSample, double stopSample) const {
-    QMutexLocker locker(&m_mutex);
     if (!isValid() || startSample > stopSample) {
         return false;
     }
@@ -279,7 +253,6 @@ bool BeatGrid::hasBeatInRange(double startSample, double stopSample) const {
 }
 
 double BeatGrid::getBpm() const {
-    QMutexLocker locker(&m_mutex);
     if (!isValid()) {
         return 0;
     }
@@ -287,7 +260,6 @@ double BeatGrid::getBpm() const {
 }
 
 double BeatGrid::getBpmRange(double startSample, double stopSample) const {
-    QMutexLocker locker(&m_mutex);
     if (!isValid() || startSample > stopSample) {
         return -1;
     }
@@ -298,38 +270,34 @@ double BeatGrid::getBpmAroundPosition(double curSample, int n) const {
     Q_UNUSED(curSample);
     Q_UNUSED(n);
 
-    QMutexLocker locker(&m_mutex);
     if (!isValid()) {
         return -1;
     }
     return bpm();
 }
 
-void BeatGrid::addBeat(double dBeatSample) {
+BeatsPointer BeatGrid::addBeat(double dBeatSample) const {
     Q_UNUSED(dBeatSample);
-    //QMutexLocker locker(&m_mutex);
-    return;
+    return BeatsPointer(new BeatGrid(*this));
 }
 
-void BeatGrid::removeBeat(double dBeatSample) {
+BeatsPointer BeatGrid::removeBeat(double dBeatSample) const {
     Q_UNUSED(dBeatSample);
-    //QMutexLocker locker(&m_mutex);
-    return;
+    return BeatsPointer(new BeatGrid(*this));
 }
 
-void BeatGrid::translate(double dNumSamples) {
-    QMutexLocker locker(&m_mutex);
+BeatsPointer BeatGrid::translate(double dNumSamples) const {
+    std::unique_ptr<BeatGrid> pGrid(new BeatGrid(*this));
     if (!isValid()) {
-        return;
+        return BeatsPointer(pGrid.release());
     }
     double newFirstBeatFrames = (firstBeatSample() + dNumSamples) / kFrameSize;
-    m_grid.mutable_first_beat()->set_frame_position(
+    pGrid->m_grid.mutable_first_beat()->set_frame_position(
             static_cast<google::protobuf::int32>(newFirstBeatFrames));
-    locker.unlock();
-    emit updated();
+    return BeatsPointer(pGrid.release());
 }
 
-void BeatGrid::scale(enum BPMScale scale) {
+BeatsPointer BeatGrid::scale(enum BPMScale scale) const {
     double bpm = getBpm();
 
     switch (scale) {
@@ -353,20 +321,19 @@ void BeatGrid::scale(enum BPMScale scale) {
         break;
     default:
         DEBUG_ASSERT(!"scale value invalid");
-        return;
+        return BeatsPointer(new BeatGrid(*this));
     }
-    setBpm(bpm);
+    return setBpm(bpm);
 }
 
-void BeatGrid::setBpm(double dBpm) {
-    QMutexLocker locker(&m_mutex);
+BeatsPointer BeatGrid::setBpm(double dBpm) const {
+    std::unique_ptr<BeatGrid> pGrid(new BeatGrid(*this));
     if (dBpm > getMaxBpm()) {
         dBpm = getMaxBpm();
     }
-    m_grid.mutable_bpm()->set_bpm(dBpm);
-    m_dBeatLength = (60.0 * m_iSampleRate / dBpm) * kFrameSize;
-    locker.unlock();
-    emit updated();
+    pGrid->m_grid.mutable_bpm()->set_bpm(dBpm);
+    pGrid->m_dBeatLength = (60.0 * m_iSampleRate / dBpm) * kFrameSize;
+    return BeatsPointer(pGrid.release());
 }
 
 } // namespace mixxx
@@ -1,7 +1,5 @@
 #pragma once
 
-#include <QMutex>
-
 #include "proto/beats.pb.h"
 #include "track/beats.h"
 
@@ -28,8 +26,8 @@ class BeatGrid final : public Beats {
     ~BeatGrid() override = default;
 
     // Initializes the BeatGrid to have a BPM of dBpm and the first beat offset
-    // of dFirstBeatSample. Does not generate an updated() signal, since it is
-    // meant for initialization.
+    // of dFirstBeatSample. Only meant for initialization, before the BeatGrid
+    // is published.
     void setGrid(double dBpm, double dFirstBeatSample);
 
     // The following are all methods from the Beats interface, see method
@@ -40,7 +38,6 @@ class BeatGrid final : public Beats {
     }
 
     QByteArray toByteArray() const override;
-    BeatsPointer clone() const override;
     QString getVersion() const override;
     QString getSubVersion() const override;
     virtual void setSubVersion(const QString& subVersion);
@@ -66,11 +63,11 @@ class BeatGrid final : public Beats {
     // Beat mutations
     ////////////////////////////////////////////////////////////////////////////
 
-    void addBeat(double dBeatSample) override;
-    void removeBeat(double dBeatSample) override;
-    void translate(double dNumSamples) override;
-    void scale(enum BPMScale scale) override;
-    void setBpm(double dBpm) override;
+    BeatsPointer addBeat(double dBeatSample) const override;
+    BeatsPointer removeBeat(double dBeatSample) const override;
+    BeatsPointer translate(double dNumSamples) const override;
+    BeatsPointer scale(enum BPMScale scale) const override;
+    BeatsPointer setBpm(double dBpm) const override;
 
     SINT getSampleRate() const override {
         return m_iSampleRate;
@@ -85,7 +82,6 @@ class BeatGrid final : public Beats {
     // For internal use only.
     bool isValid() const;
 
-    mutable QMutex m_mutex;
     // The sub-version of this beatgrid.
     QString m_subVersion;
     // The number of samples per second
@@ -7,7 +7,6 @@
 
 #include "track/beatmap.h"
 
-#include <QMutexLocker>
 #include <QtDebug>
 #include <QtGlobal>
 #include <algorithm>
@@ -28,21 +27,18 @@ inline double framesToSamples(const int frames) {
     return frames * kFrameSize;
 }
 
-bool BeatLessThan(const Beat& beat1, const Beat& beat2) {
-    return beat1.frame_position() < beat2.frame_position();
+inline qint32 samplesToFramePosition(const double samples) {
+    return static_cast<qint32>(samplesToFrames(samples));
 }
 
 namespace mixxx {
 
 class BeatMapIterator : public BeatIterator {
   public:
-    BeatMapIterator(const BeatList::const_iterator& start, const BeatList::const_iterator& end)
+    BeatMapIterator(std::vector<qint32>::const_iterator start,
+            std::vector<qint32>::const_iterator end)
             : m_currentBeat(start),
               m_endBeat(end) {
-        // Advance to the first enabled beat.
-        while (m_currentBeat != m_endBeat && !m_currentBeat->enabled()) {
-            ++m_currentBeat;
-        }
     }
 
     bool hasNext() const override {
@@ -50,27 +46,18 @@ class BeatMapIterator : public BeatIterator {
     }
 
     double next() override {
-        double beat = framesToSamples(m_currentBeat->frame_position());
-        ++m_currentBeat;
-        while (m_currentBeat != m_endBeat && !m_currentBeat->enabled()) {
-            ++m_currentBeat;
-        }
-        return beat;
+        return framesToSamples(*m_currentBeat++);
     }
 
   private:
-    BeatList::const_iterator m_currentBeat;
-    BeatList::const_iterator m_endBeat;
+    std::vector<qint32>::const_iterator m_currentBeat;
+    std::vector<qint32>::const_iterator m_endBeat;
 };
 
 BeatMap::BeatMap(const Track& track, SINT iSampleRate)
-        : m_mutex(QMutex::Recursive),
-          m_iSampleRate(iSampleRate > 0 ? iSampleRate : track.getSampleRate()),
+        : m_iSampleRate(iSampleRate > 0 ? iSampleRate : track.getSampleRate()),
           m_dCachedBpm(0),
           m_dLastFrame(0) {
-    // BeatMap should live in the same thread as the track it is associated
-    // with.
-    moveToThread(track.thread());
 }
 
 BeatMap::BeatMap(const Track& track, SINT iSampleRate,
@@ -87,24 +74,30 @@ BeatMap::BeatMap(const Track& track, SINT iSampleRate,
     }
 }
 
-BeatMap::BeatMap (const BeatMap& other)
-        : m_mutex(QMutex::Recursive),
-          m_subVersion(other.m_subVersion),
+BeatMap::BeatMap(const BeatMap& other)
+        : m_subVersion(other.m_subVersion),
           m_iSampleRate(other.m_iSampleRate),
           m_dCachedBpm(other.m_dCachedBpm),
           m_dLastFrame(other.m_dLastFrame),
-          m_beats(other.m_beats) {
-    moveToThread(other.thread());
+          m_frames(other.m_frames),
+          m_disabledFrames(other.m_disabledFrames) {
 }
 
 QByteArray BeatMap::toByteArray() const {
-    QMutexLocker locker(&m_mutex);
-    // No guarantees BeatLists are made of a data type which located adjacent
-    // items in adjacent memory locations.
     mixxx::track::io::BeatMap map;
 
-    for (int i = 0; i < m_beats.size(); ++i) {
-        map.add_beat()->CopyFrom(m_beats[i]);
+    // Merge the enabled and disabled beats back into a single sorted list
+    auto enabledIt = m_frames.cbegin();
+    auto disabledIt = m_disabledFrames.cbegin();
+    while (enabledIt != m_frames.cend() || disabledIt != m_disabledFrames.cend()) {
+        Beat* pBeat = map.add_beat();
+        if (disabledIt == m_disabledFrames.cend() ||
+                (enabledIt != m_frames.cend() && *enabledIt < *disabledIt)) {
+            pBeat->set_frame_position(*enabledIt++);
+        } else {
+            pBeat->set_frame_position(*disabledIt++);
+            pBeat->set_enabled(false);
+        }
     }
 
     std::string output;
@@ -112,12 +105,6 @@ QByteArray BeatMap::toByteArray() const {
     return QByteArray(output.data(), static_cast<int>(output.length()));
 }
 
-BeatsPointer BeatMap::clone() const {
-    QMutexLocker locker(&m_mutex);
-    BeatsPointer other(new BeatMap(*this));
-    return other;
-}
-
 bool BeatMap::readByteArray(const QByteArray& byteArray) {
     mixxx::track::io::BeatMap map;
     if (!map.ParseFromArray(byteArray.constData(), byteArray.size())) {
@@ -125,9 +112,21 @@ bool BeatMap::readByteArray(const QByteArray& byteArray) {
                 << byteArray.size();
         return false;
     }
+    m_frames.reserve(map.beat_size());
     for (int i = 0; i < map.beat_size(); ++i) {
         const Beat& beat = map.beat(i);
-        m_beats.append(beat);
+        if (beat.enabled()) {
+            m_frames.push_back(beat.frame_position());
+        } else {
+            m_disabledFrames.push_back(beat.frame_position());
+        }
+    }
+    // Serialized beats are expected to be sorted, but the queries rely on it
+    if (!std::is_sorted(m_frames.cbegin(), m_frames.cend())) {
+        std::sort(m_frames.begin(), m_frames.end());
+    }
+    if (!std::is_sorted(m_disabledFrames.cbegin(), m_disabledFrames.cend())) {
+        std::sort(m_disabledFrames.begin(), m_disabledFrames.end());
     }
     onBeatlistChanged();
     return true;
@@ -138,7 +137,7 @@ void BeatMap::createFromBeatVector(const QVector<double>& beats) {
        return;
     }
     double previous_beatpos = -1;
-    Beat beat;
+    m_frames.reserve(beats.size());
 
     foreach (double beatpos, beats) {
         // beatpos is in frames. Do not accept fractional frames.
@@ -147,8 +146,7 @@ void BeatMap::createFromBeatVector(const QVector<double>& beats) {
             qDebug() << "BeatMap::createFromVector: beats not in increasing order or negative";
             qDebug() << "discarding beat " << beatpos;
         } else {
-            beat.set_frame_position(static_cast<google::protobuf::int32>(beatpos));
-            m_beats.append(beat);
+            m_frames.push_back(static_cast<qint32>(beatpos));
             previous_beatpos = beatpos;
         }
     }
@@ -156,12 +154,10 @@ void BeatMap::createFromBeatVector(const QVector<double>& beats) {
 }
 
 QString BeatMap::getVersion() const {
-    QMutexLocker locker(&m_mutex);
     return BEAT_MAP_VERSION;
 }
 
 QString BeatMap::getSubVersion() const {
-    QMutexLocker locker(&m_mutex);
     return m_subVersion;
 }
 
@@ -170,7 +166,31 @@ void BeatMap::setSubVersion(const QString& subVersion) {
 }
 
 bool BeatMap::isValid() const {
-    return m_iSampleRate > 0 && m_beats.size() > 0;
+    return m_iSampleRate > 0 && !m_frames.empty();
+}
+
+bool BeatMap::findPrevNextIndices(qint32 frame, int* pPrevIndex, int* pNextIndex) const {
+    // The first beat at or after the frame
+    int nextIndex = static_cast<int>(
+            std::lower_bound(m_frames.cbegin(), m_frames.cend(), frame) -
+            m_frames.cbegin());
+    int prevIndex = nextIndex - 1;
+
+    // If the position is within 1/10th of a second of the next or previous
+    // beat, pretend we are on that beat.
+    const double kFrameEpsilon = 0.1 * m_iSampleRate;
+    bool onBeat = false;
+    if (prevIndex >= 0 && frame - m_frames[prevIndex] < kFrameEpsilon) {
+        nextIndex = prevIndex;
+        onBeat = true;
+    } else if (nextIndex < static_cast<int>(m_frames.size()) &&
+            m_frames[nextIndex] - frame < kFrameEpsilon) {
+        prevIndex = nextIndex;
+        onBeat = true;
+    }
+    *pPrevIndex = prevIndex;
+    *pNextIndex = nextIndex;
+    return onBeat;
 }
 
 double BeatMap::findNextBeat(double dSamples) const {
@@ -182,7 +202,6 @@ double BeatMap::findPrevBeat(double dSamples) const {
 }
 
 double BeatMap::findClosestBeat(double dSamples) const {
-    QMutexLocker locker(&m_mutex);
     if (!isValid()) {
         return -1;
     }
@@ -199,96 +218,27 @@ double BeatMap::findClosestBeat(double dSamples) const {
 }
 
 double BeatMap::findNthBeat(double dSamples, int n) const {
-    QMutexLocker locker(&m_mutex);
 
     if (!isValid() || n == 0) {
         return -1;
     }
 
-    Beat beat;
-    // Reduce sample offset to a frame offset.
-    beat.set_frame_position(static_cast<google::protobuf::int32>(samplesToFrames(dSamples)));
-
-    // it points at the first occurrence of beat or the next largest beat
-    BeatList::const_iterator it =
-            std::lower_bound(m_beats.constBegin(), m_beats.constEnd(), beat, BeatLessThan);
-
-    // If the position is within 1/10th of a second of the next or previous
-    // beat, pretend we are on that beat.
-    const double kFrameEpsilon = 0.1 * m_iSampleRate;
-
-    // Back-up by one.
-    if (it != m_beats.begin()) {
-        --it;
-    }
-
-    // Scan forward to find whether we are on a beat.
-    BeatList::const_iterator on_beat = m_beats.constEnd();
-    BeatList::const_iterator previous_beat = m_beats.constEnd();
-    BeatList::const_iterator next_beat = m_beats.constEnd();
-    for (; it != m_beats.end(); ++it) {
-        qint32 delta = it->frame_position() - beat.frame_position();
+    int prevIndex;
+    int nextIndex;
+    findPrevNextIndices(samplesToFramePosition(dSamples), &prevIndex, &nextIndex);
 
-        // We are "on" this beat.
-        if (abs(delta) < kFrameEpsilon) {
-            on_beat = it;
-            break;
-        }
-
-        if (delta < 0) {
-            // If we are not on the beat and delta < 0 then this beat comes
-            // before our current position.
-            previous_beat = it;
-        } else {
-            // If we are past the beat and we aren't on it then this beat comes
-            // after our current position.
-            next_beat = it;
-            // Stop because we have everything we need now.
-            break;
-        }
-    }
-
-    // If we are within epsilon samples of a beat then the immediately next and
-    // previous beats are the beat we are on.
-    if (on_beat != m_beats.end()) {
-        next_beat = on_beat;
-        previous_beat = on_beat;
-    }
-
-    if (n > 0) {
-        for (; next_beat != m_beats.end(); ++next_beat) {
-            if (!next_beat->enabled()) {
-                continue;
-            }
-            if (n == 1) {
-                // Return a sample offset
-                return framesToSamples(next_beat->frame_position());
-            }
-            --n;
-        }
-    } else if (n < 0 && previous_beat != m_beats.end()) {
-        for (; true; --previous_beat) {
-            if (previous_beat->enabled()) {
-                if (n == -1) {
-                    // Return a sample offset
-                    return framesToSamples(previous_beat->frame_position());
-                }
-                ++n;
-            }
-
-            // Don't step before the start of the list.
-            if (previous_beat == m_beats.begin()) {
-                break;
-            }
-        }
+    // Counting starts with the beat we are on or the next/previous one
+    const int index = n > 0 ? nextIndex + n - 1 : prevIndex + n + 1;
+    if (index < 0 || index >= static_cast<int>(m_frames.size())) {
+        return -1;
     }
-    return -1;
+    // Return a sample offset
+    return framesToSamples(m_frames[index]);
 }
 
 bool BeatMap::findPrevNextBeats(double dSamples,
                                 double* dpPrevBeatSamples,
                                 double* dpNextBeatSamples) const {
-    QMutexLocker locker(&m_mutex);
 
     if (!isValid()) {
         *dpPrevBeatSamples = -1;
@@ -296,102 +246,33 @@ bool BeatMap::findPrevNextBeats(double dSamples,
         return false;
     }
 
-    Beat beat;
-    // Reduce sample offset to a frame offset.
-    beat.set_frame_position(static_cast<google::protobuf::int32>(samplesToFrames(dSamples)));
-
-    // it points at the first occurrence of beat or the next largest beat
-    BeatList::const_iterator it =
-            std::lower_bound(m_beats.constBegin(), m_beats.constEnd(), beat, BeatLessThan);
-
-    // If the position is within 1/10th of a second of the next or previous
-    // beat, pretend we are on that beat.
-    const double kFrameEpsilon = 0.1 * m_iSampleRate;
-
-    // Back-up by one.
-    if (it != m_beats.begin()) {
-        --it;
-    }
-
-    // Scan forward to find whether we are on a beat.
-    BeatList::const_iterator on_beat = m_beats.constEnd();
-    BeatList::const_iterator previous_beat = m_beats.constEnd();
-    BeatList::const_iterator next_beat = m_beats.constEnd();
-    for (; it != m_beats.end(); ++it) {
-        qint32 delta = it->frame_position() - beat.frame_position();
-
-        // We are "on" this beat.
-        if (abs(delta) < kFrameEpsilon) {
-            on_beat = it;
-            break;
-        }
-
-        if (delta < 0) {
-            // If we are not on the beat and delta < 0 then this beat comes
-            // before our current position.
-            previous_beat = it;
-        } else {
-            // If we are past the beat and we aren't on it then this beat comes
-            // after our current position.
-            next_beat = it;
-            // Stop because we have everything we need now.
-            break;
-        }
-    }
-
-    // If we are within epsilon samples of a beat then the immediately next and
-    // previous beats are the beat we are on.
-    if (on_beat != m_beats.end()) {
-        previous_beat = on_beat;
-        next_beat = on_beat + 1;
+    int prevIndex;
+    int nextIndex;
+    if (findPrevNextIndices(samplesToFramePosition(dSamples), &prevIndex, &nextIndex)) {
+        // If we are on a beat, it is the previous one.
+        nextIndex = prevIndex + 1;
     }
 
-    *dpPrevBeatSamples = -1;
-    *dpNextBeatSamples = -1;
-
-    for (; next_beat != m_beats.end(); ++next_beat) {
-        if (!next_beat->enabled()) {
-            continue;
-        }
-        *dpNextBeatSamples = framesToSamples(next_beat->frame_position());
-        break;
-    }
-    if (previous_beat != m_beats.end()) {
-        for (; true; --previous_beat) {
-            if (previous_beat->enabled()) {
-                *dpPrevBeatSamples = framesToSamples(previous_beat->frame_position());
-                break;
-            }
-
-            // Don't step before the start of the list.
-            if (previous_beat == m_beats.begin()) {
-                break;
-            }
-        }
-    }
+    *dpPrevBeatSamples = prevIndex >= 0 ? framesToSamples(m_frames[prevIndex]) : -1;
+    *dpNextBeatSamples = nextIndex < static_cast<int>(m_frames.size())
+            ? framesToSamples(m_frames[nextIndex])
+            : -1;
     return *dpPrevBeatSamples != -1 && *dpNextBeatSamples != -1;
 }
 
 std::unique_ptr<BeatIterator> BeatMap::findBeats(double startSample, double stopSample) const {
-    QMutexLocker locker(&m_mutex);
     //startSample and stopSample are sample offsets, converting them to
     //frames
     if (!isValid() || startSample > stopSample) {
         return std::unique_ptr<BeatIterator>();
     }
 
-    Beat startBeat, stopBeat;
-    startBeat.set_frame_position(
-            static_cast<google::protobuf::int32>(samplesToFrames(startSample)));
-    stopBeat.set_frame_position(static_cast<google::protobuf::int32>(samplesToFrames(stopSample)));
-
-    BeatList::const_iterator curBeat =
-            std::lower_bound(m_beats.constBegin(), m_beats.constEnd(),
-                        startBeat, BeatLessThan);
-
-    BeatList::const_iterator lastBeat =
-            std::upper_bound(m_beats.constBegin(), m_beats.constEnd(),
-                        stopBeat, BeatLessThan);
+    const auto curBeat = std::lower_bound(m_frames.cbegin(),
+            m_frames.cend(),
+            samplesToFramePosition(startSample));
+    const auto lastBeat = std::upper_bound(m_frames.cbegin(),
+            m_frames.cend(),
+            samplesToFramePosition(stopSample));
 
     if (curBeat >= lastBeat) {
         return std::unique_ptr<BeatIterator>();
@@ -400,7 +281,6 @@ std::unique_ptr<BeatIterator> BeatMap::findBeats(double startSample, double stop
 }
 
 bool BeatMap::hasBeatInRange(double startSample, double stopSample) const {
-    QMutexLocker locker(&m_mutex);
     if (!isValid() || startSample > stopSample) {
         return false;
     }
@@ -412,7 +292,6 @@ bool BeatMap::hasBeatInRange(double startSample, double stopSample) const {
 }
 
 double BeatMap::getBpm() const {
-    QMutexLocker locker(&m_mutex);
     if (!isValid()) {
         return -1;
     }
@@ -420,256 +299,181 @@ double BeatMap::getBpm() const {
 }
 
 double BeatMap::getBpmRange(double startSample, double stopSample) const {
-    QMutexLocker locker(&m_mutex);
     if (!isValid()) {
         return -1;
     }
-    Beat startBeat, stopBeat;
-    startBeat.set_frame_position(
-            static_cast<google::protobuf::int32>(samplesToFrames(startSample)));
-    stopBeat.set_frame_position(static_cast<google::protobuf::int32>(samplesToFrames(stopSample)));
-    return calculateBpm(startBeat, stopBeat);
+    const qint32 startFrame = samplesToFramePosition(startSample);
+    const qint32 stopFrame = samplesToFramePosition(stopSample);
+    if (startFrame > stopFrame) {
+        return -1;
+    }
+    const int firstIndex = static_cast<int>(
+            std::lower_bound(m_frames.cbegin(), m_frames.cend(), startFrame) -
+            m_frames.cbegin());
+    const int lastIndex = static_cast<int>(
+            std::upper_bound(m_frames.cbegin(), m_frames.cend(), stopFrame) -
+            m_frames.cbegin()) - 1;
+    return calculateBpm(firstIndex, lastIndex);
 }
 
 double BeatMap::getBpmAroundPosition(double curSample, int n) const {
-    QMutexLocker locker(&m_mutex);
     if (!isValid()) {
         return -1;
     }
 
-    // To make sure we are always counting n beats, iterate backward to the
-    // lower bound, then iterate forward from there to the upper bound.
-    // a value of -1 indicates we went off the map -- count from the beginning.
-    double lower_bound = findNthBeat(curSample, -n);
-    if (lower_bound == -1) {
-        lower_bound = framesToSamples(m_beats.first().frame_position());
+    const int lastIndex = static_cast<int>(m_frames.size()) - 1;
+    if (n <= 0) {
+        return calculateBpm(0, lastIndex);
     }
 
-    // If we hit the end of the beat map, recalculate the lower bound.
-    double upper_bound = findNthBeat(lower_bound, n * 2);
-    if (upper_bound == -1) {
-        upper_bound = framesToSamples(m_beats.last().frame_position());
-        lower_bound = findNthBeat(upper_bound, n * -2);
-        // Super edge-case -- the track doesn't have n beats!  Do the best
-        // we can.
-        if (lower_bound == -1) {
-            lower_bound = framesToSamples(m_beats.first().frame_position());
-        }
-    }
+    // To make sure we are always counting n * 2 beats, step back n beats to
+    // the lower bound. If we went off the map, count from the beginning.
+    int prevIndex;
+    int nextIndex;
+    findPrevNextIndices(samplesToFramePosition(curSample), &prevIndex, &nextIndex);
+    const int lowerIndex = math_max(prevIndex - n + 1, 0);
 
-    Beat startBeat, stopBeat;
-    startBeat.set_frame_position(
-            static_cast<google::protobuf::int32>(samplesToFrames(lower_bound)));
-    stopBeat.set_frame_position(static_cast<google::protobuf::int32>(samplesToFrames(upper_bound)));
-    return calculateBpm(startBeat, stopBeat);
+    // If we hit the end of the beat map, move the lower bound back. If the
+    // track doesn't have n * 2 beats, do the best we can.
+    const int upperIndex = math_min(lowerIndex + n * 2 - 1, lastIndex);
+    return calculateBpm(math_max(upperIndex - n * 2 + 1, 0), upperIndex);
 }
 
-void BeatMap::addBeat(double dBeatSample) {
-    QMutexLocker locker(&m_mutex);
-    Beat beat;
-    beat.set_frame_position(static_cast<google::protobuf::int32>(samplesToFrames(dBeatSample)));
-    BeatList::iterator it = std::lower_bound(
-        m_beats.begin(), m_beats.end(), beat, BeatLessThan);
+BeatsPointer BeatMap::addBeat(double dBeatSample) const {
+    std::unique_ptr<BeatMap> pMap(new BeatMap(*this));
+    const qint32 frame = samplesToFramePosition(dBeatSample);
+    auto it = std::lower_bound(pMap->m_frames.begin(), pMap->m_frames.end(), frame);
 
     // Don't insert a duplicate beat. TODO(XXX) determine what epsilon to
     // consider a beat identical to another.
-    if (it != m_beats.end() && it->frame_position() == beat.frame_position()) {
-        return;
+    if ((it != pMap->m_frames.end() && *it == frame) ||
+            std::binary_search(m_disabledFrames.cbegin(), m_disabledFrames.cend(), frame)) {
+        return BeatsPointer(pMap.release());
     }
 
-    m_beats.insert(it, beat);
-    onBeatlistChanged();
-    locker.unlock();
-    emit updated();
+    pMap->m_frames.insert(it, frame);
+    pMap->onBeatlistChanged();
+    return BeatsPointer(pMap.release());
 }
 
-void BeatMap::removeBeat(double dBeatSample) {
-    QMutexLocker locker(&m_mutex);
-    Beat beat;
-    beat.set_frame_position(static_cast<google::protobuf::int32>(samplesToFrames(dBeatSample)));
-    BeatList::iterator it = std::lower_bound(
-        m_beats.begin(), m_beats.end(), beat, BeatLessThan);
+BeatsPointer BeatMap::removeBeat(double dBeatSample) const {
+    std::unique_ptr<BeatMap> pMap(new BeatMap(*this));
+    const qint32 frame = samplesToFramePosition(dBeatSample);
 
-    // In case there are duplicates, remove every instance of dBeatSample
-    // TODO(XXX) add invariant checks against this
+    // Remove the beat, whether it is enabled or not
     // TODO(XXX) determine what epsilon to consider a beat identical to another
-    while (it->frame_position() == beat.frame_position()) {
-        it = m_beats.erase(it);
-    }
-    onBeatlistChanged();
-    locker.unlock();
-    emit updated();
-}
-
-void BeatMap::translate(double dNumSamples) {
-    QMutexLocker locker(&m_mutex);
+    std::vector<qint32>& frames = pMap->m_frames;
+    const auto enabledRange = std::equal_range(frames.begin(), frames.end(), frame);
+    frames.erase(enabledRange.first, enabledRange.second);
+    std::vector<qint32>& disabledFrames = pMap->m_disabledFrames;
+    const auto disabledRange = std::equal_range(
+            disabledFrames.begin(), disabledFrames.end(), frame);
+    disabledFrames.erase(disabledRange.first, disabledRange.second);
+    pMap->onBeatlistChanged();
+    return BeatsPointer(pMap.release());
+}
+
+BeatsPointer BeatMap::translate(double dNumSamples) const {
+    std::unique_ptr<BeatMap> pMap(new BeatMap(*this));
     // Converting to frame offset
     if (!isValid()) {
-        return;
+        return BeatsPointer(pMap.release());
     }
 
-    double dNumFrames = samplesToFrames(dNumSamples);
-    for (BeatList::iterator it = m_beats.begin();
-         it != m_beats.end(); ) {
-        double newpos = it->frame_position() + dNumFrames;
-        if (newpos >= 0) {
-            it->set_frame_position(static_cast<google::protobuf::int32>(newpos));
-            ++it;
-        } else {
-            it = m_beats.erase(it);
+    const double dNumFrames = samplesToFrames(dNumSamples);
+    const auto translateFrames = [dNumFrames](std::vector<qint32>* pFrames) {
+        // Beats that would be moved before the start of the track are removed
+        const auto firstKept = std::lower_bound(
+                pFrames->cbegin(), pFrames->cend(), -dNumFrames);
+        pFrames->erase(pFrames->cbegin(), firstKept);
+        for (auto& frame : *pFrames) {
+            frame = static_cast<qint32>(frame + dNumFrames);
         }
-    }
-    onBeatlistChanged();
-    locker.unlock();
-    emit updated();
+    };
+    translateFrames(&pMap->m_frames);
+    translateFrames(&pMap->m_disabledFrames);
+    pMap->onBeatlistChanged();
+    return BeatsPointer(pMap.release());
 }
 
-void BeatMap::scale(enum BPMScale scale) {
-
-    QMutexLocker locker(&m_mutex);
-    if (!isValid() || m_beats.isEmpty()) {
-        return;
+BeatsPointer BeatMap::scale(enum BPMScale scale) const {
+    std::unique_ptr<BeatMap> pMap(new BeatMap(*this));
+    if (!isValid()) {
+        return BeatsPointer(pMap.release());
     }
 
+    // Disabled beats are not moved, they keep their position.
     switch (scale) {
     case DOUBLE:
         // introduce a new beat into every gap
-        scaleDouble();
+        pMap->scaleSplit(2);
         break;
     case HALVE:
         // remove every second beat
-        scaleHalve();
+        pMap->scaleKeepEvery(2);
         break;
     case TWOTHIRDS:
         // introduce a new beat into every gap
-        scaleDouble();
+        pMap->scaleSplit(2);
         // remove every second and third beat
-        scaleThird();
+        pMap->scaleKeepEvery(3);
         break;
     case THREEFOURTHS:
         // introduce two beats into every gap
-        scaleTriple();
+        pMap->scaleSplit(3);
         // remove every second third and forth beat
-        scaleFourth();
+        pMap->scaleKeepEvery(4);
         break;
     case FOURTHIRDS:
         // introduce three beats into every gap
-        scaleQuadruple();
+        pMap->scaleSplit(4);
         // remove every second third and forth beat
-        scaleThird();
+        pMap->scaleKeepEvery(3);
         break;
     case THREEHALVES:
         // introduce two beats into every gap
-        scaleTriple();
+        pMap->scaleSplit(3);
         // remove every second beat
-        scaleHalve();
+        pMap->scaleKeepEvery(2);
         break;
     default:
         DEBUG_ASSERT(!"scale value invalid");
-        return;
+        return BeatsPointer(pMap.release());
     }
-    onBeatlistChanged();
-    locker.unlock();
-    emit updated();
+    pMap->onBeatlistChanged();
+    return BeatsPointer(pMap.release());
 }
 
-void BeatMap::scaleDouble() {
-    Beat prevBeat = m_beats.first();
-    // Skip the first beat to preserve the first beat in a measure
-    BeatList::iterator it = m_beats.begin() + 1;
-    for (; it != m_beats.end(); ++it) {
+void BeatMap::scaleSplit(int parts) {
+    std::vector<qint32> frames;
+    frames.reserve((m_frames.size() - 1) * parts + 1);
+    // Keep the first beat to preserve the first beat in a measure
+    frames.push_back(m_frames.front());
+    for (size_t i = 1; i < m_frames.size(); ++i) {
+        const qint32 prevFrame = m_frames[i - 1];
         // Need to not accrue fractional frames.
-        int distance = it->frame_position() - prevBeat.frame_position();
-        Beat beat;
-        beat.set_frame_position(prevBeat.frame_position() + distance / 2);
-        it = m_beats.insert(it, beat);
-        prevBeat = (++it)[0];
-    }
-}
-
-void BeatMap::scaleTriple() {
-    Beat prevBeat = m_beats.first();
-    // Skip the first beat to preserve the first beat in a measure
-    BeatList::iterator it = m_beats.begin() + 1;
-    for (; it != m_beats.end(); ++it) {
-        // Need to not accrue fractional frames.
-        int distance = it->frame_position() - prevBeat.frame_position();
-        Beat beat;
-        beat.set_frame_position(prevBeat.frame_position() + distance / 3);
-        it = m_beats.insert(it, beat);
-        ++it;
-        beat.set_frame_position(prevBeat.frame_position() + distance * 2 / 3);
-        it = m_beats.insert(it, beat);
-        prevBeat = (++it)[0];
-    }
-}
-
-void BeatMap::scaleQuadruple() {
-    Beat prevBeat = m_beats.first();
-    // Skip the first beat to preserve the first beat in a measure
-    BeatList::iterator it = m_beats.begin() + 1;
-    for (; it != m_beats.end(); ++it) {
-        // Need to not accrue fractional frames.
-        int distance = it->frame_position() - prevBeat.frame_position();
-        Beat beat;
-        for (int i = 1; i <= 3; i++) {
-            beat.set_frame_position(prevBeat.frame_position() + distance * i / 4);
-            it = m_beats.insert(it, beat);
-            ++it;
-        }
-        prevBeat = it[0];
-    }
-}
-
-void BeatMap::scaleHalve() {
-    // Skip the first beat to preserve the first beat in a measure
-    BeatList::iterator it = m_beats.begin() + 1;
-    for (; it != m_beats.end(); ++it) {
-        it = m_beats.erase(it);
-        if (it == m_beats.end()) {
-            break;
-        }
-    }
-}
-
-void BeatMap::scaleThird() {
-    // Skip the first beat to preserve the first beat in a measure
-    BeatList::iterator it = m_beats.begin() + 1;
-    for (; it != m_beats.end(); ++it) {
-        it = m_beats.erase(it);
-        if (it == m_beats.end()) {
-            break;
-        }
-        it = m_beats.erase(it);
-        if (it == m_beats.end()) {
-            break;
+        const int distance = m_frames[i] - prevFrame;
+        for (int part = 1; part < parts; ++part) {
+            frames.push_back(prevFrame + distance * part / parts);
         }
+        frames.push_back(m_frames[i]);
     }
+    m_frames = std::move(frames);
 }
 
-void BeatMap::scaleFourth() {
-    // Skip the first beat to preserve the first beat in a measure
-    BeatList::iterator it = m_beats.begin() + 1;
-    for (; it != m_beats.end(); ++it) {
-        it = m_beats.erase(it);
-        if (it == m_beats.end()) {
-            break;
-        }
-        it = m_beats.erase(it);
-        if (it == m_beats.end()) {
-            break;
-        }
-        it = m_beats.erase(it);
-        if (it == m_beats.end()) {
-            break;
-        }
+void BeatMap::scaleKeepEvery(int nth) {
+    // Keep the first beat to preserve the first beat in a measure
+    size_t keptCount = 0;
+    for (size_t i = 0; i < m_frames.size(); i += nth) {
+        m_frames[keptCount++] = m_frames[i];
     }
+    m_frames.resize(keptCount);
 }
 
-void BeatMap::setBpm(double dBpm) {
+BeatsPointer BeatMap::setBpm(double dBpm) const {
     Q_UNUSED(dBpm);
     DEBUG_ASSERT(!"BeatMap::setBpm() not implemented");
-    return;
+    return BeatsPointer(new BeatMap(*this));
 
     /*
      * One of the problems of beattracking algorithms is the so called "octave error"
@@ -702,35 +506,30 @@ void BeatMap::onBeatlistChanged() {
         m_dCachedBpm = 0;
         return;
     }
-    m_dLastFrame = m_beats.last().frame_position();
-    Beat startBeat = m_beats.first();
-    Beat stopBeat =  m_beats.last();
-    m_dCachedBpm = calculateBpm(startBeat, stopBeat);
+    m_dLastFrame = m_frames.back();
+    m_dCachedBpm = calculateBpm(0, static_cast<int>(m_frames.size()) - 1);
 }
 
-double BeatMap::calculateBpm(const Beat& startBeat, const Beat& stopBeat) const {
-    if (startBeat.frame_position() > stopBeat.frame_position()) {
+double BeatMap::calculateBpm(int firstIndex, int lastIndex) const {
+    if (firstIndex > lastIndex) {
         return -1;
     }
 
-    BeatList::const_iterator curBeat =
-            std::lower_bound(m_beats.constBegin(), m_beats.constEnd(), startBeat, BeatLessThan);
-
-    BeatList::const_iterator lastBeat =
-            std::upper_bound(m_beats.constBegin(), m_beats.constEnd(), stopBeat, BeatLessThan);
-
-    QVector<double> beatvect;
-    for (; curBeat != lastBeat; ++curBeat) {
-        const Beat& beat = *curBeat;
-        if (beat.enabled()) {
-            beatvect.append(beat.frame_position());
-        }
+    // Averaging over a few beats only needs the first and last one, which
+    // keeps the local BPM lookups of the engine free of allocations.
+    const int numberOfBeats = lastIndex - firstIndex + 1;
+    if (numberOfBeats <= BeatUtils::maxBeatsForAverageBpm()) {
+        return BeatUtils::calculateAverageBpm(numberOfBeats,
+                m_iSampleRate,
+                m_frames[firstIndex],
+                m_frames[lastIndex]);
     }
 
-    if (beatvect.isEmpty()) {
-        return -1;
+    QVector<double> beatvect;
+    beatvect.reserve(numberOfBeats);
+    for (int i = firstIndex; i <= lastIndex; ++i) {
+        beatvect.append(m_frames[i]);
     }
-
     return BeatUtils::calculateBpm(beatvect, m_iSampleRate, 0, 9999);
 }
 
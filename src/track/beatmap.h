@@ -7,7 +7,7 @@
 
 #pragma once
 
-#include <QMutex>
+#include <vector>
 
 #include "proto/beats.pb.h"
 #include "track/beats.h"
@@ -16,8 +16,6 @@
 
 class Track;
 
-typedef QList<mixxx::track::io::Beat> BeatList;
-
 namespace mixxx {
 
 class BeatMap final : public Beats {
@@ -48,7 +46,6 @@ class BeatMap final : public Beats {
     }
 
     QByteArray toByteArray() const override;
-    BeatsPointer clone() const override;
     QString getVersion() const override;
     QString getSubVersion() const override;
     virtual void setSubVersion(const QString& subVersion);
@@ -75,11 +72,11 @@ class BeatMap final : public Beats {
     // Beat mutations
     ////////////////////////////////////////////////////////////////////////////
 
-    void addBeat(double dBeatSample) override;
-    void removeBeat(double dBeatSample) override;
-    void translate(double dNumSamples) override;
-    void scale(enum BPMScale scale) override;
-    void setBpm(double dBpm) override;
+    BeatsPointer addBeat(double dBeatSample) const override;
+    BeatsPointer removeBeat(double dBeatSample) const override;
+    BeatsPointer translate(double dNumSamples) const override;
+    BeatsPointer scale(enum BPMScale scale) const override;
+    BeatsPointer setBpm(double dBpm) const override;
 
     SINT getSampleRate() const override {
         return m_iSampleRate;
@@ -91,24 +88,30 @@ class BeatMap final : public Beats {
     void createFromBeatVector(const QVector<double>& beats);
     void onBeatlistChanged();
 
-    double calculateBpm(const mixxx::track::io::Beat& startBeat,
-                        const mixxx::track::io::Beat& stopBeat) const;
+    // Returns the indices of the enabled beats before and after the frame.
+    // If the frame is close to a beat, both are the index of that beat and
+    // true is returned. An index is -1 or size() if there is no such beat.
+    bool findPrevNextIndices(qint32 frame, int* pPrevIndex, int* pNextIndex) const;
+    // The BPM of the enabled beats with indices [firstIndex, lastIndex]
+    double calculateBpm(int firstIndex, int lastIndex) const;
     // For internal use only.
     bool isValid() const;
 
-    void scaleDouble();
-    void scaleTriple();
-    void scaleQuadruple();
-    void scaleHalve();
-    void scaleThird();
-    void scaleFourth();
+    // Splits every gap between two beats into equal parts
+    void scaleSplit(int parts);
+    // Keeps the first and every nth beat after it
+    void scaleKeepEvery(int nth);
 
-    mutable QMutex m_mutex;
     QString m_subVersion;
     SINT m_iSampleRate;
     double m_dCachedBpm;
     double m_dLastFrame;
-    BeatList m_beats;
+    // The sorted frame positions of all enabled beats. This is what every
+    // query searches, so it is kept contiguous and free of disabled beats.
+    std::vector<qint32> m_frames;
+    // The sorted frame positions of the disabled beats. They are only kept
+    // to be written back when serializing.
+    std::vector<qint32> m_disabledFrames;
 };
 
 } // namespace mixxx
@@ -16,7 +16,8 @@ namespace {
 namespace mixxx {
 
 class Beats;
-typedef QSharedPointer<Beats> BeatsPointer;
+// Beats are immutable snapshots that can be shared between threads
+typedef QSharedPointer<const Beats> BeatsPointer;
 
 class BeatIterator {
   public:
@@ -28,11 +29,16 @@ class BeatIterator {
 // Beats is a pure abstract base class for BPM and beat management classes. It
 // provides a specification of all methods a beat-manager class must provide, as
 // well as a capability model for representing optional features.
-class Beats : public QObject {
-    Q_OBJECT
+//
+// A Beats object is immutable once it has been published in a BeatsPointer.
+// All queries are const and do not lock, so the engine can use a snapshot
+// from the audio callback while a new one is being built. The mutations
+// return a modified copy, which replaces the snapshot of the track with
+// Track::setBeats().
+class Beats {
   public:
     Beats() { }
-    ~Beats() override = default;
+    virtual ~Beats() = default;
 
     enum Capabilities {
         BEATSCAP_NONE          = 0x0000,
@@ -57,7 +63,6 @@ class Beats : public QObject {
 
     // Serialization
     virtual QByteArray toByteArray() const = 0;
-    virtual BeatsPointer clone() const = 0;
 
     // A string representing the version of the beat-processing code that
     // produced this Beats instance. Used by BeatsFactory for associating a
@@ -108,7 +113,7 @@ class Beats : public QObject {
     // then dSamples is returned. If no beat can be found, returns -1.
     virtual double findNthBeat(double dSamples, int n) const = 0;
 
-    int numBeatsInRange(double dStartSample, double dEndSample);
+    int numBeatsInRange(double dStartSample, double dEndSample) const;
 
     // Find the sample N beats away from dSample. The number of beats may be
     // negative and does not need to be an integer.
@@ -145,31 +150,30 @@ class Beats : public QObject {
     // Beat mutations
     ////////////////////////////////////////////////////////////////////////////
 
+    // The mutations leave this object unchanged and return a modified copy.
+
     // Add a beat at location dBeatSample. Beats instance must have the
     // capability BEATSCAP_ADDREMOVE.
-    virtual void addBeat(double dBeatSample) = 0;
+    virtual BeatsPointer addBeat(double dBeatSample) const = 0;
 
     // Remove a beat at location dBeatSample. Beats instance must have the
     // capability BEATSCAP_ADDREMOVE.
-    virtual void removeBeat(double dBeatSample) = 0;
+    virtual BeatsPointer removeBeat(double dBeatSample) const = 0;
 
     // Translate all beats in the song by dNumSamples samples. Beats that lie
     // before the start of the track or after the end of the track are not
     // removed. Beats instance must have the capability BEATSCAP_TRANSLATE.
-    virtual void translate(double dNumSamples) = 0;
+    virtual BeatsPointer translate(double dNumSamples) const = 0;
 
     // Scale the position of every beat in the song by dScalePercentage. Beats
     // class must have the capability BEATSCAP_SCALE.
-    virtual void scale(enum BPMScale scale) = 0;
+    virtual BeatsPointer scale(enum BPMScale scale) const = 0;
 
     // Adjust the beats so the global average BPM matches dBpm. Beats class must
     // have the capability BEATSCAP_SET.
-    virtual void setBpm(double dBpm) = 0;
+    virtual BeatsPointer setBpm(double dBpm) const = 0;
 
     virtual SINT getSampleRate() const = 0;
-
-  signals:
-    void updated();
 };
 
 } // namespace mixxx
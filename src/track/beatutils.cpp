@@ -149,6 +149,18 @@ double BeatUtils::computeFilteredWeightedAverage(
     return filterWeightedAverage / static_cast<double>(filterSum);
 }
 
+int BeatUtils::maxBeatsForAverageBpm() {
+    return N;
+}
+
+double BeatUtils::calculateAverageBpm(int numberOfBeats, int SampleRate,
+        double firstBeat, double lastBeat) {
+    if (numberOfBeats < 2) {
+        return 0;
+    }
+    return 60.0 * (numberOfBeats - 1) * SampleRate / (lastBeat - firstBeat);
+}
+
 double BeatUtils::calculateBpm(const QVector<double>& beats, int SampleRate,
                                int min_bpm, int max_bpm) {
     /*
@@ -191,7 +203,7 @@ double BeatUtils::calculateBpm(const QVector<double>& beats, int SampleRate,
     // If we don't have enough beats for our regular approach, just divide the #
     // of beats by the duration in minutes.
     if (beats.size() <= N) {
-        return 60.0 * (beats.size()-1) * SampleRate / (beats.last() - beats.first());
+        return calculateAverageBpm(beats.size(), SampleRate, beats.first(), beats.last());
     }
 
     QMap<double, int> frequency_table;
@@ -43,6 +43,12 @@ class BeatUtils {
      */
     static double calculateBpm(const QVector<double>& beats, int SampleRate,
                                int min_bpm, int max_bpm);
+
+    // calculateBpm() returns the plain average BPM of up to this many beats,
+    // which calculateAverageBpm() computes from the first and last beat only.
+    static int maxBeatsForAverageBpm();
+    static double calculateAverageBpm(int numberOfBeats, int SampleRate,
+            double firstBeat, double lastBeat);
     static double findFirstCorrectBeat(const QVector<double>& rawBeats,
             const int SampleRate,
             const double global_bpm);
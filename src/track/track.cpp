@@ -168,8 +168,16 @@ void Track::importMetadata(
         if (m_record.getMetadata() != importedMetadata) {
             modifiedReplayGain =
                     (m_record.getMetadata().getTrackInfo().getReplayGain() != newReplayGain);
+            if (modifiedReplayGain) {
+                // The imported ReplayGain has not been calculated by
+                // any of our analyzers
+                m_record.setReplayGainVersion(QString());
+            }
             m_record.setMetadata(std::move(importedMetadata));
             // Don't use importedMetadata after move assignment!!
+            // The file has been modified and the fingerprint of the
+            // audio stream might be outdated.
+            m_record.setFingerprint(QString());
             modified = true;
         }
         if (modified) {
@@ -257,6 +265,18 @@ void Track::setReplayGain(const mixxx::ReplayGain& replayGain) {
     }
 }
 
+QString Track::getReplayGainVersion() const {
+    QMutexLocker lock(&m_qMutex);
+    return m_record.getReplayGainVersion();
+}
+
+void Track::setReplayGainVersion(const QString& replayGainVersion) {
+    QMutexLocker lock(&m_qMutex);
+    if (compareAndSet(m_record.ptrReplayGainVersion(), replayGainVersion)) {
+        markDirtyAndUnlock(&lock);
+    }
+}
+
 double Track::getBpm() const {
     double bpm = mixxx::Bpm::kValueUndefined;
     QMutexLocker lock(&m_qMutex);
@@ -295,11 +315,8 @@ double Track::setBpm(double bpmValue) {
         if (kLogger.debugEnabled()) {
             kLogger.debug() << "Updating BPM:" << getLocation();
         }
-        m_pBeats->setBpm(bpmValue);
-        markDirtyAndUnlock(&lock);
-        // Tell the GUI to update the bpm label...
-        //qDebug() << "Track signaling BPM update to" << f;
-        emit bpmUpdated(bpmValue);
+        // Publish a new snapshot, the old one may still be in use
+        setBeatsMarkDirtyAndUnlock(&lock, m_pBeats->setBpm(bpmValue));
     }
 
     return bpmValue;
@@ -315,23 +332,15 @@ void Track::setBeats(mixxx::BeatsPointer pBeats) {
 }
 
 bool Track::setBeatsWhileLocked(mixxx::BeatsPointer pBeats) {
-    // This whole method is not so great. The fact that Beats is an ABC is
-    // limiting with respect to QObject and signals/slots.
-
     if (m_pBeats == pBeats) {
         return false;
     }
 
-    if (m_pBeats) {
-        disconnect(m_pBeats.data(), &mixxx::Beats::updated, this, &Track::slotBeatsUpdated);
-    }
-
     m_pBeats = std::move(pBeats);
 
     auto bpmValue = mixxx::Bpm::kValueUndefined;
     if (m_pBeats) {
         bpmValue = m_pBeats->getBpm();
-        connect(m_pBeats.data(), &mixxx::Beats::updated, this, &Track::slotBeatsUpdated);
     }
     m_record.refMetadata().refTrackInfo().setBpm(mixxx::Bpm(bpmValue));
     return true;
@@ -356,20 +365,6 @@ mixxx::BeatsPointer Track::getBeats() const {
     return m_pBeats;
 }
 
-void Track::slotBeatsUpdated() {
-    QMutexLocker lock(&m_qMutex);
-
-    auto bpmValue = mixxx::Bpm::kValueUndefined;
-    if (m_pBeats) {
-        bpmValue = m_pBeats->getBpm();
-    }
-    m_record.refMetadata().refTrackInfo().setBpm(mixxx::Bpm(bpmValue));
-
-    markDirtyAndUnlock(&lock);
-    emit bpmUpdated(bpmValue);
-    emit beatsUpdated();
-}
-
 void Track::setMetadataSynchronized(bool metadataSynchronized) {
     QMutexLocker lock(&m_qMutex);
     if (compareAndSet(m_record.ptrMetadataSynchronized(), metadataSynchronized)) {
@@ -727,6 +722,18 @@ QString Track::getURL() const {
     return m_record.getUrl();
 }
 
+void Track::setFingerprint(const QString& fingerprint) {
+    QMutexLocker lock(&m_qMutex);
+    if (compareAndSet(m_record.ptrFingerprint(), fingerprint)) {
+        markDirtyAndUnlock(&lock);
+    }
+}
+
+QString Track::getFingerprint() const {
+    QMutexLocker lock(&m_qMutex);
+    return m_record.getFingerprint();
+}
+
 ConstWaveformPointer Track::getWaveform() const {
     return m_waveform;
 }
@@ -141,6 +141,10 @@ class Track : public QObject {
     void setReplayGain(const mixxx::ReplayGain&);
     // Returns ReplayGain
     mixxx::ReplayGain getReplayGain() const;
+    /// The version of the analyzer that calculated the ReplayGain or an
+    /// empty string if it has been imported from file tags.
+    QString getReplayGainVersion() const;
+    void setReplayGainVersion(const QString& replayGainVersion);
 
     // Indicates if the metadata has been parsed from file tags.
     bool isMetadataSynchronized() const;
@@ -229,6 +233,11 @@ class Track : public QObject {
     // Set URL for track
     void setURL(const QString& url);
 
+    /// The encoded Chromaprint fingerprint or an empty string if
+    /// it has not been computed yet.
+    QString getFingerprint() const;
+    void setFingerprint(const QString& fingerprint);
+
     /// Separator between artist and title string that is
     /// used for composing the track info.
     static const QString kArtistTitleSeparator;
@@ -288,10 +297,11 @@ class Track : public QObject {
 
     bool isDirty();
 
-    // Get the track's Beats list
+    // Get the track's current Beats snapshot
     mixxx::BeatsPointer getBeats() const;
 
-    // Set the track's Beats
+    // Replace the track's Beats with a new snapshot, e.g. one returned by
+    // one of the Beats mutations. Emits beatsUpdated().
     void setBeats(mixxx::BeatsPointer beats);
 
     /// Imports the given list of cue infos as cue points,
@@ -377,7 +387,6 @@ class Track : public QObject {
 
   private slots:
     void slotCueUpdated();
-    void slotBeatsUpdated();
 
   private:
     /// Set a unique identifier for the track.
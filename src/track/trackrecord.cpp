@@ -224,6 +224,12 @@ bool TrackRecord::updateStreamInfoFromSource(
     // accurate information about the audio stream in the database.
     const bool metadataUpdated = refMetadata().updateStreamInfoFromSource(streamInfoFromSource);
     DEBUG_ASSERT(getMetadata().getStreamInfo() == streamInfoFromSource);
+    if (metadataUpdated) {
+        // The fingerprint is computed after opening the audio stream.
+        // Different stream properties indicate that the file has been
+        // modified since then.
+        setFingerprint(QString());
+    }
     return metadataUpdated;
 }
 
@@ -239,6 +245,7 @@ bool operator==(const TrackRecord& lhs, const TrackRecord& rhs) {
             lhs.getColor() == rhs.getColor() &&
             lhs.getCuePoint() == rhs.getCuePoint() &&
             lhs.getBpmLocked() == rhs.getBpmLocked() &&
+            lhs.getFingerprint() == rhs.getFingerprint() &&
             lhs.getKeys() == rhs.getKeys() &&
             lhs.getRating() == rhs.getRating();
 }
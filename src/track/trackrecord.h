@@ -49,6 +49,12 @@ class TrackRecord final {
     MIXXX_DECL_PROPERTY(CuePosition, cuePoint, CuePoint)
     MIXXX_DECL_PROPERTY(int, rating, Rating)
     MIXXX_DECL_PROPERTY(bool, bpmLocked, BpmLocked)
+    // The encoded Chromaprint fingerprint of the first two minutes of
+    // the audio stream. Computed optionally while analyzing the track.
+    MIXXX_DECL_PROPERTY(QString, fingerprint, Fingerprint)
+    // Identifies the analyzer that has calculated the ReplayGain. Empty
+    // if the ReplayGain has been imported from file tags.
+    MIXXX_DECL_PROPERTY(QString, replayGainVersion, ReplayGainVersion)
 
   public:
     // Data migration: Reload track total from file tags if not initialized
@@ -0,0 +1,44 @@
+#include "util/cpuloadmeter.h"
+
+#include "util/math.h"
+
+namespace {
+
+// Weight of the most recent sample. The meters are sampled every 50 ms, so
+// this settles within a few hundred milliseconds while hiding the jitter of
+// single callbacks.
+constexpr double kSmoothingFactor = 0.3;
+
+} // anonymous namespace
+
+namespace mixxx {
+
+CpuLoadMeter::CpuLoadMeter()
+        : m_busyNanos(0),
+          m_lastBusyNanos(0),
+          m_load(0.0),
+          m_overloaded(false) {
+    m_sectionTimer.start();
+    m_sampleTimer.start();
+}
+
+double CpuLoadMeter::sampleLoad() {
+    const qint64 busyNanos = m_busyNanos.load(std::memory_order_relaxed);
+    const qint64 wallNanos = m_sampleTimer.restart().toIntegerNanos();
+    const double load = updateLoad(busyNanos - m_lastBusyNanos, wallNanos);
+    m_lastBusyNanos = busyNanos;
+    return load;
+}
+
+double CpuLoadMeter::updateLoad(qint64 busyNanos, qint64 wallNanos) {
+    if (wallNanos <= 0) {
+        return m_load;
+    }
+    const double load = math_clamp(
+            static_cast<double>(busyNanos) / wallNanos, 0.0, 1.0);
+    m_overloaded = load >= kOverloadThreshold;
+    m_load += kSmoothingFactor * (load - m_load);
+    return m_load;
+}
+
+} // namespace mixxx
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <QtGlobal>
+#include <atomic>
+
+#include "util/class.h"
+#include "util/performancetimer.h"
+
+namespace mixxx {
+
+/// Measures the share of real time that is spent in a section of real-time
+/// code, e.g. an effect processor called from the engine callback.
+///
+/// The engine thread brackets the measured section with start() and stop().
+/// Both are lock-free and allocation-free and may be called several times per
+/// callback, e.g. once for each channel an effect is processed for. A single
+/// consumer thread (usually the GUI thread) calls sampleLoad() periodically to
+/// get the busy time relative to the wall clock time that passed since the
+/// previous call. A load of 1.0 means that the section alone used the
+/// complete real-time budget of the audio callback.
+///
+/// Wall clock time is measured instead of thread CPU time, because the time
+/// the engine thread is preempted within the section also delays the callback.
+class CpuLoadMeter {
+  public:
+    CpuLoadMeter();
+
+    /// Must only be called from the engine thread.
+    void start() {
+        m_sectionTimer.start();
+    }
+
+    /// Must only be called from the engine thread after start().
+    void stop() {
+        // There is only a single writer, so no atomic read-modify-write
+        // operation is needed.
+        m_busyNanos.store(
+                m_busyNanos.load(std::memory_order_relaxed) +
+                        m_sectionTimer.elapsed().toIntegerNanos(),
+                std::memory_order_relaxed);
+    }
+
+    /// Returns the smoothed load since the previous invocation. Must only be
+    /// called from a single thread.
+    double sampleLoad();
+
+    /// Updates the smoothed load with the busy time and the wall clock time
+    /// of a single sample period and returns it. Invoked by sampleLoad().
+    double updateLoad(qint64 busyNanos, qint64 wallNanos);
+
+    /// The section exceeded kOverloadThreshold of the real-time budget in
+    /// the most recent sample period. Single spikes are reported although
+    /// the smoothed load hides them. Must only be called from the thread
+    /// that invokes sampleLoad().
+    bool isOverloaded() const {
+        return m_overloaded;
+    }
+
+    static constexpr double kOverloadThreshold = 0.9;
+
+  private:
+    PerformanceTimer m_sectionTimer;
+    std::atomic<qint64> m_busyNanos;
+
+    // Only accessed by the consumer thread
+    PerformanceTimer m_sampleTimer;
+    qint64 m_lastBusyNanos;
+    double m_load;
+    bool m_overloaded;
+
+    DISALLOW_COPY_AND_ASSIGN(CpuLoadMeter);
+};
+
+} // namespace mixxx
@@ -0,0 +1,150 @@
+#include "util/frametimeline.h"
+
+#include <QAbstractEventDispatcher>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QtDebug>
+#include <algorithm>
+
+#include "util/assert.h"
+
+namespace {
+
+// Shorter wake ups of the event loop are not recorded to keep the ring buffer
+// for the events that may cause a frame to be late.
+constexpr mixxx::Duration kMinEventLoopBusyTime = mixxx::Duration::fromMicros(1000);
+
+std::atomic<quint64> s_nextThreadId(1);
+
+// A small id per thread that makes the trace readable
+quint64 currentThreadId() {
+    static thread_local const quint64 t_threadId = s_nextThreadId.fetch_add(1);
+    return t_threadId;
+}
+
+} // anonymous namespace
+
+// static
+std::atomic<bool> FrameTimeline::s_enabled(false);
+
+// static
+FrameTimeline& FrameTimeline::instance() {
+    static FrameTimeline s_instance;
+    return s_instance;
+}
+
+FrameTimeline::FrameTimeline()
+        : m_writeIndex(0) {
+    for (auto& slot : m_slots) {
+        slot.sequence.store(0, std::memory_order_relaxed);
+    }
+}
+
+void FrameTimeline::record(const char* name,
+        mixxx::Duration start,
+        mixxx::Duration duration,
+        int arg) {
+    const quint64 index = m_writeIndex.fetch_add(1, std::memory_order_relaxed);
+    Slot& slot = m_slots[index % kCapacity];
+    // Invalidate the slot while the event is written
+    slot.sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.event = Event{name,
+            arg,
+            currentThreadId(),
+            start.toIntegerNanos(),
+            duration.toIntegerNanos()};
+    slot.sequence.store(index + 1, std::memory_order_release);
+}
+
+void FrameTimeline::watchEventDispatcher(QAbstractEventDispatcher* pDispatcher) {
+    VERIFY_OR_DEBUG_ASSERT(pDispatcher) {
+        return;
+    }
+    QObject::connect(pDispatcher,
+            &QAbstractEventDispatcher::awake,
+            [this] {
+                m_eventLoopAwake = mixxx::Time::elapsed();
+            });
+    QObject::connect(pDispatcher,
+            &QAbstractEventDispatcher::aboutToBlock,
+            [this] {
+                if (!isEnabled() || m_eventLoopAwake == mixxx::Duration::empty()) {
+                    return;
+                }
+                const mixxx::Duration busyTime = mixxx::Time::elapsed() - m_eventLoopAwake;
+                if (busyTime >= kMinEventLoopBusyTime) {
+                    record("EventLoop busy", m_eventLoopAwake, busyTime);
+                }
+            });
+}
+
+std::vector<FrameTimeline::Event> FrameTimeline::events() const {
+    std::vector<Event> result;
+    result.reserve(kCapacity);
+    for (const auto& slot : m_slots) {
+        const quint64 sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence == 0) {
+            continue;
+        }
+        const Event event = slot.event;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) != sequence) {
+            // Overwritten while reading
+            continue;
+        }
+        result.push_back(event);
+    }
+    std::sort(result.begin(), result.end(), [](const Event& lhs, const Event& rhs) {
+        return lhs.startNanos < rhs.startNanos;
+    });
+    return result;
+}
+
+void FrameTimeline::clear() {
+    for (auto& slot : m_slots) {
+        slot.sequence.store(0, std::memory_order_relaxed);
+    }
+}
+
+bool FrameTimeline::writeTraceEvents(const QString& filename) const {
+    QJsonArray traceEvents;
+    for (const auto& event : events()) {
+        QJsonObject traceEvent;
+        traceEvent.insert("name", QString::fromLatin1(event.name));
+        traceEvent.insert("cat", "frame");
+        traceEvent.insert("pid", 1);
+        traceEvent.insert("tid", static_cast<qint64>(event.threadId));
+        // The trace event format uses microseconds
+        traceEvent.insert("ts", event.startNanos / 1000.0);
+        if (event.durationNanos > 0) {
+            traceEvent.insert("ph", "X");
+            traceEvent.insert("dur", event.durationNanos / 1000.0);
+        } else {
+            traceEvent.insert("ph", "i");
+            // Draw instant events across all threads
+            traceEvent.insert("s", "g");
+        }
+        if (event.arg >= 0) {
+            QJsonObject args;
+            args.insert("index", event.arg);
+            traceEvent.insert("args", args);
+        }
+        traceEvents.append(traceEvent);
+    }
+
+    QJsonObject trace;
+    trace.insert("traceEvents", traceEvents);
+    trace.insert("displayTimeUnit", "ms");
+
+    QFile file(filename);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qWarning() << "Could not open frame timeline file for writing:"
+                   << file.fileName();
+        return false;
+    }
+    file.write(QJsonDocument(trace).toJson(QJsonDocument::Compact));
+    return true;
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <QString>
+#include <QtGlobal>
+#include <array>
+#include <atomic>
+#include <vector>
+
+#include "util/duration.h"
+#include "util/time.h"
+
+class QAbstractEventDispatcher;
+
+// A timeline of the work done for each GUI frame, e.g. rendering and
+// swapping the waveforms, painting widgets, missed VSyncs and the time the
+// event loop of the main thread was busy.
+//
+// The aggregated stats of the StatsManager tell how long painting takes on
+// average, but not why a single frame was late. The frame timeline records
+// each event with its start time and duration into a fixed size ring buffer
+// that keeps the most recent kCapacity events. Recording is lock-free and
+// never allocates, so it can be used from the main thread and the VSync
+// thread in every frame.
+//
+// The timeline is enabled together with the --timelinePath command line
+// option and written next to it in the Chrome trace event format, which can
+// be opened with chrome://tracing or https://ui.perfetto.dev.
+class FrameTimeline {
+  public:
+    static constexpr int kCapacity = 1 << 14;
+
+    struct Event {
+        // A string literal, it is not copied
+        const char* name;
+        // Optional argument, e.g. the index of a widget, or -1
+        int arg;
+        quint64 threadId;
+        qint64 startNanos;
+        // 0 for instant events
+        qint64 durationNanos;
+    };
+
+    static FrameTimeline& instance();
+
+    static bool isEnabled() {
+        return s_enabled.load(std::memory_order_relaxed);
+    }
+    static void setEnabled(bool enabled) {
+        s_enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    // Records an event that started at start and took duration. Thread safe,
+    // lock-free and wait-free.
+    void record(const char* name,
+            mixxx::Duration start,
+            mixxx::Duration duration,
+            int arg = -1);
+
+    // Records an event without duration, e.g. a missed VSync
+    void recordInstant(const char* name, int arg = -1) {
+        record(name, mixxx::Time::elapsed(), mixxx::Duration::empty(), arg);
+    }
+
+    // Records the busy time of the event loop that is driven by the dispatcher
+    // (the time between waking up and blocking again). Must be called from the
+    // thread of the dispatcher.
+    void watchEventDispatcher(QAbstractEventDispatcher* pDispatcher);
+
+    // Returns the recorded events ordered by start time. Events that are
+    // recorded concurrently may be missing.
+    std::vector<Event> events() const;
+
+    // Writes the recorded events in the Chrome trace event JSON format
+    bool writeTraceEvents(const QString& filename) const;
+
+    // Removes all recorded events
+    void clear();
+
+    // Records the lifetime of the scope if the timeline is enabled
+    class Scope {
+      public:
+        explicit Scope(const char* name, int arg = -1)
+                : m_name(isEnabled() ? name : nullptr),
+                  m_arg(arg) {
+            if (m_name) {
+                m_start = mixxx::Time::elapsed();
+            }
+        }
+        ~Scope() {
+            if (m_name) {
+                FrameTimeline::instance().record(m_name,
+                        m_start,
+                        mixxx::Time::elapsed() - m_start,
+                        m_arg);
+            }
+        }
+
+      private:
+        const char* const m_name;
+        const int m_arg;
+        mixxx::Duration m_start;
+    };
+
+  private:
+    // The event is valid if sequence equals the write index + 1 that was
+    // used to write it. 0 marks a slot that was never written.
+    struct Slot {
+        std::atomic<quint64> sequence;
+        Event event;
+    };
+
+    FrameTimeline();
+
+    static std::atomic<bool> s_enabled;
+
+    std::atomic<quint64> m_writeIndex;
+    std::array<Slot, kCapacity> m_slots;
+    // The time the event loop has woken up
+    mixxx::Duration m_eventLoopAwake;
+};
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <QThread>
+
+/// Changes the priority of the current thread and restores the previous
+/// priority when leaving the scope. Needed for tasks that run on threads
+/// of a QThreadPool, which are reused for other tasks afterwards.
+class ScopedThreadPriority {
+  public:
+    explicit ScopedThreadPriority(QThread::Priority priority)
+            : m_pThread(QThread::currentThread()),
+              m_previousPriority(restorablePriority(m_pThread->priority())) {
+        m_pThread->setPriority(priority);
+    }
+
+    ~ScopedThreadPriority() {
+        m_pThread->setPriority(m_previousPriority);
+    }
+
+    ScopedThreadPriority(const ScopedThreadPriority&) = delete;
+    ScopedThreadPriority& operator=(const ScopedThreadPriority&) = delete;
+
+  private:
+    /// Threads that have been started with the default InheritPriority,
+    /// like all threads of a QThreadPool, report it until their priority
+    /// is changed. QThread::setPriority() rejects it, so they are reset to
+    /// the normal priority that the pool threads inherit from the GUI
+    /// thread instead.
+    static QThread::Priority restorablePriority(QThread::Priority priority) {
+        if (priority == QThread::InheritPriority) {
+            return QThread::NormalPriority;
+        }
+        return priority;
+    }
+
+    QThread* const m_pThread;
+    const QThread::Priority m_previousPriority;
+};
@@ -1,6 +1,8 @@
 #include "util/statsmanager.h"
 
+#include <QDir>
 #include <QFile>
+#include <QFileInfo>
 #include <QMetaType>
 #include <QMutexLocker>
 #include <QTextStream>
@@ -9,6 +11,7 @@
 #include "moc_statsmanager.cpp"
 #include "util/cmdlineargs.h"
 #include "util/compatibility.h"
+#include "util/frametimeline.h"
 
 // In practice we process stats pipes about once a minute @1ms latency.
 const int kStatsPipeSize = 1 << 10;
@@ -33,6 +36,7 @@ StatsManager::StatsManager()
         : QThread(),
           m_quit(0) {
     s_bStatsManagerEnabled = true;
+    FrameTimeline::setEnabled(CmdlineArgs::Instance().getTimelineEnabled());
     setObjectName("StatsManager");
     moveToThread(this);
     start(QThread::LowPriority);
@@ -75,6 +79,12 @@ StatsManager::~StatsManager() {
 
     if (CmdlineArgs::Instance().getTimelineEnabled()) {
         writeTimeline(CmdlineArgs::Instance().getTimelinePath());
+        FrameTimeline::setEnabled(false);
+        // The frame timeline is written next to the timeline, e.g.
+        // timeline.csv -> timeline_frames.json
+        const QFileInfo timelineInfo(CmdlineArgs::Instance().getTimelinePath());
+        FrameTimeline::instance().writeTraceEvents(timelineInfo.dir().filePath(
+                timelineInfo.completeBaseName() + QStringLiteral("_frames.json")));
     }
 }
 
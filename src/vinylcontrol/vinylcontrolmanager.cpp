@@ -153,15 +153,18 @@ void VinylControlManager::removeSignalQualityListener(VinylSignalQualityListener
 }
 
 void VinylControlManager::updateSignalQualityListeners() {
-    FIFO<VinylSignalQualityReport>* signalQualityFifo = m_pProcessor->getSignalQualityFifo();
-    if (signalQualityFifo == nullptr) {
-        return;
-    }
+    for (int i = 0; i < kMaximumVinylControlInputs; ++i) {
+        FIFO<VinylSignalQualityReport>* signalQualityFifo =
+                m_pProcessor->getSignalQualityFifo(i);
+        if (signalQualityFifo == nullptr) {
+            continue;
+        }
 
-    VinylSignalQualityReport report;
-    while (signalQualityFifo->read(&report, 1) == 1) {
-        foreach (VinylSignalQualityListener* pListener, m_listeners) {
-            pListener->onVinylSignalQualityUpdate(report);
+        VinylSignalQualityReport report;
+        while (signalQualityFifo->read(&report, 1) == 1) {
+            foreach (VinylSignalQualityListener* pListener, m_listeners) {
+                pListener->onVinylSignalQualityUpdate(report);
+            }
         }
     }
 }
@@ -1,31 +1,19 @@
 #include "vinylcontrol/vinylcontrolprocessor.h"
 
-#include <QMutexLocker>
-
 #include "control/controlpushbutton.h"
 #include "moc_vinylcontrolprocessor.cpp"
 #include "util/defs.h"
 #include "util/event.h"
-#include "util/sample.h"
 #include "util/timer.h"
 #include "vinylcontrol/defs_vinylcontrol.h"
 #include "vinylcontrol/vinylcontrol.h"
+#include "vinylcontrol/vinylcontrolworker.h"
 #include "vinylcontrol/vinylcontrolxwax.h"
 
-#define SIGNAL_QUALITY_FIFO_SIZE 256
-#define SAMPLE_PIPE_FIFO_SIZE 65536
-
 VinylControlProcessor::VinylControlProcessor(QObject* pParent, UserSettingsPointer pConfig)
-        : QThread(pParent),
+        : QObject(pParent),
           m_pConfig(pConfig),
-          m_pToggle(new ControlPushButton(ConfigKey(VINYL_PREF_KEY, "Toggle"))),
-          m_pWorkBuffer(SampleUtil::alloc(MAX_BUFFER_LEN)),
-          m_processorsLock(QMutex::Recursive),
-          m_processors(kMaximumVinylControlInputs, NULL),
-          m_signalQualityFifo(SIGNAL_QUALITY_FIFO_SIZE),
-          m_bReportSignalQuality(false),
-          m_bQuit(false),
-          m_bReloadConfig(false) {
+          m_pToggle(new ControlPushButton(ConfigKey(VINYL_PREF_KEY, "Toggle"))) {
     connect(m_pToggle,
             &ControlPushButton::valueChanged,
             this,
@@ -33,31 +21,19 @@ VinylControlProcessor::VinylControlProcessor(QObject* pParent, UserSettingsPoint
             Qt::DirectConnection);
 
     for (int i = 0; i < kMaximumVinylControlInputs; ++i) {
-        m_samplePipes[i] = new FIFO<CSAMPLE>(SAMPLE_PIPE_FIFO_SIZE);
+        m_workers[i] = std::make_unique<VinylControlWorker>(i, pConfig);
+        m_workers[i]->start(QThread::HighPriority);
     }
-
-    start(QThread::HighPriority);
 }
 
 VinylControlProcessor::~VinylControlProcessor() {
-    m_bQuit = true;
-    m_samplesAvailableSignal.wakeAll();
-    wait();
+    shutdown();
+    for (auto& pWorker : m_workers) {
+        // Waits for the thread and deletes the processor
+        pWorker.reset();
+    }
 
     delete m_pToggle;
-    SampleUtil::free(m_pWorkBuffer);
-
-    {
-        QMutexLocker locker(&m_processorsLock);
-        for (int i = 0; i < kMaximumVinylControlInputs; ++i) {
-            VinylControl* pProcessor = m_processors.at(i);
-            m_processors[i] = NULL;
-            delete pProcessor;
-
-            delete m_samplePipes[i];
-            m_samplePipes[i] = nullptr;
-        }
-    }
 
     // xwax has a global LUT that we need to free after we've shut down our
     // vinyl control threads because it's not thread-safe.
@@ -65,93 +41,30 @@ VinylControlProcessor::~VinylControlProcessor() {
 }
 
 void VinylControlProcessor::setSignalQualityReporting(bool enable) {
-    m_bReportSignalQuality = enable;
+    for (const auto& pWorker : m_workers) {
+        pWorker->setSignalQualityReporting(enable);
+    }
 }
 
 void VinylControlProcessor::shutdown() {
-    m_bQuit = true;
-    m_samplesAvailableSignal.wakeAll();
+    for (const auto& pWorker : m_workers) {
+        if (pWorker) {
+            pWorker->shutdown();
+        }
+    }
 }
 
 void VinylControlProcessor::requestReloadConfig() {
-    m_bReloadConfig = true;
-    m_samplesAvailableSignal.wakeAll();
-}
-
-void VinylControlProcessor::run() {
-    unsigned static id = 0; //the id of this thread, for debugging purposes //XXX copypasta (should factor this out somehow), -kousu 2/2009
-    QThread::currentThread()->setObjectName(QString("VinylControlProcessor %1").arg(++id));
-
-    while (!m_bQuit) {
-        if (m_bReloadConfig) {
-            reloadConfig();
-            m_bReloadConfig = false;
-        }
-
-        for (int i = 0; i < kMaximumVinylControlInputs; ++i) {
-            QMutexLocker locker(&m_processorsLock);
-            VinylControl* pProcessor = m_processors[i];
-            locker.unlock();
-            FIFO<CSAMPLE>* pSamplePipe = m_samplePipes[i];
-
-            if (pSamplePipe->readAvailable() > 0) {
-                int samplesRead = pSamplePipe->read(m_pWorkBuffer, MAX_BUFFER_LEN);
-
-                if (samplesRead % 2 != 0) {
-                    qWarning() << "VinylControlProcessor received non-even number of samples via sample FIFO.";
-                    samplesRead--;
-                }
-                int framesRead = samplesRead / 2;
-
-                if (pProcessor) {
-                    pProcessor->analyzeSamples(m_pWorkBuffer, framesRead);
-                } else {
-                    // Samples are being written to a non-existent processor. Warning?
-                    qWarning() << "Samples written to non-existent VinylControl processor:" << i;
-                }
-            }
-
-            // TODO(rryan) define a time-based update rate. This will update way
-            // too quickly.
-            if (pProcessor && m_bReportSignalQuality) {
-                VinylSignalQualityReport report;
-                if (pProcessor->writeQualityReport(&report)) {
-                    report.processor = i;
-                    if (m_signalQualityFifo.write(&report, 1) != 1) {
-                        qWarning() << "VinylControlProcessor could not write signal quality report for VC index:" << i;
-                    }
-                }
-            }
-        }
-
-        if (m_bQuit) {
-            break;
-        }
-
-        // Wait for a signal from the main thread or engine thread that we
-        // should wake up and process input.
-        m_waitForSampleMutex.lock();
-        m_samplesAvailableSignal.wait(&m_waitForSampleMutex);
-        m_waitForSampleMutex.unlock();
+    for (const auto& pWorker : m_workers) {
+        pWorker->requestReloadConfig();
     }
 }
 
-void VinylControlProcessor::reloadConfig() {
-    for (int i = 0; i < kMaximumVinylControlInputs; ++i) {
-        QMutexLocker locker(&m_processorsLock);
-        VinylControl* pCurrent = m_processors[i];
-
-        if (pCurrent == nullptr) {
-            continue;
-        }
-
-        VinylControl *pNew = new VinylControlXwax(
-            m_pConfig, kVCGroup.arg(i + 1));
-        m_processors.replace(i, pNew);
-        locker.unlock();
-        // Delete outside of the critical section to avoid deadlocks.
-        delete pCurrent;
+FIFO<VinylSignalQualityReport>* VinylControlProcessor::getSignalQualityFifo(int index) {
+    if (index < 0 || index >= kMaximumVinylControlInputs) {
+        return nullptr;
     }
+    return m_workers[index]->getSignalQualityFifo();
 }
 
 void VinylControlProcessor::onInputConfigured(const AudioInput& input) {
@@ -167,15 +80,8 @@ void VinylControlProcessor::onInputConfigured(const AudioInput& input) {
         return;
     }
 
-    VinylControl *pNew = new VinylControlXwax(
-        m_pConfig, kVCGroup.arg(index + 1));
-
-    QMutexLocker locker(&m_processorsLock);
-    VinylControl* pCurrent = m_processors.at(index);
-    m_processors.replace(index, pNew);
-    locker.unlock();
-    // Delete outside of the critical section to avoid deadlocks.
-    delete pCurrent;
+    m_workers[index]->setProcessor(new VinylControlXwax(
+            m_pConfig, kVCGroup.arg(index + 1)));
 }
 
 void VinylControlProcessor::onInputUnconfigured(const AudioInput& input) {
@@ -192,16 +98,11 @@ void VinylControlProcessor::onInputUnconfigured(const AudioInput& input) {
         return;
     }
 
-    QMutexLocker locker(&m_processorsLock);
-    VinylControl* pVC = m_processors.at(index);
-    m_processors.replace(index, NULL);
-    locker.unlock();
-    // Delete outside of the critical section to avoid deadlocks.
-    delete pVC;
+    m_workers[index]->setProcessor(nullptr);
 }
 
 bool VinylControlProcessor::deckConfigured(int index) const {
-    return m_processors[index] != NULL;
+    return m_workers[index]->hasProcessor();
 }
 
 void VinylControlProcessor::receiveBuffer(const AudioInput& input,
@@ -220,23 +121,8 @@ void VinylControlProcessor::receiveBuffer(const AudioInput& input,
         return;
     }
 
-    FIFO<CSAMPLE>* pSamplePipe = m_samplePipes[vcIndex];
-
-    if (pSamplePipe == nullptr) {
-        // Should not be possible.
-        return;
-    }
-
-    const int kChannels = 2;
-    const int nSamples = nFrames * kChannels;
-    int samplesWritten = pSamplePipe->write(pBuffer, nSamples);
-
-    if (samplesWritten < nSamples) {
-        qWarning() << "ERROR: Buffer overflow in VinylControlProcessor. Dropping samples on the floor."
-                   << "VCIndex:" << vcIndex;
-    }
-
-    m_samplesAvailableSignal.wakeAll();
+    // Only wakes up the worker of this input
+    m_workers[vcIndex]->receiveBuffer(pBuffer, nFrames);
 }
 
 void VinylControlProcessor::toggleDeck(double value) {
@@ -259,11 +145,8 @@ void VinylControlProcessor::toggleDeck(double value) {
     // -1 means we haven't found a proxy that's enabled
     int enabled = -1;
 
-    QMutexLocker locker(&m_processorsLock);
-
-    for (int i = 0; i < m_processors.size(); ++i) {
-        VinylControl* pProcessor = m_processors.at(i);
-        if (pProcessor && pProcessor->isEnabled()) {
+    for (int i = 0; i < kMaximumVinylControlInputs; ++i) {
+        if (m_workers[i]->isEnabled()) {
             if (enabled > -1) {
                 return; // case 3
             }
@@ -271,29 +154,21 @@ void VinylControlProcessor::toggleDeck(double value) {
         }
     }
 
-    if (enabled > -1 && m_processors.size() > 1) {
+    if (enabled > -1) {
         // handle case 2
-
-        int nextProxy = (enabled + 1) % m_processors.size();
-        while (!m_processors[nextProxy]) {
-            nextProxy = (nextProxy + 1) % m_processors.size();
-        } // guaranteed to terminate as there's at least 1 non-null proxy
-
-        if (nextProxy == enabled) {
-            return;
+        for (int i = 1; i < kMaximumVinylControlInputs; ++i) {
+            const int nextProxy = (enabled + i) % kMaximumVinylControlInputs;
+            if (m_workers[nextProxy]->hasProcessor()) {
+                m_workers[enabled]->toggleVinylControl(false);
+                m_workers[nextProxy]->toggleVinylControl(true);
+                return;
+            }
         }
-
-        VinylControl* pEnabled = m_processors[enabled];
-        VinylControl* pNextProxy = m_processors[nextProxy];
-        locker.unlock();
-        pEnabled->toggleVinylControl(false);
-        pNextProxy->toggleVinylControl(true);
-    } else if (enabled == -1) {
+    } else {
         // handle case 1, or we just don't have any processors
-        foreach (VinylControl* pProcessor, m_processors) {
-            if (pProcessor) {
-                locker.unlock();
-                pProcessor->toggleVinylControl(true);
+        for (const auto& pWorker : m_workers) {
+            if (pWorker->hasProcessor()) {
+                pWorker->toggleVinylControl(true);
                 return;
             }
         }
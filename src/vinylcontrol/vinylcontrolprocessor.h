@@ -1,50 +1,48 @@
 #pragma once
 
 #include <QObject>
-#include <QThread>
-#include <QVector>
-#include <QMutex>
-#include <QWaitCondition>
+#include <memory>
 
 #include "preferences/usersettings.h"
 #include "util/fifo.h"
+#include "vinylcontrol/defs_vinylcontrol.h"
 #include "vinylcontrol/vinylsignalquality.h"
 #include "soundio/soundmanagerutil.h"
 
-class VinylControl;
 class ControlPushButton;
-
-// VinylControlProcessor is a thread that is in charge of receiving samples from
-// the engine callback and feeding those samples to the VinylControl
-// classes. The most important thing is that the connection between the engine
-// callback and VinylControlProcessor (the receiveBuffer method) is lock-free.
-class VinylControlProcessor : public QThread, public AudioDestination {
+class VinylControlWorker;
+
+// VinylControlProcessor is in charge of receiving samples from the engine
+// callback and feeding those samples to the VinylControl classes. Each input
+// is decoded by its own VinylControlWorker thread. The most important thing is
+// that the connection between the engine callback and the workers (the
+// receiveBuffer method) is lock-free.
+class VinylControlProcessor : public QObject, public AudioDestination {
     Q_OBJECT
   public:
     VinylControlProcessor(QObject* pParent, UserSettingsPointer pConfig);
-    virtual ~VinylControlProcessor();
+    ~VinylControlProcessor() override;
 
-    // Called from main thread. Must only touch m_bReportSignalQuality.
+    // Called from main thread.
     void setSignalQualityReporting(bool enable);
 
-    // Called from the main thread. Must only touch m_bQuit;
+    // Called from the main thread.
     void shutdown();
 
-    // Called from the main thread. Must only touch m_bReload;
+    // Called from the main thread. The workers reload the config.
     void requestReloadConfig();
 
     bool deckConfigured(int index) const;
 
-    FIFO<VinylSignalQualityReport>* getSignalQualityFifo() {
-        return &m_signalQualityFifo;
-    }
+    // Each input reports its signal quality through a separate FIFO
+    FIFO<VinylSignalQualityReport>* getSignalQualityFifo(int index);
 
   public slots:
     virtual void onInputConfigured(const AudioInput& input);
     virtual void onInputUnconfigured(const AudioInput& input);
 
     // Called by the engine callback. Must not touch any state in
-    // VinylControlProcessor except for m_samplePipes. NOTE:
+    // VinylControlProcessor except for m_workers. NOTE:
 
     // This is called by SoundManager whenever there are new samples from the
     // configured input to be processed. This is run in the callback thread of
@@ -54,28 +52,13 @@ class VinylControlProcessor : public QThread, public AudioDestination {
     // AudioInput index.
     void receiveBuffer(const AudioInput& input, const CSAMPLE* pBuffer, unsigned int iNumFrames);
 
-  protected:
-    void run();
-
   private slots:
     void toggleDeck(double value);
 
   private:
-    void reloadConfig();
-
     UserSettingsPointer m_pConfig;
     ControlPushButton* m_pToggle;
-    // A pre-allocated array of FIFOs for writing samples from the engine
-    // callback to the processor thread. There is a maximum of
-    // kMaximumVinylControlInputs pipes.
-    FIFO<CSAMPLE>* m_samplePipes[kMaximumVinylControlInputs];
-    CSAMPLE* m_pWorkBuffer;
-    QWaitCondition m_samplesAvailableSignal;
-    QMutex m_waitForSampleMutex;
-    QMutex m_processorsLock;
-    QVector<VinylControl*> m_processors;
-    FIFO<VinylSignalQualityReport> m_signalQualityFifo;
-    volatile bool m_bReportSignalQuality;
-    volatile bool m_bQuit;
-    volatile bool m_bReloadConfig;
+    // A pre-allocated worker thread for each of the kMaximumVinylControlInputs
+    // inputs.
+    std::unique_ptr<VinylControlWorker> m_workers[kMaximumVinylControlInputs];
 };
@@ -0,0 +1,197 @@
+#include "vinylcontrol/vinylcontrolworker.h"
+
+#include <QMutexLocker>
+#include <QtDebug>
+
+#include "util/defs.h"
+#include "util/sample.h"
+#include "util/stat.h"
+#include "util/time.h"
+#include "vinylcontrol/defs_vinylcontrol.h"
+#include "vinylcontrol/vinylcontrol.h"
+#include "vinylcontrol/vinylcontrolxwax.h"
+
+namespace {
+
+constexpr int kSignalQualityFifoSize = 256;
+constexpr int kSamplePipeFifoSize = 65536;
+
+} // anonymous namespace
+
+VinylControlWorker::VinylControlWorker(int index, UserSettingsPointer pConfig)
+        : m_index(index),
+          m_pConfig(pConfig),
+          m_latencyStatKey(QStringLiteral("VinylControlWorker %1 receive to decode latency")
+                                   .arg(kVCGroup.arg(index + 1))),
+          m_samplePipe(kSamplePipeFifoSize),
+          m_pWorkBuffer(SampleUtil::alloc(MAX_BUFFER_LEN)),
+          m_pProcessor(nullptr),
+          m_signalQualityFifo(kSignalQualityFifoSize),
+          m_bReportSignalQuality(false),
+          m_bQuit(false),
+          m_bReloadConfig(false),
+          m_receivedNanos(-1) {
+}
+
+VinylControlWorker::~VinylControlWorker() {
+    shutdown();
+    wait();
+    setProcessor(nullptr);
+    SampleUtil::free(m_pWorkBuffer);
+}
+
+void VinylControlWorker::setProcessor(VinylControl* pProcessor) {
+    QMutexLocker locker(&m_processorMutex);
+    VinylControl* pCurrent = m_pProcessor;
+    m_pProcessor = pProcessor;
+    locker.unlock();
+    // Delete outside of the critical section to avoid deadlocks.
+    delete pCurrent;
+}
+
+bool VinylControlWorker::hasProcessor() const {
+    const QMutexLocker locker(&m_processorMutex);
+    return m_pProcessor != nullptr;
+}
+
+bool VinylControlWorker::isEnabled() const {
+    const QMutexLocker locker(&m_processorMutex);
+    return m_pProcessor && m_pProcessor->isEnabled();
+}
+
+void VinylControlWorker::toggleVinylControl(bool enable) {
+    const QMutexLocker locker(&m_processorMutex);
+    if (m_pProcessor) {
+        m_pProcessor->toggleVinylControl(enable);
+    }
+}
+
+void VinylControlWorker::setSignalQualityReporting(bool enable) {
+    m_bReportSignalQuality = enable;
+}
+
+void VinylControlWorker::requestReloadConfig() {
+    m_bReloadConfig = true;
+    m_samplesAvailableSignal.wakeAll();
+}
+
+void VinylControlWorker::shutdown() {
+    m_bQuit = true;
+    m_samplesAvailableSignal.wakeAll();
+}
+
+void VinylControlWorker::run() {
+    QThread::currentThread()->setObjectName(
+            QStringLiteral("VinylControlWorker %1").arg(m_index + 1));
+
+    while (!m_bQuit) {
+        if (m_bReloadConfig.exchange(false)) {
+            reloadConfig();
+        }
+
+        processSamples();
+
+        // TODO(rryan) define a time-based update rate. This will update way
+        // too quickly.
+        if (m_bReportSignalQuality) {
+            reportSignalQuality();
+        }
+
+        if (m_bQuit) {
+            break;
+        }
+
+        // Wait for a signal from the main thread or engine thread that we
+        // should wake up and process input.
+        m_waitForSampleMutex.lock();
+        if (m_samplePipe.readAvailable() == 0 && !m_bReloadConfig && !m_bQuit) {
+            m_samplesAvailableSignal.wait(&m_waitForSampleMutex);
+        }
+        m_waitForSampleMutex.unlock();
+    }
+}
+
+void VinylControlWorker::reloadConfig() {
+    // The check and the replacement are done under the same lock, so a
+    // processor that is removed concurrently for an unconfigured input is
+    // not created again.
+    QMutexLocker locker(&m_processorMutex);
+    VinylControl* pCurrent = m_pProcessor;
+    if (!pCurrent) {
+        return;
+    }
+    // Building the timecode lookup tables takes a while, so this is done
+    // here instead of the main thread.
+    m_pProcessor = new VinylControlXwax(m_pConfig, kVCGroup.arg(m_index + 1));
+    locker.unlock();
+    // Delete outside of the critical section to avoid deadlocks.
+    delete pCurrent;
+}
+
+void VinylControlWorker::processSamples() {
+    const qint64 receivedNanos = m_receivedNanos.exchange(-1);
+    bool processed = false;
+    while (m_samplePipe.readAvailable() > 0) {
+        int samplesRead = m_samplePipe.read(m_pWorkBuffer, MAX_BUFFER_LEN);
+
+        if (samplesRead % 2 != 0) {
+            qWarning() << "VinylControlWorker received non-even number of samples via sample FIFO.";
+            samplesRead--;
+        }
+        const int framesRead = samplesRead / 2;
+
+        const QMutexLocker locker(&m_processorMutex);
+        if (m_pProcessor) {
+            m_pProcessor->analyzeSamples(m_pWorkBuffer, framesRead);
+            processed = true;
+        } else {
+            // Samples are being written to a non-existent processor. Warning?
+            qWarning() << "Samples written to non-existent VinylControl processor:" << m_index;
+        }
+    }
+
+    if (processed && receivedNanos >= 0) {
+        // Only up to decoding. The engine applies the decoded pitch and
+        // position with its next callback, which is not included.
+        const qint64 latencyNanos =
+                mixxx::Time::elapsed().toIntegerNanos() - receivedNanos;
+        Stat::track(m_latencyStatKey,
+                Stat::DURATION_NANOSEC,
+                Stat::experimentFlags(Stat::COUNT | Stat::AVERAGE |
+                        Stat::SAMPLE_VARIANCE | Stat::MIN | Stat::MAX),
+                static_cast<double>(latencyNanos));
+    }
+}
+
+void VinylControlWorker::reportSignalQuality() {
+    const QMutexLocker locker(&m_processorMutex);
+    if (!m_pProcessor) {
+        return;
+    }
+    VinylSignalQualityReport report;
+    if (m_pProcessor->writeQualityReport(&report)) {
+        report.processor = static_cast<unsigned char>(m_index);
+        if (m_signalQualityFifo.write(&report, 1) != 1) {
+            qWarning() << "VinylControlWorker could not write signal quality report for VC index:" << m_index;
+        }
+    }
+}
+
+void VinylControlWorker::receiveBuffer(const CSAMPLE* pBuffer, unsigned int nFrames) {
+    // Only the first buffer after the pipe has been drained starts the
+    // latency measurement.
+    qint64 noPendingSamples = -1;
+    m_receivedNanos.compare_exchange_strong(noPendingSamples,
+            mixxx::Time::elapsed().toIntegerNanos());
+
+    const int kChannels = 2;
+    const int nSamples = nFrames * kChannels;
+    int samplesWritten = m_samplePipe.write(pBuffer, nSamples);
+
+    if (samplesWritten < nSamples) {
+        qWarning() << "ERROR: Buffer overflow in VinylControlWorker. Dropping samples on the floor."
+                   << "VCIndex:" << m_index;
+    }
+
+    m_samplesAvailableSignal.wakeAll();
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <QMutex>
+#include <QString>
+#include <QThread>
+#include <QWaitCondition>
+#include <atomic>
+
+#include "preferences/usersettings.h"
+#include "util/fifo.h"
+#include "util/types.h"
+#include "vinylcontrol/vinylsignalquality.h"
+
+class VinylControl;
+
+// VinylControlWorker is a thread that decodes the timecode of a single vinyl
+// control input, so the inputs are decoded in parallel instead of sharing one
+// core. Samples are handed over from the engine callback through a lock-free
+// FIFO and the decoded pitch and position are published to the engine by the
+// VinylControl through ControlProxys.
+class VinylControlWorker : public QThread {
+  public:
+    VinylControlWorker(int index, UserSettingsPointer pConfig);
+    ~VinylControlWorker() override;
+
+    // Takes ownership of pProcessor and deletes the previous processor. Blocks
+    // while the previous processor is decoding, so it must never be called
+    // from the engine callback. pProcessor may be null.
+    void setProcessor(VinylControl* pProcessor);
+    bool hasProcessor() const;
+
+    bool isEnabled() const;
+    void toggleVinylControl(bool enable);
+
+    // Called from the main thread.
+    void setSignalQualityReporting(bool enable);
+    void requestReloadConfig();
+    void shutdown();
+
+    FIFO<VinylSignalQualityReport>* getSignalQualityFifo() {
+        return &m_signalQualityFifo;
+    }
+
+    // Called by the engine callback. Must not touch any state except for
+    // m_samplePipe and m_receivedNanos.
+    void receiveBuffer(const CSAMPLE* pBuffer, unsigned int iNumFrames);
+
+  protected:
+    void run() override;
+
+  private:
+    void reloadConfig();
+    void processSamples();
+    void reportSignalQuality();
+
+    const int m_index;
+    const UserSettingsPointer m_pConfig;
+    // The time it takes from receiving samples in the engine callback until
+    // they have been decoded. This is only part of the latency of vinyl
+    // control, because the engine applies the decoded position up to one
+    // callback later.
+    const QString m_latencyStatKey;
+
+    FIFO<CSAMPLE> m_samplePipe;
+    CSAMPLE* m_pWorkBuffer;
+    QWaitCondition m_samplesAvailableSignal;
+    QMutex m_waitForSampleMutex;
+
+    // Locked while the processor is decoding, so that it is not deleted
+    // meanwhile. Only contended when the processor is replaced.
+    mutable QMutex m_processorMutex;
+    VinylControl* m_pProcessor;
+
+    FIFO<VinylSignalQualityReport> m_signalQualityFifo;
+    std::atomic<bool> m_bReportSignalQuality;
+    std::atomic<bool> m_bQuit;
+    std::atomic<bool> m_bReloadConfig;
+
+    // The time stamp of the oldest samples in m_samplePipe or -1 if the pipe
+    // has been drained.
+    std::atomic<qint64> m_receivedNanos;
+};
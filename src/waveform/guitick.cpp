@@ -1,7 +1,9 @@
 #include <QTimer>
 
 #include "waveform/guitick.h"
+#include "control/controlchangecoalescer.h"
 #include "control/controlobject.h"
+#include "util/frametimeline.h"
 
 GuiTick::GuiTick() {
     m_pCOGuiTickTime = std::make_unique<ControlObject>(ConfigKey("[Master]", "guiTickTime"));
@@ -12,6 +14,7 @@ GuiTick::GuiTick() {
 // this is called from WaveformWidgetFactory::render in the main thread with the
 // configured waveform frame rate
 void GuiTick::process() {
+    FrameTimeline::Scope frameTimelineScope("GuiTick::process");
     m_cpuTimeLastTick += m_cpuTimer.restart();
     double cpuTimeLastTickSeconds = m_cpuTimeLastTick.toDoubleSeconds();
     m_pCOGuiTickTime->set(cpuTimeLastTickSeconds);
@@ -20,4 +23,7 @@ void GuiTick::process() {
         m_lastUpdateTime = m_cpuTimeLastTick;
         m_pCOGuiTick50ms->set(cpuTimeLastTickSeconds);
     }
+
+    // Deliver the control changes of this frame to the coalesced widgets
+    ControlChangeCoalescer::instance().flush();
 }
@@ -11,7 +11,10 @@
 
 WaveformRendererHSV::WaveformRendererHSV(
         WaveformWidgetRenderer* waveformWidgetRenderer)
-    : WaveformRendererSignalBase(waveformWidgetRenderer) {
+    : WaveformRendererSignalBase(waveformWidgetRenderer),
+      m_rasterizer([this](QPainter* painter, const WaveformSignalView& view) {
+          drawSignal(painter, view);
+      }) {
 }
 
 WaveformRendererHSV::~WaveformRendererHSV() {
@@ -23,23 +26,8 @@ void WaveformRendererHSV::onSetup(const QDomNode& node) {
 
 void WaveformRendererHSV::draw(QPainter* painter,
                                           QPaintEvent* /*event*/) {
-    const TrackPointer trackInfo = m_waveformRenderer->getTrackInfo();
-    if (!trackInfo) {
-        return;
-    }
-
-    ConstWaveformPointer waveform = trackInfo->getWaveform();
-    if (waveform.isNull()) {
-        return;
-    }
-
-    const int dataSize = waveform->getDataSize();
-    if (dataSize <= 1) {
-        return;
-    }
-
-    const WaveformData* data = waveform->data();
-    if (data == nullptr) {
+    WaveformSignalView view;
+    if (!captureSignalView(&view, false)) {
         return;
     }
 
@@ -55,17 +43,30 @@ void WaveformRendererHSV::draw(QPainter* painter,
         painter->setTransform(QTransform(0, 1, 1, 0, 0, 0));
     }
 
-    const double firstVisualIndex = m_waveformRenderer->getFirstDisplayedPosition() * dataSize;
-    const double lastVisualIndex = m_waveformRenderer->getLastDisplayedPosition() * dataSize;
+    //draw reference line
+    const float halfBreadth = static_cast<float>(view.breadth) / 2.0f;
+    painter->setPen(m_pColors->getAxesColor());
+    painter->drawLine(QLineF(0, halfBreadth, view.columns, halfBreadth));
+
+    if (m_waveformRenderer->getOrientation() == Qt::Horizontal &&
+            m_rasterizer.draw(painter, view)) {
+        return;
+    }
+    drawSignal(painter, view);
+}
+
+void WaveformRendererHSV::drawSignal(QPainter* painter, const WaveformSignalView& view) const {
+    const Waveform& waveform = *view.pWaveform;
+    const int dataSize = waveform.getDataSize();
 
-    const double offset = firstVisualIndex;
+    painter->setRenderHints(QPainter::Antialiasing, false);
+
+    const double offset = view.firstVisualIndex;
 
     // Represents the # of waveform data points per horizontal pixel.
-    const double gain = (lastVisualIndex - firstVisualIndex) /
-            (double)m_waveformRenderer->getLength();
+    const double gain = view.visualSamplesPerColumn;
 
-    float allGain(1.0);
-    getGains(&allGain, nullptr, nullptr, nullptr);
+    const float allGain = view.allGain;
 
     // Save HSV of waveform color. NOTE(rryan): On ARM, qreal is float so it's
     // important we use qreal here and not double or float or else we will get
@@ -80,18 +81,14 @@ void WaveformRendererHSV::draw(QPainter* painter,
 
     QPen pen;
     pen.setCapStyle(Qt::FlatCap);
-    pen.setWidthF(math_max(1.0, 1.0 / m_waveformRenderer->getVisualSamplePerPixel()));
+    pen.setWidthF(view.penWidth);
 
-    const int breadth = m_waveformRenderer->getBreadth();
+    const int breadth = view.breadth;
     const float halfBreadth = static_cast<float>(breadth) / 2.0f;
 
     const float heightFactor = allGain * halfBreadth / 255.0f;
 
-    //draw reference line
-    painter->setPen(m_pColors->getAxesColor());
-    painter->drawLine(QLineF(0, halfBreadth, m_waveformRenderer->getLength(), halfBreadth));
-
-    for (int x = 0; x < m_waveformRenderer->getLength(); ++x) {
+    for (int x = 0; x < view.columns; ++x) {
         // Width of the x position in visual indices.
         const double xSampleWidth = gain * x;
 
@@ -119,27 +116,12 @@ void WaveformRendererHSV::draw(QPainter* painter,
         visualFrameStart = math_clamp(visualFrameStart, 0, lastVisualFrame);
         visualFrameStop = math_clamp(visualFrameStop, 0, lastVisualFrame);
 
-        int visualIndexStart = visualFrameStart * 2;
-        int visualIndexStop = visualFrameStop * 2;
-
-        int maxLow[2] = {0, 0};
-        int maxHigh[2] = {0, 0};
-        int maxMid[2] = {0, 0};
-        int maxAll[2] = {0, 0};
-
-        for (int i = visualIndexStart;
-             i >= 0 && i + 1 < dataSize && i + 1 <= visualIndexStop; i += 2) {
-            const WaveformData& waveformData = *(data + i);
-            const WaveformData& waveformDataNext = *(data + i + 1);
-            maxLow[0] = math_max(maxLow[0], (int)waveformData.filtered.low);
-            maxLow[1] = math_max(maxLow[1], (int)waveformDataNext.filtered.low);
-            maxMid[0] = math_max(maxMid[0], (int)waveformData.filtered.mid);
-            maxMid[1] = math_max(maxMid[1], (int)waveformDataNext.filtered.mid);
-            maxHigh[0] = math_max(maxHigh[0], (int)waveformData.filtered.high);
-            maxHigh[1] = math_max(maxHigh[1], (int)waveformDataNext.filtered.high);
-            maxAll[0] = math_max(maxAll[0], (int)waveformData.filtered.all);
-            maxAll[1] = math_max(maxAll[1], (int)waveformDataNext.filtered.all);
-        }
+        WaveformPeak peaks[ChannelCount];
+        waveform.getPeaks(visualFrameStart, visualFrameStop, peaks);
+        const int maxLow[2] = {peaks[Left].low, peaks[Right].low};
+        const int maxHigh[2] = {peaks[Left].high, peaks[Right].high};
+        const int maxMid[2] = {peaks[Left].mid, peaks[Right].mid};
+        const int maxAll[2] = {peaks[Left].all, peaks[Right].all};
 
         if (maxAll[0] && maxAll[1]) {
             // Calculate sum, to normalize
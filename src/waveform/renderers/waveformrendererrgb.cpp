@@ -11,7 +11,10 @@
 
 WaveformRendererRGB::WaveformRendererRGB(
         WaveformWidgetRenderer* waveformWidgetRenderer)
-        : WaveformRendererSignalBase(waveformWidgetRenderer) {
+        : WaveformRendererSignalBase(waveformWidgetRenderer),
+          m_rasterizer([this](QPainter* painter, const WaveformSignalView& view) {
+              drawSignal(painter, view);
+          }) {
 }
 
 WaveformRendererRGB::~WaveformRendererRGB() {
@@ -22,23 +25,8 @@ void WaveformRendererRGB::onSetup(const QDomNode& /* node */) {
 
 void WaveformRendererRGB::draw(QPainter* painter,
                                           QPaintEvent* /*event*/) {
-    const TrackPointer trackInfo = m_waveformRenderer->getTrackInfo();
-    if (!trackInfo) {
-        return;
-    }
-
-    ConstWaveformPointer waveform = trackInfo->getWaveform();
-    if (waveform.isNull()) {
-        return;
-    }
-
-    const int dataSize = waveform->getDataSize();
-    if (dataSize <= 1) {
-        return;
-    }
-
-    const WaveformData* data = waveform->data();
-    if (data == nullptr) {
+    WaveformSignalView view;
+    if (!captureSignalView(&view, true)) {
         return;
     }
 
@@ -54,35 +42,56 @@ void WaveformRendererRGB::draw(QPainter* painter,
         painter->setTransform(QTransform(0, 1, 1, 0, 0, 0));
     }
 
-    const double firstVisualIndex = m_waveformRenderer->getFirstDisplayedPosition() * dataSize;
-    const double lastVisualIndex = m_waveformRenderer->getLastDisplayedPosition() * dataSize;
+    // Draw reference line
+    const float halfBreadth = static_cast<float>(view.breadth) / 2.0f;
+    painter->setPen(m_pColors->getAxesColor());
+    painter->drawLine(QLineF(0, halfBreadth, view.columns, halfBreadth));
+
+    if (m_waveformRenderer->getOrientation() == Qt::Horizontal &&
+            m_rasterizer.draw(painter, view)) {
+        return;
+    }
+    drawSignal(painter, view);
+}
+
+void WaveformRendererRGB::drawSignal(QPainter* painter, const WaveformSignalView& view) const {
+    const Waveform& waveform = *view.pWaveform;
+    const int dataSize = waveform.getDataSize();
+    const WaveformData* data = waveform.data();
 
-    const double offset = firstVisualIndex;
+    painter->setRenderHints(QPainter::Antialiasing, false);
+
+    const double offset = view.firstVisualIndex;
 
     // Represents the # of waveform data points per horizontal pixel.
-    const double gain = (lastVisualIndex - firstVisualIndex) /
-            (double)m_waveformRenderer->getLength();
+    const double gain = view.visualSamplesPerColumn;
 
     // Per-band gain from the EQ knobs.
-    float allGain(1.0), lowGain(1.0), midGain(1.0), highGain(1.0);
-    getGains(&allGain, &lowGain, &midGain, &highGain);
+    const float allGain = view.allGain;
+    const float lowGain = view.lowGain;
+    const float midGain = view.midGain;
+    const float highGain = view.highGain;
+
+    // The height is the maximum of the gain weighted energy of the individual
+    // visual samples. The pyramid knows the maximum energy, which we can only
+    // use if all bands are scaled by the same gain, e.g. if the EQs are not
+    // shown in the waveform or left centered. Otherwise we need to scan the
+    // samples.
+    const bool uniformBandGain = lowGain == midGain && midGain == highGain;
+    const float bandGainSquare = lowGain * lowGain;
 
     QColor color;
 
     QPen pen;
     pen.setCapStyle(Qt::FlatCap);
-    pen.setWidthF(math_max(1.0, 1.0 / m_waveformRenderer->getVisualSamplePerPixel()));
+    pen.setWidthF(view.penWidth);
 
-    const int breadth = m_waveformRenderer->getBreadth();
+    const int breadth = view.breadth;
     const float halfBreadth = static_cast<float>(breadth) / 2.0f;
 
     const float heightFactor = allGain * halfBreadth / sqrtf(255 * 255 * 3);
 
-    // Draw reference line
-    painter->setPen(m_pColors->getAxesColor());
-    painter->drawLine(QLineF(0, halfBreadth, m_waveformRenderer->getLength(), halfBreadth));
-
-    for (int x = 0; x < m_waveformRenderer->getLength(); ++x) {
+    for (int x = 0; x < view.columns; ++x) {
         // Width of the x position in visual indices.
         const double xSampleWidth = gain * x;
 
@@ -119,22 +128,33 @@ void WaveformRendererRGB::draw(QPainter* painter,
         float maxAll = 0.;
         float maxAllNext = 0.;
 
-        for (int i = visualIndexStart;
-             i >= 0 && i + 1 < dataSize && i + 1 <= visualIndexStop; i += 2) {
-            const WaveformData& waveformData = data[i];
-            const WaveformData& waveformDataNext = data[i + 1];
-
-            maxLow  = math_max3(maxLow,  waveformData.filtered.low,  waveformDataNext.filtered.low);
-            maxMid  = math_max3(maxMid,  waveformData.filtered.mid,  waveformDataNext.filtered.mid);
-            maxHigh = math_max3(maxHigh, waveformData.filtered.high, waveformDataNext.filtered.high);
-            float all = static_cast<float>(pow(waveformData.filtered.low * lowGain, 2) +
-                    pow(waveformData.filtered.mid * midGain, 2) +
-                    pow(waveformData.filtered.high * highGain, 2));
-            maxAll = math_max(maxAll, all);
-            float allNext = static_cast<float>(pow(waveformDataNext.filtered.low * lowGain, 2) +
-                    pow(waveformDataNext.filtered.mid * midGain, 2) +
-                    pow(waveformDataNext.filtered.high * highGain, 2));
-            maxAllNext = math_max(maxAllNext, allNext);
+        if (uniformBandGain) {
+            WaveformPeak peaks[ChannelCount];
+            waveform.getPeaks(visualFrameStart, visualFrameStop, peaks);
+            maxLow = math_max(peaks[Left].low, peaks[Right].low);
+            maxMid = math_max(peaks[Left].mid, peaks[Right].mid);
+            maxHigh = math_max(peaks[Left].high, peaks[Right].high);
+            maxAll = peaks[Left].energy * bandGainSquare;
+            maxAllNext = peaks[Right].energy * bandGainSquare;
+        } else {
+            for (int i = visualIndexStart;
+                    i >= 0 && i + 1 < dataSize && i + 1 <= visualIndexStop;
+                    i += 2) {
+                const WaveformData& waveformData = data[i];
+                const WaveformData& waveformDataNext = data[i + 1];
+
+                maxLow  = math_max3(maxLow,  waveformData.filtered.low,  waveformDataNext.filtered.low);
+                maxMid  = math_max3(maxMid,  waveformData.filtered.mid,  waveformDataNext.filtered.mid);
+                maxHigh = math_max3(maxHigh, waveformData.filtered.high, waveformDataNext.filtered.high);
+                float all = static_cast<float>(pow(waveformData.filtered.low * lowGain, 2) +
+                        pow(waveformData.filtered.mid * midGain, 2) +
+                        pow(waveformData.filtered.high * highGain, 2));
+                maxAll = math_max(maxAll, all);
+                float allNext = static_cast<float>(pow(waveformDataNext.filtered.low * lowGain, 2) +
+                        pow(waveformDataNext.filtered.mid * midGain, 2) +
+                        pow(waveformDataNext.filtered.high * highGain, 2));
+                maxAllNext = math_max(maxAllNext, allNext);
+            }
         }
 
         qreal maxLowF = maxLow * lowGain;
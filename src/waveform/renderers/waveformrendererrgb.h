@@ -13,5 +13,10 @@ class WaveformRendererRGB : public WaveformRendererSignalBase {
     virtual void draw(QPainter* painter, QPaintEvent* event);
 
   private:
+    // Called from the GUI thread or the worker thread of the rasterizer
+    void drawSignal(QPainter* painter, const WaveformSignalView& view) const;
+
+    WaveformSignalRasterizer m_rasterizer;
+
     DISALLOW_COPY_AND_ASSIGN(WaveformRendererRGB);
 };
@@ -6,6 +6,8 @@
 #include "waveformwidgetrenderer.h"
 #include "control/controlobject.h"
 #include "control/controlproxy.h"
+#include "track/track.h"
+#include "util/math.h"
 #include "widget/wskincolor.h"
 #include "widget/wwidget.h"
 
@@ -226,3 +228,49 @@ void WaveformRendererSignalBase::getGains(float* pAllGain, float* pLowGain,
         }
     }
 }
+
+bool WaveformRendererSignalBase::captureSignalView(
+        WaveformSignalView* pView, bool useBandGains) {
+    const TrackPointer trackInfo = m_waveformRenderer->getTrackInfo();
+    if (!trackInfo) {
+        return false;
+    }
+
+    ConstWaveformPointer waveform = trackInfo->getWaveform();
+    if (waveform.isNull()) {
+        return false;
+    }
+
+    const int dataSize = waveform->getDataSize();
+    if (dataSize <= 1) {
+        return false;
+    }
+
+    if (waveform->data() == nullptr) {
+        return false;
+    }
+
+    const double trackPixelCount = m_waveformRenderer->getTrackPixelCount();
+    if (trackPixelCount <= 0.0) {
+        return false;
+    }
+
+    pView->pWaveform = waveform;
+    pView->firstVisualIndex = m_waveformRenderer->getFirstDisplayedPosition() * dataSize;
+    // Equal to (lastVisualIndex - firstVisualIndex) / length, but does not
+    // change while the waveform scrolls.
+    pView->visualSamplesPerColumn = dataSize / trackPixelCount;
+    pView->columns = m_waveformRenderer->getLength();
+    pView->breadth = m_waveformRenderer->getBreadth();
+    pView->devicePixelRatio = m_waveformRenderer->getDevicePixelRatio();
+    pView->lowGain = 1.0;
+    pView->midGain = 1.0;
+    pView->highGain = 1.0;
+    if (useBandGains) {
+        getGains(&pView->allGain, &pView->lowGain, &pView->midGain, &pView->highGain);
+    } else {
+        getGains(&pView->allGain, nullptr, nullptr, nullptr);
+    }
+    pView->penWidth = math_max(1.0, 1.0 / m_waveformRenderer->getVisualSamplePerPixel());
+    return true;
+}
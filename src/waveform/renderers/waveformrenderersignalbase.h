@@ -3,6 +3,7 @@
 #include "waveformrendererabstract.h"
 #include "waveformsignalcolors.h"
 #include "skin/skincontext.h"
+#include "waveform/renderers/waveformsignalrasterizer.h"
 
 class ControlObject;
 class ControlProxy;
@@ -24,6 +25,12 @@ public:
     void getGains(float* pAllGain, float* pLowGain, float* pMidGain,
                   float* highGain);
 
+    // Captures the parameters of the visible signal from the
+    // WaveformWidgetRenderer. The band gains are left at 1 unless
+    // useBandGains is set, so renderers that do not use them are not
+    // invalidated by EQ changes. Returns false if there is nothing to draw.
+    bool captureSignalView(WaveformSignalView* pView, bool useBandGains);
+
   protected:
     ControlProxy* m_pEQEnabled;
     ControlProxy* m_pLowFilterControlObject;
@@ -0,0 +1,240 @@
+#include "waveform/renderers/waveformsignalrasterizer.h"
+
+#include <QPainter>
+#include <QThread>
+#include <QThreadPool>
+#include <QtConcurrentRun>
+#include <cmath>
+
+#include "util/math.h"
+#include "util/timer.h"
+
+namespace {
+
+// The number of columns that are rendered ahead of the visible columns
+int marginColumns(int visibleColumns) {
+    return math_max(visibleColumns / 2, 64);
+}
+
+// A dedicated pool, so strips are never queued behind cover art or
+// fingerprinting jobs in the global pool
+QThreadPool* rasterizerThreadPool() {
+    static QThreadPool s_pool;
+    static const bool s_initialized = [] {
+        // One thread per deck is enough, the strips are small
+        s_pool.setMaxThreadCount(math_min(QThread::idealThreadCount(), 4));
+        return true;
+    }();
+    Q_UNUSED(s_initialized);
+    return &s_pool;
+}
+
+} // anonymous namespace
+
+WaveformSignalRasterizer::WaveformSignalRasterizer(DrawFunction drawSignal)
+        : m_drawSignal(std::move(drawSignal)),
+          m_hasView(false),
+          m_generation(0),
+          m_ringColumns(0),
+          m_firstColumn(0),
+          m_lastColumn(0),
+          m_hasPendingStrip(false) {
+}
+
+WaveformSignalRasterizer::~WaveformSignalRasterizer() {
+    // The strip job calls back into the renderer that owns us
+    m_pendingStrip.waitForFinished();
+}
+
+// static
+bool WaveformSignalRasterizer::isCompatible(
+        const WaveformSignalView& lhs, const WaveformSignalView& rhs) {
+    return lhs.pWaveform == rhs.pWaveform &&
+            lhs.visualSamplesPerColumn == rhs.visualSamplesPerColumn &&
+            lhs.columns == rhs.columns &&
+            lhs.breadth == rhs.breadth &&
+            lhs.devicePixelRatio == rhs.devicePixelRatio &&
+            lhs.allGain == rhs.allGain &&
+            lhs.lowGain == rhs.lowGain &&
+            lhs.midGain == rhs.midGain &&
+            lhs.highGain == rhs.highGain &&
+            lhs.penWidth == rhs.penWidth;
+}
+
+bool WaveformSignalRasterizer::draw(QPainter* pPainter, const WaveformSignalView& view) {
+    if (!view.pWaveform ||
+            view.visualSamplesPerColumn <= 0.0 ||
+            view.columns <= 0 ||
+            view.breadth <= 0) {
+        return false;
+    }
+    // The data of a waveform that is still being analyzed changes, so it
+    // cannot be cached.
+    if (view.pWaveform->getCompletion() < view.pWaveform->getDataSize()) {
+        return false;
+    }
+    // Columns need to be aligned to physical pixels
+    if (view.devicePixelRatio != std::floor(view.devicePixelRatio)) {
+        return false;
+    }
+
+    if (!m_hasView || !isCompatible(m_view, view)) {
+        m_view = view;
+        m_hasView = true;
+        // Discard the strip that is rendered for the previous view
+        ++m_generation;
+        m_ringColumns = view.columns + 2 * marginColumns(view.columns);
+        const int pixelsPerColumn = static_cast<int>(view.devicePixelRatio);
+        m_ring = QImage(m_ringColumns * pixelsPerColumn,
+                view.breadth * pixelsPerColumn,
+                QImage::Format_ARGB32_Premultiplied);
+        m_firstColumn = 0;
+        m_lastColumn = 0;
+    }
+    takeFinishedStrip();
+
+    const int margin = marginColumns(view.columns);
+    const int firstVisible = static_cast<int>(
+            std::floor(view.firstVisualIndex / view.visualSamplesPerColumn));
+    const int lastVisible = firstVisible + view.columns;
+
+    if (firstVisible < m_firstColumn || lastVisible > m_lastColumn) {
+        // The pending strip may contain the missing columns
+        waitForStrip();
+    }
+    if (m_firstColumn == m_lastColumn ||
+            firstVisible >= m_lastColumn ||
+            lastVisible <= m_firstColumn) {
+        // Seek or new view
+        startStrip(firstVisible, lastVisible + margin);
+        waitForStrip();
+    }
+    if (firstVisible < m_firstColumn) {
+        startStrip(firstVisible - margin, m_firstColumn);
+        waitForStrip();
+    }
+    if (lastVisible > m_lastColumn) {
+        startStrip(m_lastColumn, lastVisible + margin);
+        waitForStrip();
+    }
+    VERIFY_OR_DEBUG_ASSERT(firstVisible >= m_firstColumn && lastVisible <= m_lastColumn) {
+        return false;
+    }
+
+    // Render the columns that will be exposed next in the background
+    if (!m_hasPendingStrip) {
+        if (m_lastColumn - lastVisible < margin / 2) {
+            startStrip(m_lastColumn, m_lastColumn + margin);
+        } else if (firstVisible - m_firstColumn < margin / 2) {
+            startStrip(m_firstColumn - margin, m_firstColumn);
+        }
+    }
+
+    blitColumns(pPainter, firstVisible, lastVisible);
+    return true;
+}
+
+void WaveformSignalRasterizer::startStrip(int firstColumn, int lastColumn) {
+    DEBUG_ASSERT(!m_hasPendingStrip);
+    DEBUG_ASSERT(lastColumn - firstColumn <= m_ringColumns);
+    WaveformSignalView stripView = m_view;
+    stripView.firstVisualIndex = firstColumn * m_view.visualSamplesPerColumn;
+    stripView.columns = lastColumn - firstColumn;
+    const int generation = m_generation;
+    const DrawFunction drawSignal = m_drawSignal;
+    m_pendingStrip = QtConcurrent::run(rasterizerThreadPool(),
+            [drawSignal, stripView, generation, firstColumn] {
+                ScopedTimer t("WaveformSignalRasterizer::renderStrip");
+                const int pixelsPerColumn = static_cast<int>(stripView.devicePixelRatio);
+                QImage image(stripView.columns * pixelsPerColumn,
+                        stripView.breadth * pixelsPerColumn,
+                        QImage::Format_ARGB32_Premultiplied);
+                image.setDevicePixelRatio(stripView.devicePixelRatio);
+                image.fill(Qt::transparent);
+                {
+                    QPainter painter(&image);
+                    drawSignal(&painter, stripView);
+                }
+                return Strip{generation, firstColumn, image};
+            });
+    m_hasPendingStrip = true;
+}
+
+void WaveformSignalRasterizer::waitForStrip() {
+    if (!m_hasPendingStrip) {
+        return;
+    }
+    ScopedTimer t("WaveformSignalRasterizer::waitForStrip");
+    m_pendingStrip.waitForFinished();
+    takeFinishedStrip();
+}
+
+void WaveformSignalRasterizer::takeFinishedStrip() {
+    if (!m_hasPendingStrip || !m_pendingStrip.isFinished()) {
+        return;
+    }
+    m_hasPendingStrip = false;
+    const Strip strip = m_pendingStrip.result();
+    m_pendingStrip = QFuture<Strip>();
+    if (strip.generation != m_generation) {
+        return;
+    }
+    storeStrip(strip);
+}
+
+void WaveformSignalRasterizer::storeStrip(const Strip& strip) {
+    const int pixelsPerColumn = static_cast<int>(m_view.devicePixelRatio);
+    const int firstColumn = strip.firstColumn;
+    const int lastColumn = firstColumn + strip.image.width() / pixelsPerColumn;
+
+    if (m_firstColumn == m_lastColumn ||
+            firstColumn > m_lastColumn ||
+            lastColumn < m_firstColumn) {
+        m_firstColumn = firstColumn;
+        m_lastColumn = lastColumn;
+    } else if (firstColumn >= m_firstColumn) {
+        // Scrolling forward, drop the columns at the start
+        m_lastColumn = math_max(m_lastColumn, lastColumn);
+        m_firstColumn = math_max(m_firstColumn, m_lastColumn - m_ringColumns);
+    } else {
+        // Scrolling backward, drop the columns at the end
+        m_firstColumn = firstColumn;
+        m_lastColumn = math_min(m_lastColumn, m_firstColumn + m_ringColumns);
+    }
+
+    QPainter painter(&m_ring);
+    painter.setCompositionMode(QPainter::CompositionMode_Source);
+    int column = firstColumn;
+    while (column < lastColumn) {
+        // Split at the end of the ring
+        const int ringColumn = ((column % m_ringColumns) + m_ringColumns) % m_ringColumns;
+        const int count = math_min(lastColumn - column, m_ringColumns - ringColumn);
+        const QRect target(ringColumn * pixelsPerColumn,
+                0,
+                count * pixelsPerColumn,
+                m_ring.height());
+        const QRect source((column - firstColumn) * pixelsPerColumn,
+                0,
+                count * pixelsPerColumn,
+                m_ring.height());
+        painter.drawImage(target, strip.image, source);
+        column += count;
+    }
+}
+
+void WaveformSignalRasterizer::blitColumns(
+        QPainter* pPainter, int firstColumn, int lastColumn) {
+    const int pixelsPerColumn = static_cast<int>(m_view.devicePixelRatio);
+    int column = firstColumn;
+    while (column < lastColumn) {
+        const int ringColumn = ((column % m_ringColumns) + m_ringColumns) % m_ringColumns;
+        const int count = math_min(lastColumn - column, m_ringColumns - ringColumn);
+        const QRectF target(column - firstColumn, 0, count, m_view.breadth);
+        const QRectF source(ringColumn * pixelsPerColumn,
+                0,
+                count * pixelsPerColumn,
+                m_ring.height());
+        pPainter->drawImage(target, m_ring, source);
+        column += count;
+    }
+}
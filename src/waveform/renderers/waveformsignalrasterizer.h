@@ -0,0 +1,89 @@
+#pragma once
+
+#include <QFuture>
+#include <QImage>
+#include <functional>
+
+#include "waveform/waveform.h"
+
+class QPainter;
+
+// The parameters of a horizontal waveform signal over a range of pixel
+// columns. It is captured in the GUI thread and passed by value to the
+// worker thread.
+struct WaveformSignalView {
+    ConstWaveformPointer pWaveform;
+    // The visual sample index (interleaved channels) of column 0
+    double firstVisualIndex;
+    // The number of visual samples per pixel column
+    double visualSamplesPerColumn;
+    int columns;
+    int breadth;
+    qreal devicePixelRatio;
+    float allGain;
+    float lowGain;
+    float midGain;
+    float highGain;
+    qreal penWidth;
+};
+
+// Prepares the signal layer of a QPainter based waveform renderer in a worker
+// thread.
+//
+// The signal is rendered into strips of pixel columns, which are aligned to
+// absolute columns of the track at the current zoom. The strips are stored in
+// an image that is used as a ring buffer. While the waveform scrolls, the
+// GUI thread only blits the visible columns from the ring and the worker
+// renders the strip that will be exposed next. A strip is only rendered
+// synchronously (waiting for the worker) after a seek, a zoom or a gain
+// change.
+//
+// The draw function is called from the worker thread. It must only use the
+// passed view and state of the renderer that does not change after setup.
+class WaveformSignalRasterizer {
+  public:
+    typedef std::function<void(QPainter* pPainter, const WaveformSignalView& view)>
+            DrawFunction;
+
+    explicit WaveformSignalRasterizer(DrawFunction drawSignal);
+    ~WaveformSignalRasterizer();
+
+    // Composites the signal of the visible columns described by view into
+    // pPainter. Returns false if the view cannot be rasterized in strips and
+    // the caller needs to draw it directly.
+    // All rendered columns are discarded when the track, the zoom or the
+    // gains in view differ from the rendered ones.
+    bool draw(QPainter* pPainter, const WaveformSignalView& view);
+
+  private:
+    struct Strip {
+        int generation;
+        int firstColumn;
+        QImage image;
+    };
+
+    static bool isCompatible(const WaveformSignalView& lhs, const WaveformSignalView& rhs);
+
+    void startStrip(int firstColumn, int lastColumn);
+    void waitForStrip();
+    void takeFinishedStrip();
+    void storeStrip(const Strip& strip);
+    void blitColumns(QPainter* pPainter, int firstColumn, int lastColumn);
+
+    const DrawFunction m_drawSignal;
+
+    // The parameters of the rendered columns
+    WaveformSignalView m_view;
+    bool m_hasView;
+    int m_generation;
+
+    // Each absolute column c is stored at x = c mod m_ring.width()
+    QImage m_ring;
+    int m_ringColumns;
+    // The rendered columns [m_firstColumn, m_lastColumn)
+    int m_firstColumn;
+    int m_lastColumn;
+
+    QFuture<Strip> m_pendingStrip;
+    bool m_hasPendingStrip;
+};
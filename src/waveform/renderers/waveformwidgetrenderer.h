@@ -81,6 +81,11 @@ class WaveformWidgetRenderer {
         return m_trackPixelCount * (position - m_firstDisplayedPosition);
     }
 
+    // The length of the track in pixels at the current zoom
+    double getTrackPixelCount() const {
+        return m_trackPixelCount;
+    }
+
     double getPlayPos() const {
         return m_playPos;
     }
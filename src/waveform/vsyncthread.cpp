@@ -6,6 +6,7 @@
 #include <QtDebug>
 
 #include "moc_vsyncthread.cpp"
+#include "util/frametimeline.h"
 #include "util/math.h"
 #include "util/performancetimer.h"
 #include "waveform/guitick.h"
@@ -80,6 +81,9 @@ void VSyncThread::run() {
                 // Our swapping call was already delayed
                 // The real swap might happens on the following VSync, depending on driver settings
                 m_droppedFrames++; // Count as Real Time Error
+                if (FrameTimeline::isEnabled()) {
+                    FrameTimeline::instance().recordInstant("VSync missed");
+                }
             }
             // try to stay in right intervals
             m_waitToSwapMicros = m_syncIntervalTimeMicros +
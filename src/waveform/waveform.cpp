@@ -1,11 +1,30 @@
+#include <QDataStream>
 #include <QtDebug>
 
 #include "waveform/waveform.h"
 #include "proto/waveform.pb.h"
+#include "util/assert.h"
 
 using namespace mixxx::track;
 
-const int kNumChannels = 2;
+namespace {
+
+// Binary format, all numbers are little endian:
+//   char[4] magic "MXWF"
+//   quint32 version
+//   quint32 dataSize
+//   double  visualSampleRate
+//   double  audioVisualRatio
+//   quint8[dataSize] low, quint8[dataSize] mid, quint8[dataSize] high,
+//   quint8[dataSize] all
+// The samples of each band are interleaved by channel like in WaveformData.
+// Waveforms stored as protobuf (waveform.proto) before are still read.
+constexpr char kBinaryMagic[4] = {'M', 'X', 'W', 'F'};
+constexpr quint32 kBinaryVersion = 1;
+constexpr int kBinaryHeaderSize = 4 + 4 + 4 + 8 + 8;
+constexpr int kBinaryBandCount = 4;
+
+} // anonymous namespace
 
 // Return the smallest power of 2 which is greater than the desired size when
 // squared.
@@ -68,75 +87,107 @@ Waveform::~Waveform() {
 }
 
 QByteArray Waveform::toByteArray() const {
-    io::Waveform waveform;
-    waveform.set_visual_sample_rate(m_visualSampleRate);
-    waveform.set_audio_visual_ratio(m_audioVisualRatio);
-
-    io::Waveform::Signal* all = waveform.mutable_signal_all();
-    io::Waveform::FilteredSignal* filtered = waveform.mutable_signal_filtered();
-    // TODO(rryan) get the actual cutoff values from analyzerwaveform.cpp so
-    // that if they change we don't have to remember to update these.
-
-    // Frequency cutoffs for butterworth filters:
-    // filtered->set_low_cutoff_frequency(200);
-    // filtered->set_mid_low_cutoff_frequency(200);
-    // filtered->set_mid_high_cutoff_frequency(2000);
-    // filtered->set_high_cutoff_frequency(2000);
-
-    // Frequency cutoff for bessel_lowpass4
-    filtered->set_low_cutoff_frequency(600);
-    // Frequency cutoff for bessel_bandpass
-    filtered->set_mid_low_cutoff_frequency(600);
-    filtered->set_mid_high_cutoff_frequency(4000);
-    // Frequency cutoff for bessel_highpass4
-    filtered->set_high_cutoff_frequency(4000);
-
-    io::Waveform::Signal* low = filtered->mutable_low();
-    io::Waveform::Signal* mid = filtered->mutable_mid();
-    io::Waveform::Signal* high = filtered->mutable_high();
-
-    // TODO(vrince) set max/min for each signal
-    int numChannels = kNumChannels;
-    all->set_units(io::Waveform::RMS);
-    all->set_channels(numChannels);
-    low->set_units(io::Waveform::RMS);
-    low->set_channels(numChannels);
-    mid->set_units(io::Waveform::RMS);
-    mid->set_channels(numChannels);
-    high->set_units(io::Waveform::RMS);
-    high->set_channels(numChannels);
-
-    int dataSize = getDataSize();
+    // The bands are stored in separate contiguous arrays, which compress
+    // much better than the interleaved samples and can be copied into the
+    // waveform without parsing.
+    const int dataSize = getDataSize();
+    QByteArray output;
+    output.reserve(kBinaryHeaderSize + kBinaryBandCount * dataSize);
+    {
+        QDataStream stream(&output, QIODevice::WriteOnly);
+        stream.setByteOrder(QDataStream::LittleEndian);
+        stream.writeRawData(kBinaryMagic, sizeof(kBinaryMagic));
+        stream << kBinaryVersion
+               << static_cast<quint32>(dataSize)
+               << m_visualSampleRate
+               << m_audioVisualRatio;
+    }
+    DEBUG_ASSERT(output.size() == kBinaryHeaderSize);
+    output.resize(kBinaryHeaderSize + kBinaryBandCount * dataSize);
+    auto* pLow = reinterpret_cast<unsigned char*>(output.data() + kBinaryHeaderSize);
+    auto* pMid = pLow + dataSize;
+    auto* pHigh = pMid + dataSize;
+    auto* pAll = pHigh + dataSize;
     for (int i = 0; i < dataSize; ++i) {
-        const WaveformData& datum = m_data.at(i);
-        all->add_value(datum.filtered.all);
-        low->add_value(datum.filtered.low);
-        mid->add_value(datum.filtered.mid);
-        high->add_value(datum.filtered.high);
+        const WaveformData& datum = m_data[i];
+        pLow[i] = datum.filtered.low;
+        pMid[i] = datum.filtered.mid;
+        pHigh[i] = datum.filtered.high;
+        pAll[i] = datum.filtered.all;
     }
 
-    qDebug() << "Writing waveform from byte array:"
+    qDebug() << "Writing waveform to byte array:"
              << "dataSize" << dataSize
-             << "allSignalSize" << all->value_size()
-             << "visualSampleRate" << waveform.visual_sample_rate()
-             << "audioVisualRatio" << waveform.audio_visual_ratio();
-
-    std::string output;
-    waveform.SerializeToString(&output);
-    return QByteArray(output.data(), static_cast<int>(output.length()));
+             << "visualSampleRate" << m_visualSampleRate
+             << "audioVisualRatio" << m_audioVisualRatio;
+    return output;
 }
 
 void Waveform::readByteArray(const QByteArray& data) {
     if (data.isNull()) {
         return;
     }
+    if (data.startsWith(QByteArray::fromRawData(kBinaryMagic, sizeof(kBinaryMagic)))) {
+        readBinaryByteArray(data);
+    } else {
+        readProtobufByteArray(data);
+    }
+}
 
+bool Waveform::readBinaryByteArray(const QByteArray& data) {
+    quint32 version = 0;
+    quint32 dataSize = 0;
+    double visualSampleRate = 0;
+    double audioVisualRatio = 0;
+    {
+        QDataStream stream(data);
+        stream.setByteOrder(QDataStream::LittleEndian);
+        stream.skipRawData(sizeof(kBinaryMagic));
+        stream >> version >> dataSize >> visualSampleRate >> audioVisualRatio;
+        if (stream.status() != QDataStream::Ok) {
+            qWarning() << "ERROR: Truncated waveform header of size" << data.size();
+            return false;
+        }
+    }
+    if (version != kBinaryVersion) {
+        qWarning() << "ERROR: Unsupported waveform version" << version;
+        return false;
+    }
+    if (dataSize > static_cast<quint32>(
+                (data.size() - kBinaryHeaderSize) / kBinaryBandCount)) {
+        qWarning() << "ERROR: Waveform of size" << dataSize
+                   << "does not fit into" << data.size() << "bytes";
+        return false;
+    }
+
+    resize(static_cast<int>(dataSize));
+    m_visualSampleRate = visualSampleRate;
+    m_audioVisualRatio = audioVisualRatio;
+    const auto* pLow = reinterpret_cast<const unsigned char*>(
+            data.constData() + kBinaryHeaderSize);
+    const auto* pMid = pLow + dataSize;
+    const auto* pHigh = pMid + dataSize;
+    const auto* pAll = pHigh + dataSize;
+    for (int i = 0; i < m_dataSize; ++i) {
+        WaveformData& datum = m_data[i];
+        datum.filtered.low = pLow[i];
+        datum.filtered.mid = pMid[i];
+        datum.filtered.high = pHigh[i];
+        datum.filtered.all = pAll[i];
+    }
+    m_pyramid.update(this->data(), 0, m_dataSize);
+    m_completion = m_dataSize;
+    m_saveState = SaveState::Saved;
+    return true;
+}
+
+bool Waveform::readProtobufByteArray(const QByteArray& data) {
     io::Waveform waveform;
 
     if (!waveform.ParseFromArray(data.constData(), data.size())) {
         qDebug() << "ERROR: Could not parse Waveform from QByteArray of size "
                  << data.size();
-        return;
+        return false;
     }
 
     if (!waveform.has_visual_sample_rate() ||
@@ -147,7 +198,7 @@ void Waveform::readByteArray(const QByteArray& data) {
         !waveform.signal_filtered().has_mid() ||
         !waveform.signal_filtered().has_high()) {
         qDebug() << "ERROR: Waveform proto is missing key data. Skipping.";
-        return;
+        return false;
     }
 
     const io::Waveform::Signal& all = waveform.signal_all();
@@ -168,7 +219,7 @@ void Waveform::readByteArray(const QByteArray& data) {
                  << "while reading.";
         resize(0);
         m_saveState = SaveState::NotSaved;
-        return;
+        return false;
     }
 
     m_visualSampleRate = waveform.visual_sample_rate();
@@ -193,20 +244,32 @@ void Waveform::readByteArray(const QByteArray& data) {
         m_data[i].filtered.mid = use_mid ? static_cast<unsigned char>(mid.value(i)) : 0;
         m_data[i].filtered.high = use_high ? static_cast<unsigned char>(high.value(i)) : 0;
     }
+    m_pyramid.update(this->data(), 0, dataSize);
     m_completion = dataSize;
-    m_saveState = SaveState::Saved;
+    // Migrate the legacy format: The waveform is rewritten in the binary
+    // format the next time the track is saved.
+    m_saveState = SaveState::SavePending;
+    return true;
+}
+
+void Waveform::setCompletion(int completion) {
+    // Only the analyzer thread writes the data and the completion
+    m_pyramid.update(data(), atomicLoadRelaxed(m_completion), completion);
+    m_completion = completion;
 }
 
 void Waveform::resize(int size) {
     m_dataSize = size;
     m_textureStride = computeTextureStride(size);
     m_data.resize(m_textureStride * m_textureStride);
+    m_pyramid.resize(size);
 }
 
 void Waveform::assign(int size, int value) {
     m_dataSize = size;
     m_textureStride = computeTextureStride(size);
     m_data.assign(m_textureStride * m_textureStride, value);
+    m_pyramid.resize(size);
     m_saveState = SaveState::SavePending;
 }
 
@@ -11,6 +11,7 @@
 
 #include "util/class.h"
 #include "util/compatibility.h"
+#include "waveform/waveformpyramid.h"
 
 enum FilterIndex { Low = 0, Mid = 1, High = 2, FilterCount = 3};
 enum ChannelIndex { Left = 0, Right = 1, ChannelCount = 2};
@@ -72,6 +73,8 @@ class Waveform {
         m_description = description;
     }
 
+    // Serializes the waveform in the versioned binary format with
+    // the samples of each band stored contiguously
     QByteArray toByteArray() const;
 
     // We do not lock the mutex since m_dataSize and m_visualSampleRate are not
@@ -101,9 +104,9 @@ class Waveform {
     int getCompletion() const {
         return atomicLoadAcquire(m_completion);
     }
-    void setCompletion(int completion) {
-        m_completion = completion;
-    }
+    // Also updates the pyramid for the visual samples that have been
+    // completed since the previous call.
+    void setCompletion(int completion);
 
     // We do not lock the mutex since m_textureStride is not changed after
     // the constructor runs.
@@ -124,6 +127,13 @@ class Waveform {
     inline unsigned char getHigh(int i) const { return m_data[i].filtered.high;}
     inline unsigned char getAll(int i) const { return m_data[i].filtered.all;}
 
+    // Writes the peaks of both channels over the visual frames
+    // [firstFrame, endFrame) to pPeaks[ChannelCount]. This is much faster
+    // than scanning the data for zoomed out waveforms.
+    void getPeaks(int firstFrame, int endFrame, WaveformPeak* pPeaks) const {
+        m_pyramid.getPeaks(data(), firstFrame, endFrame, pPeaks);
+    }
+
     // We do not lock the mutex since m_data is not resized after the
     // constructor runs.
     WaveformData* data() { return &m_data[0];}
@@ -136,6 +146,9 @@ class Waveform {
 
   private:
     void readByteArray(const QByteArray& data);
+    bool readBinaryByteArray(const QByteArray& data);
+    // Waveforms stored before the binary format was introduced
+    bool readProtobufByteArray(const QByteArray& data);
     void resize(int size);
     void assign(int size, int value = 0);
 
@@ -164,6 +177,9 @@ class Waveform {
     // TODO(XXX): In the future we should switch to QVector and use the raw data
     // pointer when performance matters.
     std::vector<WaveformData> m_data;
+    // Peaks of m_data at multiple resolutions. Only resized together with
+    // m_data.
+    WaveformPyramid m_pyramid;
     // Not allowed to change after the constructor runs.
     double m_visualSampleRate;
     // Not allowed to change after the constructor runs.
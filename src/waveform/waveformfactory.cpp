@@ -8,8 +8,20 @@ Waveform* WaveformFactory::loadWaveformFromAnalysis(
         const AnalysisDao::AnalysisInfo& analysis) {
     Waveform* pWaveform = new Waveform(analysis.data);
     pWaveform->setId(analysis.analysisId);
-    pWaveform->setVersion(analysis.version);
-    pWaveform->setDescription(analysis.description);
+    if (pWaveform->saveState() == Waveform::SaveState::SavePending) {
+        // A legacy protobuf blob that is rewritten in the current format
+        // the next time the track is saved
+        if (analysis.type == AnalysisDao::TYPE_WAVESUMMARY) {
+            pWaveform->setVersion(currentWaveformSummaryVersion());
+            pWaveform->setDescription(currentWaveformSummaryDescription());
+        } else {
+            pWaveform->setVersion(currentWaveformVersion());
+            pWaveform->setDescription(currentWaveformDescription());
+        }
+    } else {
+        pWaveform->setVersion(analysis.version);
+        pWaveform->setDescription(analysis.description);
+    }
     return pWaveform;
 }
 
@@ -20,6 +32,11 @@ WaveformFactory::VersionClass WaveformFactory::waveformVersionToVersionClass(con
         return VC_USE;
     }
 
+    if (version == WAVEFORM_5_VERSION) {
+        // Stored as protobuf, which is still read and migrated
+        return VC_USE;
+    }
+
     if (version == WAVEFORM_4_VERSION) {
         // Used in Mixxx 1.12 beta, suffers Bug lp:1406389
         return VC_REMOVE;
@@ -46,6 +63,11 @@ WaveformFactory::VersionClass WaveformFactory::waveformSummaryVersionToVersionCl
         return VC_USE;
     }
 
+    if (version == WAVEFORMSUMMARY_5_VERSION) {
+        // Stored as protobuf, which is still read and migrated
+        return VC_USE;
+    }
+
     if (version == WAVEFORMSUMMARY_4_VERSION) {
         // Used in Mixxx 1.12 beta, suffers Bug lp:1406389
         return VC_REMOVE;
@@ -27,10 +27,16 @@ class Waveform;
 #define WAVEFORM_5_DESCRIPTION "Waveform 5.0"
 #define WAVEFORMSUMMARY_5_DESCRIPTION "WaveformSummary 5.0"
 
-#define WAVEFORM_CURRENT_VERSION WAVEFORM_5_VERSION
-#define WAVEFORMSUMMARY_CURRENT_VERSION WAVEFORMSUMMARY_5_VERSION
-#define WAVEFORM_CURRENT_DESCRIPTION WAVEFORM_5_DESCRIPTION
-#define WAVEFORMSUMMARY_CURRENT_DESCRIPTION WAVEFORMSUMMARY_5_DESCRIPTION
+// Used from Mixxx 2.4, stored in the MXWF binary format instead of protobuf
+#define WAVEFORM_6_VERSION "Waveform-6.0"
+#define WAVEFORMSUMMARY_6_VERSION "WaveformSummary-6.0"
+#define WAVEFORM_6_DESCRIPTION "Waveform 6.0"
+#define WAVEFORMSUMMARY_6_DESCRIPTION "WaveformSummary 6.0"
+
+#define WAVEFORM_CURRENT_VERSION WAVEFORM_6_VERSION
+#define WAVEFORMSUMMARY_CURRENT_VERSION WAVEFORMSUMMARY_6_VERSION
+#define WAVEFORM_CURRENT_DESCRIPTION WAVEFORM_6_DESCRIPTION
+#define WAVEFORMSUMMARY_CURRENT_DESCRIPTION WAVEFORMSUMMARY_6_DESCRIPTION
 
 
 class WaveformFactory {
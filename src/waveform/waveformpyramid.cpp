@@ -0,0 +1,128 @@
+#include "waveform/waveformpyramid.h"
+
+#include "util/assert.h"
+#include "util/math.h"
+#include "waveform/waveform.h"
+
+namespace {
+
+constexpr int kChannels = WaveformPyramid::kChannels;
+
+int blockCount(int frames, int level) {
+    return (frames + (1 << level) - 1) >> level;
+}
+
+} // anonymous namespace
+
+// static
+WaveformPeak WaveformPeak::fromData(const WaveformData& data) {
+    const quint32 low = data.filtered.low;
+    const quint32 mid = data.filtered.mid;
+    const quint32 high = data.filtered.high;
+    return WaveformPeak{data.filtered.low,
+            data.filtered.mid,
+            data.filtered.high,
+            data.filtered.all,
+            low * low + mid * mid + high * high};
+}
+
+void WaveformPeak::merge(const WaveformPeak& other) {
+    low = math_max(low, other.low);
+    mid = math_max(mid, other.mid);
+    high = math_max(high, other.high);
+    all = math_max(all, other.all);
+    energy = math_max(energy, other.energy);
+}
+
+WaveformPyramid::WaveformPyramid()
+        : m_frames(0) {
+}
+
+void WaveformPyramid::resize(int dataSize) {
+    m_frames = dataSize / kChannels;
+    m_levels.clear();
+    for (int level = kFirstStoredLevel; (1 << (level - 1)) < m_frames; ++level) {
+        m_levels.emplace_back(blockCount(m_frames, level) * kChannels,
+                WaveformPeak{0, 0, 0, 0, 0});
+    }
+}
+
+WaveformPeak WaveformPyramid::peak(const WaveformData* pData, int level, int index) const {
+    // index addresses a block of one channel
+    if (level >= kFirstStoredLevel) {
+        return m_levels[level - kFirstStoredLevel][index];
+    }
+    const int channel = index % kChannels;
+    const int firstFrame = (index / kChannels) << level;
+    const int lastFrame = math_min(firstFrame + (1 << level), m_frames) - 1;
+    WaveformPeak result = WaveformPeak::fromData(pData[firstFrame * kChannels + channel]);
+    for (int frame = firstFrame + 1; frame <= lastFrame; ++frame) {
+        result.merge(WaveformPeak::fromData(pData[frame * kChannels + channel]));
+    }
+    return result;
+}
+
+void WaveformPyramid::update(const WaveformData* pData, int oldCompletion, int newCompletion) {
+    if (m_levels.empty() || newCompletion <= oldCompletion) {
+        return;
+    }
+    int firstFrame = math_max(oldCompletion, 0) / kChannels;
+    // A visual frame is complete when both channels are
+    int lastFrame = math_min(newCompletion / kChannels, m_frames) - 1;
+    if (lastFrame < firstFrame) {
+        return;
+    }
+    for (int level = kFirstStoredLevel; level < levelCount(); ++level) {
+        const int firstBlock = firstFrame >> level;
+        const int lastBlock = lastFrame >> level;
+        std::vector<WaveformPeak>& blocks = m_levels[level - kFirstStoredLevel];
+        for (int block = firstBlock; block <= lastBlock; ++block) {
+            for (int channel = 0; channel < kChannels; ++channel) {
+                // Combine the two blocks of the level below, the second one
+                // may be beyond the end for odd block counts.
+                const int child = 2 * block * kChannels + channel;
+                WaveformPeak result = peak(pData, level - 1, child);
+                if (2 * block + 1 < blockCount(m_frames, level - 1)) {
+                    result.merge(peak(pData, level - 1, child + kChannels));
+                }
+                blocks[block * kChannels + channel] = result;
+            }
+        }
+    }
+}
+
+void WaveformPyramid::getPeaks(const WaveformData* pData,
+        int firstFrame,
+        int endFrame,
+        WaveformPeak* pPeaks) const {
+    for (int channel = 0; channel < kChannels; ++channel) {
+        pPeaks[channel] = WaveformPeak{0, 0, 0, 0, 0};
+    }
+
+    // Bottom-up walk like in a segment tree: The blocks at the borders of the
+    // half open range [begin, end) that are not covered by a block of the
+    // next level are merged at the current level.
+    int begin = math_max(firstFrame, 0);
+    int end = math_min(endFrame, m_frames);
+    for (int level = 0; begin < end; ++level) {
+        if (level == levelCount()) {
+            // Only possible for a single remaining top level block
+            DEBUG_ASSERT(false);
+            break;
+        }
+        if (begin & 1) {
+            for (int channel = 0; channel < kChannels; ++channel) {
+                pPeaks[channel].merge(peak(pData, level, begin * kChannels + channel));
+            }
+            ++begin;
+        }
+        if (end & 1) {
+            --end;
+            for (int channel = 0; channel < kChannels; ++channel) {
+                pPeaks[channel].merge(peak(pData, level, end * kChannels + channel));
+            }
+        }
+        begin >>= 1;
+        end >>= 1;
+    }
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <QtGlobal>
+#include <vector>
+
+union WaveformData;
+
+// The maxima of the bands of one channel over a range of visual frames.
+struct WaveformPeak {
+    unsigned char low;
+    unsigned char mid;
+    unsigned char high;
+    unsigned char all;
+    // The maximum of low² + mid² + high² of the individual visual samples,
+    // which is the height of the RGB waveform.
+    quint32 energy;
+
+    static WaveformPeak fromData(const WaveformData& data);
+
+    void merge(const WaveformPeak& other);
+};
+
+// A min/max pyramid (mip-map) over the visual samples of a Waveform.
+//
+// Level k of the pyramid holds the peaks of blocks of 2^k visual frames of
+// both channels, interleaved like the waveform data. The levels 0 and 1 are
+// not stored, they are read from the waveform data directly. This keeps the
+// memory overhead at the size of the waveform data.
+//
+// This allows to answer the peaks of an arbitrary range of visual frames,
+// e.g. the frames below a pixel column of a zoomed out waveform, with
+// 2 * log2(frames) lookups instead of scanning all of them.
+//
+// The pyramid is updated incrementally from the analyzer thread while the
+// renderers read it from the main thread, like the waveform data itself.
+// Readers may see a partially updated block, which is corrected in the next
+// frame.
+class WaveformPyramid {
+  public:
+    static constexpr int kChannels = 2;
+
+    WaveformPyramid();
+
+    // Allocates the levels for dataSize visual samples (both channels)
+    void resize(int dataSize);
+
+    // Updates all blocks that contain the visual samples
+    // [oldCompletion, newCompletion) of pData.
+    void update(const WaveformData* pData, int oldCompletion, int newCompletion);
+
+    // Writes the peaks of both channels over the visual frames
+    // [firstFrame, endFrame) to pPeaks[kChannels].
+    void getPeaks(const WaveformData* pData,
+            int firstFrame,
+            int endFrame,
+            WaveformPeak* pPeaks) const;
+
+    int levelCount() const {
+        return static_cast<int>(m_levels.size()) + kFirstStoredLevel;
+    }
+
+  private:
+    static constexpr int kFirstStoredLevel = 2;
+
+    WaveformPeak peak(const WaveformData* pData, int level, int index) const;
+
+    int m_frames;
+    // m_levels[i] stores level i + kFirstStoredLevel
+    std::vector<std::vector<WaveformPeak>> m_levels;
+};
@@ -13,6 +13,7 @@
 #include "control/controlpotmeter.h"
 #include "moc_waveformwidgetfactory.cpp"
 #include "util/cmdlineargs.h"
+#include "util/frametimeline.h"
 #include "util/math.h"
 #include "util/performancetimer.h"
 #include "util/timer.h"
@@ -628,6 +629,7 @@ void WaveformWidgetFactory::notifyZoomChange(WWaveformViewer* viewer) {
 void WaveformWidgetFactory::render() {
     ScopedTimer t("WaveformWidgetFactory::render() %1waveforms",
             static_cast<int>(m_waveformWidgetHolders.size()));
+    FrameTimeline::Scope frameTimelineScope("WaveformWidgetFactory::render");
 
     //int paintersSetupTime0 = 0;
     //int paintersSetupTime1 = 0;
@@ -665,7 +667,13 @@ void WaveformWidgetFactory::render() {
                 if (!shouldRenderWaveforms[i]) {
                     continue;
                 }
-                pWaveformWidget->render();
+                {
+                    ScopedTimer t("WaveformWidgetFactory::render() waveform %1",
+                            static_cast<int>(i));
+                    FrameTimeline::Scope frameTimelineScope(
+                            "WaveformWidget::render", static_cast<int>(i));
+                    pWaveformWidget->render();
+                }
                 //qDebug() << "render" << i << m_vsyncThread->elapsed();
             }
         }
@@ -700,6 +708,7 @@ void WaveformWidgetFactory::render() {
 void WaveformWidgetFactory::swap() {
     ScopedTimer t("WaveformWidgetFactory::swap() %1waveforms",
             static_cast<int>(m_waveformWidgetHolders.size()));
+    FrameTimeline::Scope frameTimelineScope("WaveformWidgetFactory::swap");
 
     // Do this in an extra slot to be sure to hit the desired interval
     if (!m_skipRender) {
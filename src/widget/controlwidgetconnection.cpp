@@ -14,9 +14,30 @@ ControlWidgetConnection::ControlWidgetConnection(
         const ConfigKey& key,
         ValueTransformer* pTransformer)
         : m_pWidget(pBaseWidget),
-          m_pValueTransformer(pTransformer) {
+          m_pValueTransformer(pTransformer),
+          m_coalescedIndex(ControlChangeCoalescer::kInvalidIndex) {
     m_pControl = new ControlProxy(key, this, ControlFlag::NoAssertIfMissing);
-    m_pControl->connectValueChanged(this, &ControlWidgetConnection::slotControlValueChanged);
+    if (ControlChangeCoalescer::isEnabled() && m_pControl->valid()) {
+        ControlChangeCoalescer& coalescer = ControlChangeCoalescer::instance();
+        m_coalescedIndex = coalescer.subscribe(this);
+        if (isCoalesced() && !m_pControl->connectValueChangedCoalesced(m_coalescedIndex)) {
+            coalescer.unsubscribe(m_coalescedIndex);
+            m_coalescedIndex = ControlChangeCoalescer::kInvalidIndex;
+        }
+    }
+    if (!isCoalesced()) {
+        m_pControl->connectValueChanged(this, &ControlWidgetConnection::slotControlValueChanged);
+    }
+}
+
+ControlWidgetConnection::~ControlWidgetConnection() {
+    if (isCoalesced()) {
+        ControlChangeCoalescer::instance().unsubscribe(m_coalescedIndex);
+    }
+}
+
+void ControlWidgetConnection::deliverCoalescedChange() {
+    slotControlValueChanged(m_pControl->get());
 }
 
 void ControlWidgetConnection::setControlParameter(double parameter) {
@@ -5,19 +5,21 @@
 #include <QScopedPointer>
 #include <QByteArray>
 
+#include "control/controlchangecoalescer.h"
 #include "control/controlproxy.h"
 #include "util/valuetransformer.h"
 
 class WBaseWidget;
 class ValueTransformer;
 
-class ControlWidgetConnection : public QObject {
+class ControlWidgetConnection : public QObject, public CoalescedControlSubscriber {
     Q_OBJECT
   public:
     // Takes ownership of pControl and pTransformer.
     ControlWidgetConnection(WBaseWidget* pBaseWidget,
                             const ConfigKey& key,
                             ValueTransformer* pTransformer);
+    ~ControlWidgetConnection() override;
 
     double getControlParameter() const;
     double getControlParameterForValue(double value) const;
@@ -28,6 +30,14 @@ class ControlWidgetConnection : public QObject {
 
     virtual QString toDebugString() const = 0;
 
+    // True if the widget receives only the latest value once per GUI frame
+    // from the ControlChangeCoalescer
+    bool isCoalesced() const {
+        return m_coalescedIndex != ControlChangeCoalescer::kInvalidIndex;
+    }
+
+    void deliverCoalescedChange() override;
+
   protected slots:
     virtual void slotControlValueChanged(double v) = 0;
 
@@ -43,6 +53,7 @@ class ControlWidgetConnection : public QObject {
 
   private:
     QScopedPointer<ValueTransformer> m_pValueTransformer;
+    int m_coalescedIndex;
 };
 
 class ControlParameterWidgetConnection final : public ControlWidgetConnection {
@@ -31,6 +31,7 @@
 #include "util/color/color.h"
 #include "util/compatibility.h"
 #include "util/dnd.h"
+#include "util/frametimeline.h"
 #include "util/duration.h"
 #include "util/math.h"
 #include "util/painterscope.h"
@@ -69,7 +70,10 @@ WOverview::WOverview(
           m_b(0.0),
           m_analyzerProgress(kAnalyzerProgressUnknown),
           m_trackLoaded(false),
-          m_scaleFactor(1.0) {
+          m_scaleFactor(1.0),
+          m_waveformLayerDirty(true),
+          m_markLayersDirty(true),
+          m_markLayersGain(0.0f) {
     m_endOfTrackControl = new ControlProxy(
             m_group, "end_of_track", this, ControlFlag::NoAssertIfMissing);
     m_endOfTrackControl->connectValueChanged(this, &WOverview::onEndOfTrackChange);
@@ -235,12 +239,8 @@ void WOverview::onConnectedControlChanged(double dParameter, double dValue) {
     // all we represent with this widget.
     dParameter = math_clamp(dParameter, 0.0, 1.0);
 
-    bool redraw = false;
     int oldPos = m_iPlayPos;
     m_iPlayPos = valueToPosition(dParameter);
-    if (oldPos != m_iPlayPos) {
-        redraw = true;
-    }
 
     if (!m_bLeftClickDragging) {
         // if not dragged the pick-up moves with the play position
@@ -254,11 +254,11 @@ void WOverview::onConnectedControlChanged(double dParameter, double dValue) {
     int oldPositionSeconds = m_iPosSeconds;
     m_iPosSeconds = static_cast<int>(dParameter * m_trackSamplesControl->get());
     if ((m_bTimeRulerActive || m_pHoveredMark != nullptr) && oldPositionSeconds != m_iPosSeconds) {
-        redraw = true;
-    }
-
-    if (redraw) {
-        update();
+        invalidateMarkLayers();
+    } else if (oldPos != m_iPlayPos) {
+        // Only repaint the pixels of the played overlay and the play position
+        // that have changed.
+        update(playPositionRect(oldPos, m_iPlayPos));
     }
 }
 
@@ -275,7 +275,7 @@ void WOverview::slotWaveformSummaryUpdated() {
         if (m_pWaveform->getCompletion() == m_pWaveform->getDataSize()) {
             m_actualCompletion = 0;
             if (drawNextPixmapPart()) {
-                update();
+                invalidateLayers();
             }
         }
     } else {
@@ -286,7 +286,7 @@ void WOverview::slotWaveformSummaryUpdated() {
         m_waveformPeak = -1.0;
         m_pixmapDone = false;
 
-        update();
+        invalidateLayers();
     }
 }
 
@@ -298,7 +298,7 @@ void WOverview::onTrackAnalyzerProgress(TrackId trackId, AnalyzerProgress analyz
     bool updateNeeded = drawNextPixmapPart();
     if (updateNeeded || (m_analyzerProgress != analyzerProgress)) {
         m_analyzerProgress = analyzerProgress;
-        update();
+        invalidateLayers();
     }
 }
 
@@ -309,7 +309,7 @@ void WOverview::slotTrackLoaded(TrackPointer pTrack) {
     if (m_pCurrentTrack) {
         updateCues(m_pCurrentTrack->getCuePoints());
     }
-    update();
+    invalidateLayers();
 }
 
 void WOverview::slotLoadingTrack(TrackPointer pNewTrack, TrackPointer pOldTrack) {
@@ -345,13 +345,13 @@ void WOverview::slotLoadingTrack(TrackPointer pNewTrack, TrackPointer pOldTrack)
         m_pCurrentTrack.reset();
         m_pWaveform.clear();
     }
-    update();
+    invalidateLayers();
 }
 
 void WOverview::onEndOfTrackChange(double v) {
     //qDebug() << "WOverview::onEndOfTrackChange()" << v;
     m_endOfTrack = v > 0.0;
-    update();
+    invalidateLayers();
 }
 
 void WOverview::onMarkChanged(double v) {
@@ -359,19 +359,19 @@ void WOverview::onMarkChanged(double v) {
     //qDebug() << "WOverview::onMarkChanged()" << v;
     if (m_pCurrentTrack) {
         updateCues(m_pCurrentTrack->getCuePoints());
-        update();
+        invalidateMarkLayers();
     }
 }
 
 void WOverview::onMarkRangeChange(double v) {
     Q_UNUSED(v);
     //qDebug() << "WOverview::onMarkRangeChange()" << v;
-    update();
+    invalidateMarkLayers();
 }
 
 void WOverview::onRateRatioChange(double v) {
     Q_UNUSED(v);
-    update();
+    invalidateMarkLayers();
 }
 
 void WOverview::onPassthroughChange(double v) {
@@ -382,7 +382,7 @@ void WOverview::onPassthroughChange(double v) {
     }
 
     // Always call this to trigger a repaint even if not track is loaded
-    update();
+    invalidateLayers();
 }
 
 void WOverview::updateCues(const QList<CuePointer> &loadedCues) {
@@ -449,10 +449,12 @@ void WOverview::mouseMoveEvent(QMouseEvent* e) {
         // cursor is dragged outside this widget before releasing right click.
         m_timeRulerPos.setX(math_clamp(e->pos().x(), 0, width()));
         m_timeRulerPos.setY(math_clamp(e->pos().y(), 0, height()));
+        // The time ruler and the mark labels are not cached while active
         update();
         return;
     }
 
+    const WaveformMarkPointer pPreviouslyHoveredMark = m_pHoveredMark;
     m_pHoveredMark.clear();
 
     // Non-hotcue marks (intro/outro cues, main cue, loop in/out) are sorted
@@ -470,7 +472,11 @@ void WOverview::mouseMoveEvent(QMouseEvent* e) {
     }
 
     //qDebug() << "WOverview::mouseMoveEvent" << e->pos() << m_iPos;
-    update();
+    if (m_pHoveredMark != pPreviouslyHoveredMark) {
+        invalidateMarkLayers();
+    } else {
+        update();
+    }
 }
 
 void WOverview::mouseReleaseEvent(QMouseEvent* e) {
@@ -490,6 +496,7 @@ void WOverview::mouseReleaseEvent(QMouseEvent* e) {
         // prevent accidental seeking when trying to right click a hotcue.
         m_bTimeRulerActive = false;
     }
+    invalidateMarkLayers();
 }
 
 void WOverview::mousePressEvent(QMouseEvent* e) {
@@ -521,6 +528,7 @@ void WOverview::mousePressEvent(QMouseEvent* e) {
             m_iPickupPos = m_iPlayPos;
             m_bLeftClickDragging = false;
             m_bTimeRulerActive = false;
+            invalidateMarkLayers();
         } else if (m_pHoveredMark == nullptr) {
             m_bTimeRulerActive = true;
             m_timeRulerPos = e->pos();
@@ -553,7 +561,7 @@ void WOverview::mousePressEvent(QMouseEvent* e) {
 
 void WOverview::slotCueMenuPopupAboutToHide() {
     m_pHoveredMark.clear();
-    update();
+    invalidateMarkLayers();
 }
 
 void WOverview::leaveEvent(QEvent* pEvent) {
@@ -563,14 +571,114 @@ void WOverview::leaveEvent(QEvent* pEvent) {
     }
     m_bLeftClickDragging = false;
     m_bTimeRulerActive = false;
-    update();
+    invalidateMarkLayers();
 }
 
 void WOverview::paintEvent(QPaintEvent* pEvent) {
-    Q_UNUSED(pEvent);
     ScopedTimer t("WOverview::paintEvent");
+    FrameTimeline::Scope frameTimelineScope("WOverview::paintEvent");
+
+    // The static parts of the overview are rendered into layers that are only
+    // re-rendered if they have changed. Each frame only the played overlay
+    // and the play position are drawn on top, and only within the dirty
+    // rectangle, which is usually just the few pixels the play position has
+    // moved.
+    const double trackSamples = m_trackSamplesControl->get();
+    const bool marksVisible = m_pCurrentTrack && m_trackLoaded && trackSamples > 0;
+    const float offset = 1.0f;
+    const auto gain = marksVisible
+            ? static_cast<CSAMPLE_GAIN>(length() - 2) /
+                    static_cast<CSAMPLE_GAIN>(trackSamples)
+            : 0.0f;
+
+    if (rescaleWaveformImage()) {
+        m_waveformLayerDirty = true;
+    }
+    if (m_markLayersGain != gain) {
+        m_markLayersDirty = true;
+    }
+    const bool layersChanged = m_waveformLayerDirty || m_markLayersDirty;
+    if (m_waveformLayerDirty) {
+        renderWaveformLayer();
+    }
+    if (m_markLayersDirty) {
+        renderMarkLayers(marksVisible, offset, gain);
+    }
 
+    const QRect dirtyRect = pEvent->rect();
+    if (layersChanged && !dirtyRect.contains(rect())) {
+        // The layers have been invalidated lazily, e.g. by a gain change,
+        // while only a few pixels are repainted. Schedule a repaint of the
+        // whole widget to show the new layers everywhere.
+        update();
+    }
     QPainter painter(this);
+    drawLayer(&painter, m_waveformLayer, dirtyRect);
+
+    if (m_pCurrentTrack) {
+        drawPlayedOverlay(&painter);
+        drawPlayPosition(&painter);
+        drawLayer(&painter, m_marksLayer, dirtyRect);
+
+        if (marksVisible) {
+            drawPickupPosition(&painter);
+            if (m_bTimeRulerActive) {
+                // The labels must not overlap the time ruler labels, which
+                // follow the mouse.
+                drawTimeRuler(&painter);
+                drawMarkLabels(&painter, offset, gain);
+            } else {
+                drawLayer(&painter, m_markLabelsLayer, dirtyRect);
+            }
+        }
+    }
+
+    if (m_bPassthroughEnabled) {
+        drawPassthroughOverlay(&painter);
+        m_pPassthroughLabel->show();
+    } else {
+        m_pPassthroughLabel->hide();
+    }
+}
+
+void WOverview::invalidateLayers() {
+    m_waveformLayerDirty = true;
+    invalidateMarkLayers();
+}
+
+void WOverview::invalidateMarkLayers() {
+    m_markLayersDirty = true;
+    update();
+}
+
+void WOverview::prepareLayer(QImage* pLayer) {
+    const qreal devicePixelRatio = getDevicePixelRatioF(this);
+    const QSize layerSize = size() * devicePixelRatio;
+    if (pLayer->size() != layerSize || pLayer->devicePixelRatio() != devicePixelRatio) {
+        *pLayer = QImage(layerSize, QImage::Format_ARGB32_Premultiplied);
+        pLayer->setDevicePixelRatio(devicePixelRatio);
+    }
+    pLayer->fill(Qt::transparent);
+}
+
+void WOverview::drawLayer(QPainter* pPainter, const QImage& layer, const QRect& rect) {
+    if (layer.isNull()) {
+        return;
+    }
+    const qreal devicePixelRatio = layer.devicePixelRatio();
+    pPainter->drawImage(rect,
+            layer,
+            QRectF(rect.topLeft() * devicePixelRatio,
+                    rect.size() * devicePixelRatio));
+}
+
+void WOverview::renderWaveformLayer() {
+    ScopedTimer t("WOverview::renderWaveformLayer");
+    prepareLayer(&m_waveformLayer);
+    m_waveformLayerDirty = false;
+
+    QPainter painter(&m_waveformLayer);
+    painter.setFont(font());
     painter.fillRect(rect(), m_backgroundColor);
 
     if (!m_backgroundPixmap.isNull()) {
@@ -583,30 +691,50 @@ void WOverview::paintEvent(QPaintEvent* pEvent) {
         drawEndOfTrackBackground(&painter);
         drawAxis(&painter);
         drawWaveformPixmap(&painter);
-        drawPlayedOverlay(&painter);
-        drawPlayPosition(&painter);
-        drawEndOfTrackFrame(&painter);
-        drawAnalyzerProgress(&painter);
+    }
+}
 
-        double trackSamples = m_trackSamplesControl->get();
-        if (m_trackLoaded && trackSamples > 0) {
-            const float offset = 1.0f;
-            const auto gain = static_cast<CSAMPLE_GAIN>(length() - 2) /
-                    static_cast<CSAMPLE_GAIN>(m_trackSamplesControl->get());
+void WOverview::renderMarkLayers(bool marksVisible, float offset, float gain) {
+    ScopedTimer t("WOverview::renderMarkLayers");
+    prepareLayer(&m_marksLayer);
+    prepareLayer(&m_markLabelsLayer);
+    m_markLayersDirty = false;
+    m_markLayersGain = gain;
 
-            drawRangeMarks(&painter, offset, gain);
-            drawMarks(&painter, offset, gain);
-            drawPickupPosition(&painter);
-            drawTimeRuler(&painter);
-            drawMarkLabels(&painter, offset, gain);
+    if (!m_pCurrentTrack) {
+        return;
+    }
+
+    QPainter painter(&m_marksLayer);
+    painter.setFont(font());
+    drawEndOfTrackFrame(&painter);
+    drawAnalyzerProgress(&painter);
+
+    if (marksVisible) {
+        drawRangeMarks(&painter, offset, gain);
+        // Also prepares the labels
+        drawMarks(&painter, offset, gain);
+
+        if (!m_bTimeRulerActive) {
+            m_timeRulerPositionLabel.clear();
+            m_timeRulerDistanceLabel.clear();
+            QPainter labelsPainter(&m_markLabelsLayer);
+            labelsPainter.setFont(font());
+            drawMarkLabels(&labelsPainter, offset, gain);
         }
     }
+}
 
-    if (m_bPassthroughEnabled) {
-        drawPassthroughOverlay(&painter);
-        m_pPassthroughLabel->show();
+QRect WOverview::playPositionRect(int position1, int position2) const {
+    // The pick-up triangles and the outlines are drawn up to 2 pixels
+    // beside the position, plus half of the pen width
+    const int margin = 3 + static_cast<int>(std::ceil(m_scaleFactor));
+    const int first = math_min(position1, position2) - margin;
+    const int last = math_max(position1, position2) + margin;
+    if (m_orientation == Qt::Horizontal) {
+        return QRect(first, 0, last - first + 1, height());
     } else {
-        m_pPassthroughLabel->hide();
+        return QRect(0, first, width(), last - first + 1);
     }
 }
 
@@ -629,37 +757,43 @@ void WOverview::drawAxis(QPainter* pPainter) {
     }
 }
 
-void WOverview::drawWaveformPixmap(QPainter* pPainter) {
+bool WOverview::rescaleWaveformImage() {
+    if (m_waveformSourceImage.isNull()) {
+        return false;
+    }
     WaveformWidgetFactory* widgetFactory = WaveformWidgetFactory::instance();
-    if (!m_waveformSourceImage.isNull()) {
-        PainterScope painterScope(pPainter);
-        float diffGain;
-        bool normalize = widgetFactory->isOverviewNormalized();
-        if (normalize && m_pixmapDone && m_waveformPeak > 1) {
-            diffGain = 255 - m_waveformPeak - 1;
-        } else {
-            const auto visualGain = static_cast<float>(
-                    widgetFactory->getVisualGain(WaveformWidgetFactory::All));
-            diffGain = 255.0f - (255.0f / visualGain);
-        }
+    float diffGain;
+    bool normalize = widgetFactory->isOverviewNormalized();
+    if (normalize && m_pixmapDone && m_waveformPeak > 1) {
+        diffGain = 255 - m_waveformPeak - 1;
+    } else {
+        const auto visualGain = static_cast<float>(
+                widgetFactory->getVisualGain(WaveformWidgetFactory::All));
+        diffGain = 255.0f - (255.0f / visualGain);
+    }
 
-        if (m_diffGain != diffGain || m_waveformImageScaled.isNull()) {
-            QRect sourceRect(0,
-                    static_cast<int>(diffGain),
-                    m_waveformSourceImage.width(),
-                    m_waveformSourceImage.height() -
-                            2 * static_cast<int>(diffGain));
-            QImage croppedImage = m_waveformSourceImage.copy(sourceRect);
-            if (m_orientation == Qt::Vertical) {
-                // Rotate pixmap
-                croppedImage = croppedImage.transformed(QTransform(0, 1, 1, 0, 0, 0));
-            }
-            m_waveformImageScaled = croppedImage.scaled(size() * m_devicePixelRatio,
-                    Qt::IgnoreAspectRatio,
-                    Qt::SmoothTransformation);
-            m_diffGain = diffGain;
-        }
+    if (m_diffGain == diffGain && !m_waveformImageScaled.isNull()) {
+        return false;
+    }
+    QRect sourceRect(0,
+            static_cast<int>(diffGain),
+            m_waveformSourceImage.width(),
+            m_waveformSourceImage.height() -
+                    2 * static_cast<int>(diffGain));
+    QImage croppedImage = m_waveformSourceImage.copy(sourceRect);
+    if (m_orientation == Qt::Vertical) {
+        // Rotate pixmap
+        croppedImage = croppedImage.transformed(QTransform(0, 1, 1, 0, 0, 0));
+    }
+    m_waveformImageScaled = croppedImage.scaled(size() * m_devicePixelRatio,
+            Qt::IgnoreAspectRatio,
+            Qt::SmoothTransformation);
+    m_diffGain = diffGain;
+    return true;
+}
 
+void WOverview::drawWaveformPixmap(QPainter* pPainter) {
+    if (!m_waveformSourceImage.isNull()) {
         pPainter->drawImage(rect(), m_waveformImageScaled);
     }
 }
@@ -1261,6 +1395,7 @@ void WOverview::resizeEvent(QResizeEvent* pEvent) {
     m_waveformImageScaled = QImage();
     m_diffGain = 0;
     Init();
+    invalidateLayers();
 }
 
 void WOverview::dragEnterEvent(QDragEnterEvent* pEvent) {
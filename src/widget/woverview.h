@@ -108,6 +108,21 @@ class WOverview : public WWidget, public TrackDropTarget {
     // Append the waveform overview pixmap according to available data
     // in waveform
     virtual bool drawNextPixmapPart() = 0;
+
+    // Re-renders all cached layers on the next paint event and schedules a
+    // repaint of the whole widget.
+    void invalidateLayers();
+    // Like invalidateLayers(), but keeps the waveform layer.
+    void invalidateMarkLayers();
+    void prepareLayer(QImage* pLayer);
+    void drawLayer(QPainter* pPainter, const QImage& layer, const QRect& rect);
+    void renderWaveformLayer();
+    void renderMarkLayers(bool marksVisible, float offset, float gain);
+    // The area that changes if the play position moves between the positions
+    QRect playPositionRect(int position1, int position2) const;
+    // Updates m_waveformImageScaled, returns true if it has changed
+    bool rescaleWaveformImage();
+
     void drawEndOfTrackBackground(QPainter* pPainter);
     void drawAxis(QPainter* pPainter);
     void drawWaveformPixmap(QPainter* pPainter);
@@ -196,4 +211,15 @@ class WOverview : public WWidget, public TrackDropTarget {
     AnalyzerProgress m_analyzerProgress;
     bool m_trackLoaded;
     double m_scaleFactor;
+
+    // Cached layers in physical pixels. The waveform layer contains the
+    // background, the axis and the waveform. The marks layer is drawn above
+    // the played overlay and the labels layer above the play position.
+    QImage m_waveformLayer;
+    QImage m_marksLayer;
+    QImage m_markLabelsLayer;
+    bool m_waveformLayerDirty;
+    bool m_markLayersDirty;
+    // The track samples to pixels gain of the mark layers
+    float m_markLayersGain;
 };
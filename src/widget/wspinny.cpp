@@ -15,6 +15,7 @@
 #include "track/track.h"
 #include "util/compatibility.h"
 #include "util/dnd.h"
+#include "util/frametimeline.h"
 #include "util/math.h"
 #include "vinylcontrol/vinylcontrol.h"
 #include "vinylcontrol/vinylcontrolmanager.h"
@@ -312,6 +313,7 @@ void WSpinny::render(VSyncThread* vSyncThread) {
     if (!isValid() || !isVisible()) {
         return;
     }
+    FrameTimeline::Scope frameTimelineScope("WSpinny::render");
 
     auto* window = windowHandle();
     if (window == nullptr || !window->isExposed()) {
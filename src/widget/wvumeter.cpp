@@ -7,6 +7,7 @@
 #include <QtDebug>
 
 #include "moc_wvumeter.cpp"
+#include "util/frametimeline.h"
 #include "util/math.h"
 #include "util/timer.h"
 #include "widget/wpixmapstore.h"
@@ -156,6 +157,7 @@ void WVuMeter::maybeUpdate() {
 
 void WVuMeter::paintEvent(QPaintEvent * /*unused*/) {
     ScopedTimer t("WVuMeter::paintEvent");
+    FrameTimeline::Scope frameTimelineScope("WVuMeter::paintEvent");
 
     QStyleOption option;
     option.initFrom(this);